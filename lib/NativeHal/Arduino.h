@@ -0,0 +1,69 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief Thin stand-in for the Arduino core, for the `native` environment.
+ * @details Only what the motor logic and Modbus libraries use.
+ *          Time comes from the host's monotonic clock, so measurements are real.
+ *          Threads stand in for FreeRTOS tasks.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define HEX 16
+#define DEC 10
+
+#define IRAM_ATTR
+#define ARDUINO_ISR_ATTR
+
+///@brief Milliseconds since start up.
+unsigned long millis();
+
+///@brief Microseconds since start up.
+unsigned long micros();
+
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+/**
+ * @brief Simulated GPIO.
+ * @details Outputs remember what was written, inputs return what the simulation set.
+ * @see setPinInput
+ */
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+///@brief Drive a simulated input pin.
+void setPinInput(uint8_t pin, uint8_t value);
+
+///@brief The parts of the ESP32 core's `EspClass` which the firmware uses.
+class EspClass
+{
+public:
+    ///@brief Nanoseconds, so the "CPU" runs at 1GHz.
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz();
+};
+
+extern EspClass ESP;
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "HardwareSerial.h"
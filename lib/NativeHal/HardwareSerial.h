@@ -0,0 +1,195 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///@brief Same values as the ESP32 core.
+#define SERIAL_5N1 0x8000010
+#define SERIAL_6N1 0x8000014
+#define SERIAL_7N1 0x8000018
+#define SERIAL_8N1 0x800001c
+#define SERIAL_5N2 0x8000030
+#define SERIAL_6N2 0x8000034
+#define SERIAL_7N2 0x8000038
+#define SERIAL_8N2 0x800003c
+#define SERIAL_5E1 0x8000012
+#define SERIAL_6E1 0x8000016
+#define SERIAL_7E1 0x800001a
+#define SERIAL_8E1 0x800001e
+#define SERIAL_5E2 0x8000032
+#define SERIAL_6E2 0x8000036
+#define SERIAL_7E2 0x800003a
+#define SERIAL_8E2 0x800003e
+#define SERIAL_5O1 0x8000013
+#define SERIAL_6O1 0x8000017
+#define SERIAL_7O1 0x800001b
+#define SERIAL_8O1 0x800001f
+#define SERIAL_5O2 0x8000033
+#define SERIAL_6O2 0x8000037
+#define SERIAL_7O2 0x800003b
+#define SERIAL_8O2 0x800003f
+
+class Print
+{
+public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t value) = 0;
+
+    virtual size_t write(const uint8_t* buffer, const size_t size)
+    {
+        size_t written = 0;
+        while (written < size && write(buffer[written]))
+        {
+            written++;
+        }
+        return written;
+    }
+
+    virtual void flush()
+    {
+    }
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(const unsigned long timeout)
+    {
+        this->timeout = timeout;
+    }
+
+protected:
+    unsigned long timeout = 1000;
+};
+
+/**
+ * @brief Whatever is on the other end of a simulated serial line.
+ */
+class SerialDevice
+{
+public:
+    virtual ~SerialDevice() = default;
+
+    /**
+     * @brief Bytes sent by the host.
+     * @param data Bytes, in order.
+     * @param length Number of bytes.
+     * @param at `micros()` when the last byte finished arriving.
+     */
+    virtual void receive(const uint8_t* data, size_t length, unsigned long at) = 0;
+};
+
+using OnReceiveCb = std::function<void(void)>;
+
+/**
+ * @brief Simulated UART.
+ * @details Bytes take as long to arrive as they would on the wire.
+ *          Anything written is handed to every attached `SerialDevice`, which replies with `inject()`.
+ *          <br/>
+ *          Like the ESP32 core, `onReceive()` callbacks run on their own event thread, once the line goes quiet.
+ */
+class HardwareSerial : public Stream
+{
+public:
+    explicit HardwareSerial(int uartNumber = 0);
+    ~HardwareSerial() override;
+    HardwareSerial(const HardwareSerial&) = delete;
+    HardwareSerial(const HardwareSerial&&) = delete;
+
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1);
+    void end();
+    void updateBaudRate(unsigned long baud);
+    uint32_t baudRate() const;
+
+    size_t setRxBufferSize(size_t size);
+    size_t setTxBufferSize(size_t size);
+
+    /**
+     * @brief Call `function` whenever the line has been quiet for the receive timeout.
+     * @details Only the receive timeout is simulated, so `onlyOnTimeout` is ignored.
+     */
+    void onReceive(const OnReceiveCb& function, bool onlyOnTimeout = false);
+
+    ///@brief Receive timeout, in characters.
+    bool setRxTimeout(uint8_t symbols);
+
+    int available() override;
+    int read() override;
+    size_t read(uint8_t* buffer, size_t size);
+    int peek() override;
+    size_t write(uint8_t value) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+
+    ///@brief Wait until everything written has left the wire.
+    void flush() override;
+
+    ///@brief Connect a device to the other end of the line.  Several may share it, like drives on an RS485 bus.
+    void attach(SerialDevice* device)
+    {
+        devices.push_back(device);
+    }
+
+    /**
+     * @brief Queue bytes coming from an attached device.
+     * @param data Bytes, in order.
+     * @param length Number of bytes.
+     * @param at `micros()` when the first byte starts arriving.
+     */
+    void inject(const uint8_t* data, size_t length, unsigned long at);
+
+    ///@brief Time to send `count` characters at the current baud rate, in microseconds.
+    [[nodiscard]] unsigned long characterTime(size_t count) const;
+
+private:
+    struct Pending
+    {
+        ///@brief `micros()` when the byte has fully arrived.
+        unsigned long at;
+        uint8_t value;
+    };
+
+    int uartNumber;
+    unsigned long baud = 0;
+    ///@brief Start, data, parity, and stop bits per character.
+    uint8_t bitsPerCharacter = 10;
+    size_t rxBufferSize = 256;
+    std::deque<Pending> rx;
+    ///@brief `micros()` when the transmitter goes idle.
+    unsigned long txIdleAt = 0;
+    std::vector<SerialDevice*> devices;
+
+    ///@brief Both the caller and the event thread use the buffers.  Recursive, since devices reply from inside `write()`.
+    std::recursive_mutex mutex;
+    std::condition_variable_any changed;
+    std::thread eventThread;
+    bool stopping = false;
+    OnReceiveCb onReceiveCb = nullptr;
+    uint8_t rxTimeout = 2;
+    ///@brief Bytes were injected since the last callback.
+    bool eventPending = false;
+
+    ///@brief Count bytes which have fully arrived.  Caller must hold `mutex`.
+    [[nodiscard]] int arrived() const;
+
+    void eventLoop();
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
@@ -0,0 +1,361 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "Arduino.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct NativeTask
+{
+    std::mutex mutex;
+    std::condition_variable notified;
+    uint32_t count = 0;
+};
+
+namespace
+{
+    const auto START = std::chrono::steady_clock::now();
+
+    constexpr size_t PIN_COUNT = 40;
+    std::array<uint8_t, PIN_COUNT> pinModes = {};
+    std::array<uint8_t, PIN_COUNT> pinValues = {};
+
+    ///@brief Never freed, so notifying a finished thread is harmless.
+    thread_local const auto currentTask = new NativeTask();
+}
+
+EspClass ESP;
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+HardwareSerial Serial2(2);
+
+unsigned long millis()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - START).count();
+}
+
+unsigned long micros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - START).count();
+}
+
+void delay(const uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(const uint32_t us)
+{
+    // Sleeping is far too coarse for bit timing, so spin.
+    const auto start = micros();
+    while (micros() - start < us)
+    {
+    }
+}
+
+void yield()
+{
+    std::this_thread::yield();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return currentTask;
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return millis();
+}
+
+void vTaskDelay(const TickType_t ticks)
+{
+    delay(ticks);
+}
+
+uint32_t ulTaskNotifyTake(const BaseType_t clearOnExit, const TickType_t ticks)
+{
+    auto& task = *currentTask;
+    auto lock = std::unique_lock(task.mutex);
+    const auto notified = [&task]
+    {
+        return task.count != 0;
+    };
+    if (ticks == portMAX_DELAY)
+    {
+        task.notified.wait(lock, notified);
+    }
+    else
+    {
+        task.notified.wait_for(lock, std::chrono::milliseconds(ticks), notified);
+    }
+    const auto count = task.count;
+    if (count != 0)
+    {
+        task.count = clearOnExit ? 0 : count - 1;
+    }
+    return count;
+}
+
+BaseType_t xTaskNotifyGive(const TaskHandle_t task)
+{
+    {
+        const auto lock = std::lock_guard(task->mutex);
+        task->count++;
+    }
+    task->notified.notify_one();
+    return pdTRUE;
+}
+
+uint32_t EspClass::getCycleCount()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - START).count();
+}
+
+uint32_t EspClass::getCpuFreqMHz()
+{
+    return 1000;
+}
+
+void pinMode(const uint8_t pin, const uint8_t mode)
+{
+    if (pin < PIN_COUNT)
+    {
+        pinModes[pin] = mode;
+        if (mode == INPUT_PULLUP)
+        {
+            pinValues[pin] = HIGH;
+        }
+    }
+}
+
+void digitalWrite(const uint8_t pin, const uint8_t value)
+{
+    if (pin < PIN_COUNT && pinModes[pin] == OUTPUT)
+    {
+        pinValues[pin] = value;
+    }
+}
+
+int digitalRead(const uint8_t pin)
+{
+    return pin < PIN_COUNT ? pinValues[pin] : LOW;
+}
+
+void setPinInput(const uint8_t pin, const uint8_t value)
+{
+    if (pin < PIN_COUNT && pinModes[pin] != OUTPUT)
+    {
+        pinValues[pin] = value;
+    }
+}
+
+HardwareSerial::HardwareSerial(const int uartNumber):
+    uartNumber{uartNumber}
+{
+}
+
+HardwareSerial::~HardwareSerial()
+{
+    {
+        const auto lock = std::lock_guard(mutex);
+        stopping = true;
+    }
+    changed.notify_all();
+    if (eventThread.joinable())
+    {
+        eventThread.join();
+    }
+}
+
+void HardwareSerial::begin(const unsigned long baud, const uint32_t config, int8_t, int8_t)
+{
+    const auto lock = std::lock_guard(mutex);
+    this->baud = baud;
+    const auto dataBits = 5 + (config >> 2 & 0x03);
+    const auto parityBits = (config & 0x02) ? 1 : 0;
+    const auto stopBits = (config & 0x30) == 0x30 ? 2 : 1;
+    bitsPerCharacter = 1 + dataBits + parityBits + stopBits;
+    rx.clear();
+    txIdleAt = micros();
+}
+
+void HardwareSerial::end()
+{
+    const auto lock = std::lock_guard(mutex);
+    baud = 0;
+    rx.clear();
+}
+
+void HardwareSerial::updateBaudRate(const unsigned long baud)
+{
+    const auto lock = std::lock_guard(mutex);
+    this->baud = baud;
+}
+
+uint32_t HardwareSerial::baudRate() const
+{
+    return baud;
+}
+
+size_t HardwareSerial::setRxBufferSize(const size_t size)
+{
+    rxBufferSize = size;
+    return size;
+}
+
+size_t HardwareSerial::setTxBufferSize(const size_t size)
+{
+    return size;
+}
+
+void HardwareSerial::onReceive(const OnReceiveCb& function, bool)
+{
+    const auto lock = std::lock_guard(mutex);
+    onReceiveCb = function;
+    if (not eventThread.joinable())
+    {
+        eventThread = std::thread(&HardwareSerial::eventLoop, this);
+    }
+}
+
+bool HardwareSerial::setRxTimeout(const uint8_t symbols)
+{
+    const auto lock = std::lock_guard(mutex);
+    rxTimeout = symbols;
+    return true;
+}
+
+int HardwareSerial::arrived() const
+{
+    const auto now = micros();
+    int count = 0;
+    for (const auto& pending : rx)
+    {
+        if (static_cast<long>(now - pending.at) < 0)
+        {
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+
+int HardwareSerial::available()
+{
+    const auto lock = std::lock_guard(mutex);
+    return arrived();
+}
+
+int HardwareSerial::read()
+{
+    const auto lock = std::lock_guard(mutex);
+    if (arrived() == 0)
+    {
+        return -1;
+    }
+    const auto value = rx.front().value;
+    rx.pop_front();
+    return value;
+}
+
+size_t HardwareSerial::read(uint8_t* buffer, const size_t size)
+{
+    const auto lock = std::lock_guard(mutex);
+    const auto count = std::min<size_t>(arrived(), size);
+    for (size_t i = 0; i < count; i++)
+    {
+        buffer[i] = rx.front().value;
+        rx.pop_front();
+    }
+    return count;
+}
+
+int HardwareSerial::peek()
+{
+    const auto lock = std::lock_guard(mutex);
+    return arrived() == 0 ? -1 : rx.front().value;
+}
+
+size_t HardwareSerial::write(const uint8_t value)
+{
+    return write(&value, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, const size_t size)
+{
+    const auto lock = std::lock_guard(mutex);
+    if (baud == 0)
+    {
+        return 0;
+    }
+    const auto now = micros();
+    const auto start = static_cast<long>(txIdleAt - now) > 0 ? txIdleAt : now;
+    txIdleAt = start + characterTime(size);
+    for (const auto device : devices)
+    {
+        device->receive(buffer, size, txIdleAt);
+    }
+    return size;
+}
+
+void HardwareSerial::flush()
+{
+    auto lock = std::unique_lock(mutex);
+    while (static_cast<long>(txIdleAt - micros()) > 0)
+    {
+        lock.unlock();
+        lock.lock();
+    }
+}
+
+void HardwareSerial::inject(const uint8_t* data, const size_t length, const unsigned long at)
+{
+    {
+        const auto lock = std::lock_guard(mutex);
+        for (size_t i = 0; i < length && rx.size() < rxBufferSize; i++)
+        {
+            // Same as a real UART: overflowing bytes are lost.
+            rx.push_back({at + characterTime(i + 1), data[i]});
+        }
+        eventPending = true;
+    }
+    changed.notify_all();
+}
+
+void HardwareSerial::eventLoop()
+{
+    auto lock = std::unique_lock(mutex);
+    while (not stopping)
+    {
+        if (not eventPending || rx.empty() || onReceiveCb == nullptr)
+        {
+            changed.wait(lock);
+            continue;
+        }
+        // Same as the UART: the event fires once the line has been quiet for the timeout.
+        const auto quietAt = rx.back().at + characterTime(rxTimeout);
+        if (static_cast<long>(quietAt - micros()) > 0)
+        {
+            changed.wait_until(lock, START + std::chrono::microseconds(quietAt));
+            continue;
+        }
+        eventPending = false;
+        const auto callback = onReceiveCb;
+        lock.unlock();
+        callback();
+        lock.lock();
+    }
+}
+
+unsigned long HardwareSerial::characterTime(const size_t count) const
+{
+    return baud == 0 ? 0 : static_cast<unsigned long>(static_cast<uint64_t>(count) * bitsPerCharacter * 1000000 / baud);
+}
@@ -0,0 +1,20 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief FreeRTOS types, for the `native` environment.
+ * @details Ticks are milliseconds, the same as the ESP32 default.
+ */
+
+#pragma once
+#include <cstdint>
+
+using TickType_t = uint32_t;
+using BaseType_t = int;
+using UBaseType_t = unsigned int;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define portMAX_DELAY static_cast<TickType_t>(0xFFFFFFFFUL)
+#define pdMS_TO_TICKS(ms) static_cast<TickType_t>(ms)
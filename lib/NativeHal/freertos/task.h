@@ -0,0 +1,27 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief FreeRTOS task notifications, for the `native` environment.
+ * @details Every host thread counts as a task.
+ */
+
+#pragma once
+#include "FreeRTOS.h"
+
+struct NativeTask;
+using TaskHandle_t = NativeTask*;
+
+TaskHandle_t xTaskGetCurrentTaskHandle();
+TickType_t xTaskGetTickCount();
+void vTaskDelay(TickType_t ticks);
+
+/**
+ * @brief Wait for a notification.
+ * @param clearOnExit pdTRUE to take every pending notification, pdFALSE to take one.
+ * @return Notification count before it was taken.  0 on timeout.
+ */
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
@@ -0,0 +1,230 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "AsyncModbusMaster.hpp"
+#include "ModbusDefinitions.hpp"
+
+AsyncModbusMaster::AsyncModbusMaster(RtuTransport& transport):
+    transport{transport}
+{
+}
+
+ModbusTransactionHandle AsyncModbusMaster::submit(ModbusADU& request, const ModbusTransactionCallback& callback, const uint32_t timeout)
+{
+    for (auto& transaction : transactions)
+    {
+        if (transaction.state != TRANSACTION_FREE)
+        {
+            continue;
+        }
+        transaction.handle = nextHandle++;
+        if (nextHandle == INVALID_TRANSACTION)
+        {
+            nextHandle++;
+        }
+        transaction.state = TRANSACTION_QUEUED;
+        transaction.error = MODBUS_RTU_MASTER_SUCCESS;
+        transaction.unitId = request.getUnitId();
+        transaction.functionCode = request.getFunctionCode();
+        transaction.timeout = timeout;
+        transaction.callback = callback;
+        copyAdu(transaction.adu, request);
+        return transaction.handle;
+    }
+    return INVALID_TRANSACTION;
+}
+
+void AsyncModbusMaster::update()
+{
+    if (active != nullptr)
+    {
+        receive();
+        return;
+    }
+
+    // Oldest queued transaction goes next.
+    Transaction* next = nullptr;
+    for (auto& transaction : transactions)
+    {
+        if (transaction.state == TRANSACTION_QUEUED && (next == nullptr || transaction.handle - next->handle > UINT32_MAX / 2))
+        {
+            next = &transaction;
+        }
+    }
+    if (next != nullptr)
+    {
+        start(*next);
+    }
+}
+
+ModbusTransactionState AsyncModbusMaster::poll(const ModbusTransactionHandle handle)
+{
+    update();
+    const auto transaction = find(handle);
+    return transaction == nullptr ? TRANSACTION_FREE : transaction->state;
+}
+
+ModbusRTUMasterError AsyncModbusMaster::getError(const ModbusTransactionHandle handle) const
+{
+    const auto transaction = find(handle);
+    return transaction == nullptr ? MODBUS_RTU_MASTER_UNKNOWN_COMM_ERROR : transaction->error;
+}
+
+ModbusADU* AsyncModbusMaster::getResponse(const ModbusTransactionHandle handle)
+{
+    const auto transaction = find(handle);
+    return transaction == nullptr ? nullptr : &transaction->adu;
+}
+
+void AsyncModbusMaster::release(const ModbusTransactionHandle handle)
+{
+    const auto transaction = find(handle);
+    if (transaction == nullptr || transaction == active)
+    {
+        // In flight transactions must finish, or the next response would be misread.
+        return;
+    }
+    transaction->state = TRANSACTION_FREE;
+    transaction->callback = nullptr;
+}
+
+bool AsyncModbusMaster::isIdle() const
+{
+    if (active != nullptr)
+    {
+        return false;
+    }
+    for (const auto& transaction : transactions)
+    {
+        if (transaction.state == TRANSACTION_QUEUED)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+AsyncModbusMaster::Transaction* AsyncModbusMaster::find(const ModbusTransactionHandle handle)
+{
+    return const_cast<Transaction*>(static_cast<const AsyncModbusMaster*>(this)->find(handle));
+}
+
+const AsyncModbusMaster::Transaction* AsyncModbusMaster::find(const ModbusTransactionHandle handle) const
+{
+    if (handle == INVALID_TRANSACTION)
+    {
+        return nullptr;
+    }
+    for (const auto& transaction : transactions)
+    {
+        if (transaction.handle == handle && transaction.state != TRANSACTION_FREE)
+        {
+            return &transaction;
+        }
+    }
+    return nullptr;
+}
+
+void AsyncModbusMaster::start(Transaction& transaction)
+{
+    // Anything left over is a late reply to an earlier, timed out, request.
+    transport.clear();
+
+    // Taken first, since the response's start is back-dated, and may otherwise seem to come before the request.
+    sentAt = micros();
+    sentAtMillis = millis();
+    transport.send(transaction.adu);
+    transaction.state = TRANSACTION_IN_FLIGHT;
+    active = &transaction;
+    timeout = rtt.getTimeout() * 1000;
+
+    // Broadcasts never get a response.
+    if (transaction.unitId == 0)
+    {
+        complete(MODBUS_RTU_MASTER_SUCCESS);
+    }
+}
+
+void AsyncModbusMaster::receive()
+{
+    const auto response = transport.receive();
+    if (response == nullptr)
+    {
+        // Fixed timeouts can run for seconds, so are timed in milliseconds, which cannot overflow or wrap in the wait.
+        const auto isTimedOut = active->timeout != 0 ? millis() - sentAtMillis >= active->timeout : micros() - sentAt >= timeout;
+        if (isTimedOut)
+        {
+            rtt.addTimeout();
+            complete(MODBUS_RTU_MASTER_RESPONSE_TIMEOUT);
+        }
+        return;
+    }
+
+    const auto error = validate(*response);
+    // The start is estimated from the frame length, so a sample outside the wait is a bad estimate, not a round trip.
+    const auto elapsed = static_cast<int32_t>(response->startedAt - sentAt);
+    const auto isPlausible = elapsed >= 0 && static_cast<uint32_t>(elapsed) <= timeout;
+    if (active->timeout == 0 && isPlausible && (error == MODBUS_RTU_MASTER_SUCCESS || error == MODBUS_RTU_MASTER_EXCEPTION_RESPONSE))
+    {
+        rtt.addSample(elapsed);
+    }
+    complete(error, response);
+}
+
+ModbusRTUMasterError AsyncModbusMaster::validate(RtuFrame& response) const
+{
+    auto& adu = response.adu;
+    if (response.length < 5)
+    {
+        return MODBUS_RTU_MASTER_FRAME_ERROR;
+    }
+    if (not adu.crcGood())
+    {
+        return MODBUS_RTU_MASTER_CRC_ERROR;
+    }
+    if (adu.getUnitId() != active->unitId)
+    {
+        return MODBUS_RTU_MASTER_UNEXPECTED_ID;
+    }
+    if ((adu.getFunctionCode() & 0x7F) != active->functionCode)
+    {
+        return MODBUS_RTU_MASTER_UNEXPECTED_FUNCTION_CODE;
+    }
+    if (adu.getFunctionCode() & 0x80)
+    {
+        return MODBUS_RTU_MASTER_EXCEPTION_RESPONSE;
+    }
+    return MODBUS_RTU_MASTER_SUCCESS;
+}
+
+void AsyncModbusMaster::complete(const ModbusRTUMasterError error, RtuFrame* response)
+{
+    auto& transaction = *active;
+    active = nullptr;
+    transaction.state = TRANSACTION_COMPLETE;
+    transaction.error = error;
+    statistics.record(error, micros() - sentAt);
+
+    if (transaction.callback != nullptr)
+    {
+        // Move out first, so the callback may safely submit follow-up transactions.
+        const auto callback = std::move(transaction.callback);
+        transaction.callback = nullptr;
+        // The response is read where it landed.  Without one, the callback gets the request back.
+        callback(response != nullptr ? response->adu : transaction.adu, error);
+        transaction.state = TRANSACTION_FREE;
+    }
+    else if (response != nullptr)
+    {
+        // Kept until released, so it has to leave the transport.
+        copyAdu(transaction.adu, response->adu);
+    }
+    if (response != nullptr)
+    {
+        transport.release();
+    }
+}
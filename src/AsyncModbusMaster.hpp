@@ -0,0 +1,165 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <ModbusADU.h>
+#include <ModbusRTUMaster.h>
+#include <array>
+#include <functional>
+
+#include "RtuTransport.hpp"
+#include "RttEstimator.hpp"
+#include "Statistics.hpp"
+
+///@brief Identifies a submitted transaction.  Never reused while the transaction is alive.
+using ModbusTransactionHandle = uint32_t;
+
+///@brief Returned when a transaction could not be submitted.
+constexpr ModbusTransactionHandle INVALID_TRANSACTION = 0;
+
+enum ModbusTransactionState : uint8_t
+{
+    ///@brief Handle is unknown, or has been released.
+    TRANSACTION_FREE = 0,
+    ///@brief Waiting for the bus.
+    TRANSACTION_QUEUED = 1,
+    ///@brief Request sent, waiting for the response.
+    TRANSACTION_IN_FLIGHT = 2,
+    ///@brief Response (or error) is available.
+    TRANSACTION_COMPLETE = 3
+};
+
+/**
+ * @brief Called once a transaction completes.
+ * @details `response` is only valid for the duration of the call.
+ *          Exception responses are delivered with `MODBUS_RTU_MASTER_EXCEPTION_RESPONSE`, and the response intact.
+ */
+using ModbusTransactionCallback = std::function<void(ModbusADU& response, ModbusRTUMasterError error)>;
+
+/**
+ * @brief Non-blocking Modbus RTU master.
+ * @details Requests are queued, and a state machine sends them one at a time as the bus frees up.
+ *          `update()` must be called regularly to move data on and off the wire.
+ *          The transport notifies the task which sent the request once the response arrives, so waiting tasks can sleep.
+ *          Response timeouts adapt to the measured round trip time.
+ *          <br/>
+ *          Completed transactions either run their callback and are released automatically,
+ *          or wait to be checked with `poll()` and released with `release()`.
+ * @warning Not thread safe.
+ */
+class AsyncModbusMaster
+{
+public:
+    static constexpr size_t MAX_TRANSACTIONS = 4;
+
+    explicit AsyncModbusMaster(RtuTransport& transport);
+    AsyncModbusMaster(const AsyncModbusMaster&) = delete;
+    AsyncModbusMaster(const AsyncModbusMaster&&) = delete;
+
+    /**
+     * @brief Round trip time statistics, which also set the response timeout.
+     * @details Time is measured from sending a request to the first byte of a valid response.
+     */
+    RttEstimator& getRttEstimator()
+    {
+        return rtt;
+    }
+
+    [[nodiscard]] const RttEstimator& getRttEstimator() const
+    {
+        return rtt;
+    }
+
+    ///@brief Counters and latency for every transaction this sends.
+    BusStatistics& getStatistics()
+    {
+        return statistics;
+    }
+
+    [[nodiscard]] const BusStatistics& getStatistics() const
+    {
+        return statistics;
+    }
+
+    /**
+     * @brief Queue a request.
+     * @param request Copied, so may be reused as soon as this returns.  CRC is calculated automatically.
+     * @param callback Optional.  Called from `update()` once the transaction completes.
+     * @param timeout Response timeout, in milliseconds.  0 uses the adaptive timeout.
+     *                Responses to requests with a fixed timeout are slow by design, so are left out of the round trip time.
+     * @return Transaction handle, or `INVALID_TRANSACTION` if too many transactions are outstanding.
+     */
+    ModbusTransactionHandle submit(ModbusADU& request, const ModbusTransactionCallback& callback = nullptr, uint32_t timeout = 0);
+
+    ///@brief Drive the state machine.  Never blocks.
+    void update();
+
+    /**
+     * @brief Check on a transaction without blocking.
+     * @details Also drives the state machine.
+     */
+    ModbusTransactionState poll(ModbusTransactionHandle handle);
+
+    ///@warning Only meaningful once `poll()` returns `TRANSACTION_COMPLETE`.
+    ModbusRTUMasterError getError(ModbusTransactionHandle handle) const;
+
+    /**
+     * @warning Only meaningful once `poll()` returns `TRANSACTION_COMPLETE`.
+     * @return The response, or nullptr if the handle is unknown.
+     */
+    ModbusADU* getResponse(ModbusTransactionHandle handle);
+
+    ///@brief Free a transaction's slot.  Cancels it if it has not been sent yet.
+    void release(ModbusTransactionHandle handle);
+
+    ///@return true if nothing is queued or in flight.
+    [[nodiscard]] bool isIdle() const;
+
+private:
+    struct Transaction
+    {
+        ModbusTransactionHandle handle = INVALID_TRANSACTION;
+        ModbusTransactionState state = TRANSACTION_FREE;
+        ModbusRTUMasterError error = MODBUS_RTU_MASTER_SUCCESS;
+        uint8_t unitId = 0;
+        uint8_t functionCode = 0;
+        ///@brief Fixed response timeout, in milliseconds.  0 if adaptive.
+        uint32_t timeout = 0;
+        ModbusTransactionCallback callback = nullptr;
+        ModbusADU adu;
+    };
+
+    RtuTransport& transport;
+    std::array<Transaction, MAX_TRANSACTIONS> transactions = {};
+    ModbusTransactionHandle nextHandle = 1;
+
+    ///@brief Transaction currently on the wire.
+    Transaction* active = nullptr;
+    ///@brief `micros()` when the active transaction was sent.
+    unsigned long sentAt = 0;
+    ///@brief `millis()` when the active transaction was sent, for fixed timeouts.
+    unsigned long sentAtMillis = 0;
+    ///@brief Adaptive time to wait for a response, in microseconds.
+    unsigned long timeout = 0;
+
+    RttEstimator rtt{10, 500};
+    BusStatistics statistics;
+
+    Transaction* find(ModbusTransactionHandle handle);
+    [[nodiscard]] const Transaction* find(ModbusTransactionHandle handle) const;
+    void start(Transaction& transaction);
+    void receive();
+
+    /**
+     * @brief Finish the active transaction.
+     * @param response Received frame, which the callback is given in place.  nullptr if there was none.
+     */
+    void complete(ModbusRTUMasterError error, RtuFrame* response = nullptr);
+
+    [[nodiscard]] ModbusRTUMasterError validate(RtuFrame& response) const;
+};
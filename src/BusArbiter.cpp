@@ -0,0 +1,47 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "BusArbiter.hpp"
+
+void BusArbiter::setReady(const TrafficClass trafficClass, const uint32_t since)
+{
+    ready[trafficClass] = true;
+    readySince[trafficClass] = since;
+}
+
+size_t BusArbiter::choose() const
+{
+    auto next = TRAFFIC_CLASSES;
+    uint32_t nextDeadline = 0;
+    for (size_t i = 0; i < TRAFFIC_CLASSES; i++)
+    {
+        if (not ready[i])
+        {
+            continue;
+        }
+        const auto deadline = readySince[i] + DEADLINES[i];
+        // Strictly earlier, so ties go to the more important class.  Signed, so it survives the clock wrapping.
+        if (next == TRAFFIC_CLASSES || static_cast<int32_t>(deadline - nextDeadline) < 0)
+        {
+            next = i;
+            nextDeadline = deadline;
+        }
+    }
+    return next;
+}
+
+void BusArbiter::start(const TrafficClass trafficClass, const uint32_t now)
+{
+    // Work can be spotted a little early, but never waits less than nothing.
+    const auto waited = static_cast<int32_t>(now - readySince[trafficClass]) > 0 ? now - readySince[trafficClass] : 0;
+    waitTime[trafficClass].add(waited);
+    if (waited > DEADLINES[trafficClass])
+    {
+        deadlineMisses[trafficClass].increment();
+    }
+    ready[trafficClass] = false;
+}
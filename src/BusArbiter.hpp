@@ -0,0 +1,100 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <array>
+
+#include "Statistics.hpp"
+
+///@brief Kinds of work competing for a motor bus, most important first.
+enum TrafficClass : uint8_t
+{
+    ///@brief Status polls, which feed the emergency stop.
+    SAFETY_TRAFFIC = 0,
+    ///@brief Frames forwarded from the host, which is waiting on the reply.
+    HOST_TRAFFIC = 1,
+    ///@brief Configuration, parameter access, and anything else nobody is timing.
+    CONFIG_TRAFFIC = 2
+};
+
+constexpr size_t TRAFFIC_CLASSES = 3;
+
+/**
+ * @brief Decides which class of work gets a motor bus next.
+ * @details Each class has a relative deadline.
+ *          Work is due its class' deadline after it became ready, and the earliest deadline goes first.
+ *          A burst of one class can not starve another, since waiting work eventually has the earliest deadline.
+ *          Ties go to the more important class.
+ *          <br/>
+ *          Only the oldest ready work of each class is tracked, since that is what runs next.
+ *          Wait times are measured from becoming ready to starting.
+ *          <br/>
+ *          All times are `micros()`.
+ * @warning Only the bus' owner may call non-const methods.  Statistics are safe to read from any task.
+ */
+class BusArbiter
+{
+public:
+    /**
+     * @brief Deadline of each class, in microseconds.
+     * @details Host frames are briefly ahead of a status poll which just became due, so they rarely pay for a poll's round trip.
+     *          A poll which has waited a millisecond goes ahead of them.
+     *          <br/>
+     *          Nothing is cut off mid transaction, so work can always wait for one already on the wire.
+     *          Status polls pause between their reads to keep that to a single round trip, which fits these at 460800 baud and up.
+     *          At slower rates, one round trip alone can take longer than the host deadline, so misses are expected.
+     */
+    static constexpr std::array<uint32_t, TRAFFIC_CLASSES> DEADLINES = {2000, 1000, 20000};
+
+    /**
+     * @brief Mark a class as having work ready.
+     * @param since When the work became ready.  Also updates work which was already ready.
+     */
+    void setReady(TrafficClass trafficClass, uint32_t since);
+
+    void clearReady(TrafficClass trafficClass)
+    {
+        ready[trafficClass] = false;
+    }
+
+    /**
+     * @brief Pick the ready class with the earliest deadline.
+     * @return The class, or `TRAFFIC_CLASSES` if nothing is ready.
+     */
+    [[nodiscard]] size_t choose() const;
+
+    /**
+     * @brief Record a class' work starting, and clear it.
+     * @param now When it started.
+     */
+    void start(TrafficClass trafficClass, uint32_t now);
+
+    [[nodiscard]] uint32_t getDeadline(const TrafficClass trafficClass) const
+    {
+        return DEADLINES[trafficClass];
+    }
+
+    ///@brief Time from becoming ready to starting.
+    [[nodiscard]] const LatencyHistogram& getWaitTime(const TrafficClass trafficClass) const
+    {
+        return waitTime[trafficClass];
+    }
+
+    ///@brief Work which started after its deadline.
+    [[nodiscard]] const Counter& getDeadlineMisses(const TrafficClass trafficClass) const
+    {
+        return deadlineMisses[trafficClass];
+    }
+
+private:
+    std::array<bool, TRAFFIC_CLASSES> ready = {};
+    std::array<uint32_t, TRAFFIC_CLASSES> readySince = {};
+
+    std::array<LatencyHistogram, TRAFFIC_CLASSES> waitTime;
+    std::array<Counter, TRAFFIC_CLASSES> deadlineMisses;
+};
@@ -0,0 +1,91 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief CiA 402 drive state machine, as seen through "Statusword" and "Controlword".
+ * @see CiA 402 Part 2, 8.1.1
+ */
+
+#pragma once
+#include <cstdint>
+
+enum Cia402State : uint8_t
+{
+    CIA402_NOT_READY_TO_SWITCH_ON = 0,
+    CIA402_SWITCH_ON_DISABLED = 1,
+    CIA402_READY_TO_SWITCH_ON = 2,
+    CIA402_SWITCHED_ON = 3,
+    CIA402_OPERATION_ENABLED = 4,
+    CIA402_QUICK_STOP_ACTIVE = 5,
+    CIA402_FAULT_REACTION_ACTIVE = 6,
+    CIA402_FAULT = 7
+};
+
+///@brief "Controlword" fault reset bit.  Acts on the rising edge.
+constexpr uint16_t CONTROLWORD_FAULT_RESET = 0x80;
+
+///@brief Which state a "Statusword" reports.
+constexpr Cia402State decodeCia402State(const uint16_t statusword)
+{
+    switch (statusword & 0x4F)
+    {
+    case 0x00:
+        return CIA402_NOT_READY_TO_SWITCH_ON;
+    case 0x40:
+        return CIA402_SWITCH_ON_DISABLED;
+    case 0x0F:
+        return CIA402_FAULT_REACTION_ACTIVE;
+    case 0x08:
+        return CIA402_FAULT;
+    default:
+        break;
+    }
+    switch (statusword & 0x6F)
+    {
+    case 0x21:
+        return CIA402_READY_TO_SWITCH_ON;
+    case 0x23:
+        return CIA402_SWITCHED_ON;
+    case 0x27:
+        return CIA402_OPERATION_ENABLED;
+    case 0x07:
+        return CIA402_QUICK_STOP_ACTIVE;
+    default:
+        // Not a valid combination.  Treat it like a drive still starting up.
+        return CIA402_NOT_READY_TO_SWITCH_ON;
+    }
+}
+
+/**
+ * @brief Find the "Controlword" which moves a drive one transition closer to Operation Enabled.
+ * @details Ready to Switch On goes straight to Operation Enabled, as the standard allows.
+ * @param state Current state.
+ * @param controlword In: the drive's current "Controlword", for the fault reset edge.  Out: the command to send.
+ * @return false if there is nothing to send.  Either the drive is already there, or it changes state on its own.
+ */
+constexpr bool nextEnableControlword(const Cia402State state, uint16_t& controlword)
+{
+    switch (state)
+    {
+    case CIA402_FAULT:
+        // A reset needs a rising edge, so drop the bit first if it is still set.
+        controlword = controlword & CONTROLWORD_FAULT_RESET ? 0x06 : CONTROLWORD_FAULT_RESET;
+        return true;
+    case CIA402_SWITCH_ON_DISABLED:
+        // Shutdown.
+        controlword = 0x06;
+        return true;
+    case CIA402_READY_TO_SWITCH_ON:
+    case CIA402_SWITCHED_ON:
+    case CIA402_QUICK_STOP_ACTIVE:
+        // Enable operation.
+        controlword = 0x0F;
+        return true;
+    case CIA402_NOT_READY_TO_SWITCH_ON:
+    case CIA402_FAULT_REACTION_ACTIVE:
+    case CIA402_OPERATION_ENABLED:
+        break;
+    }
+    return false;
+}
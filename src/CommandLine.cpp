@@ -0,0 +1,147 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "CommandLine.hpp"
+#include <climits>
+
+namespace
+{
+    constexpr bool isSpace(const char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    constexpr bool isSeparator(const char c)
+    {
+        return c == ':' || c == ',' || isSpace(c);
+    }
+
+    constexpr bool isDigit(const char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    ///@return `text` without leading separators.
+    std::string_view skipSeparators(std::string_view text)
+    {
+        while (not text.empty() && isSeparator(text.front()))
+        {
+            text.remove_prefix(1);
+        }
+        return text;
+    }
+}
+
+bool CommandLine::add(const char c)
+{
+    if (complete)
+    {
+        clear();
+    }
+    if (c == '\n')
+    {
+        complete = true;
+        return true;
+    }
+    if (length < buffer.size())
+    {
+        buffer[length++] = c;
+    }
+    else
+    {
+        overflowed = true;
+    }
+    return false;
+}
+
+std::string_view CommandLine::get() const
+{
+    if (overflowed)
+    {
+        return {};
+    }
+    auto line = std::string_view(buffer.data(), length);
+    while (not line.empty() && isSpace(line.front()))
+    {
+        line.remove_prefix(1);
+    }
+    while (not line.empty() && isSpace(line.back()))
+    {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+CommandArgs::CommandArgs(const std::string_view line)
+{
+    size_t end = 0;
+    while (end < line.size() && not isSeparator(line[end]) && not isDigit(line[end]))
+    {
+        end++;
+    }
+    name = line.substr(0, end);
+    rest = line.substr(end);
+}
+
+bool CommandArgs::empty() const
+{
+    return skipSeparators(rest).empty();
+}
+
+std::string_view CommandArgs::next()
+{
+    rest = skipSeparators(rest);
+    size_t end = 0;
+    while (end < rest.size() && not isSeparator(rest[end]))
+    {
+        end++;
+    }
+    const auto argument = rest.substr(0, end);
+    rest.remove_prefix(end);
+    return argument;
+}
+
+bool CommandArgs::next(long& value)
+{
+    return parseInteger(next(), value);
+}
+
+bool parseInteger(const std::string_view text, long& value)
+{
+    size_t i = 0;
+    const auto negative = not text.empty() && text[0] == '-';
+    if (negative || (not text.empty() && text[0] == '+'))
+    {
+        i++;
+    }
+    if (i == text.size())
+    {
+        return false;
+    }
+
+    // Accumulate as a negative number, so LONG_MIN fits.
+    long result = 0;
+    for (; i < text.size(); i++)
+    {
+        if (not isDigit(text[i]))
+        {
+            return false;
+        }
+        const auto digit = text[i] - '0';
+        if (result < (LONG_MIN + digit) / 10)
+        {
+            return false;
+        }
+        result = result * 10 - digit;
+    }
+    if (not negative && result == LONG_MIN)
+    {
+        return false;
+    }
+    value = negative ? result : -result;
+    return true;
+}
@@ -0,0 +1,147 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief ASCII command parsing, without touching the heap.
+ * @details Lines are collected in a fixed buffer, and split up in place.
+ *          Commands are looked up in a sorted `constexpr` table, checked at compile time.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief Collects characters into newline terminated lines.
+ * @details Lines longer than `CAPACITY` are thrown away whole, rather than run cut short.
+ */
+class CommandLine
+{
+public:
+    static constexpr size_t CAPACITY = 128;
+
+    /**
+     * @brief Add a character.
+     * @return true if it completed a line.  The line is available from `get()` until the next call.
+     */
+    bool add(char c);
+
+    ///@return The completed line, without surrounding whitespace.  Empty if it was too long.
+    [[nodiscard]] std::string_view get() const;
+
+    ///@return true if the completed line was too long, and thrown away.
+    [[nodiscard]] bool isOverflowed() const
+    {
+        return overflowed;
+    }
+
+    ///@brief Throw away anything collected so far.
+    void clear()
+    {
+        length = 0;
+        overflowed = false;
+        complete = false;
+    }
+
+private:
+    std::array<char, CAPACITY> buffer = {};
+    size_t length = 0;
+    bool overflowed = false;
+    bool complete = false;
+};
+
+/**
+ * @brief A command line, split into a name and its arguments.
+ * @details The name runs up to the first separator or digit, so "STREAM:200", "##1,3", and "GET X name" all work.
+ *          Arguments are separated by any mix of ':', ',', and whitespace.
+ *          Views point into the original line.
+ */
+class CommandArgs
+{
+public:
+    explicit CommandArgs(std::string_view line);
+
+    [[nodiscard]] std::string_view getName() const
+    {
+        return name;
+    }
+
+    ///@return true if there are no arguments left.
+    [[nodiscard]] bool empty() const;
+
+    ///@return The next argument, or an empty view if there are none left.
+    std::string_view next();
+
+    /**
+     * @brief Parse the next argument as a decimal integer.
+     * @param value Unchanged unless it returns true.
+     * @return false if there are none left, or it is not an integer.
+     */
+    bool next(long& value);
+
+    /**
+     * @brief Parse the next argument as a decimal integer, and clamp it.
+     * @return false if there are none left, or it is not an integer.
+     */
+    template <typename T>
+    bool next(T& value, const long lowest, const long highest)
+    {
+        long parsed = 0;
+        if (not next(parsed))
+        {
+            return false;
+        }
+        value = static_cast<T>(std::clamp(parsed, lowest, highest));
+        return true;
+    }
+
+private:
+    std::string_view name;
+    std::string_view rest;
+};
+
+///@brief An ASCII command.
+struct CommandEntry
+{
+    std::string_view name;
+    void (*handler)(CommandArgs& args);
+};
+
+///@return true if every command is in order, and no two share a name.
+template <size_t N>
+constexpr bool isSorted(const std::array<CommandEntry, N>& commands)
+{
+    for (size_t i = 1; i < N; i++)
+    {
+        if (not (commands[i - 1].name < commands[i].name))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Binary search a command table.
+ * @param commands Must be sorted.  Check with `static_assert(isSorted(commands))`.
+ * @return The command, or nullptr if there is none by that name.
+ */
+template <size_t N>
+const CommandEntry* findCommand(const std::array<CommandEntry, N>& commands, const std::string_view name)
+{
+    const auto found = std::lower_bound(commands.begin(), commands.end(), name, [](const CommandEntry& command, const std::string_view name)
+    {
+        return command.name < name;
+    });
+    return found != commands.end() && found->name == name ? found : nullptr;
+}
+
+/**
+ * @brief Parse a whole string as a decimal integer, with an optional sign.
+ * @return false if it is empty, has anything else in it, or does not fit.
+ */
+bool parseInteger(std::string_view text, long& value);
@@ -0,0 +1,80 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "ConfigTransaction.hpp"
+
+bool ConfigTransaction::stage(const uint16_t address, const uint16_t length, const uint16_t* registers)
+{
+    if (length == 0 || length > 2)
+    {
+        return false;
+    }
+
+    size_t index = 0;
+    while (index < count && entries[index].address < address)
+    {
+        index++;
+    }
+    const auto replace = index < count && entries[index].address == address;
+    if (not replace)
+    {
+        if (count == CAPACITY)
+        {
+            return false;
+        }
+        for (auto i = count; i > index; i--)
+        {
+            entries[i] = entries[i - 1];
+        }
+        count++;
+    }
+
+    auto& entry = entries[index];
+    entry.address = address;
+    entry.length = length;
+    for (uint16_t i = 0; i < length; i++)
+    {
+        entry.registers[i] = registers[i];
+    }
+    return true;
+}
+
+size_t ConfigTransaction::plan(RegisterSpan* writes) const
+{
+    size_t planned = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto& entry = entries[i];
+        if (planned > 0)
+        {
+            auto& last = writes[planned - 1];
+            if (last.end() == entry.address && last.length + entry.length <= MAX_WRITE_REGISTERS)
+            {
+                last.length += entry.length;
+                continue;
+            }
+        }
+        writes[planned++] = {entry.address, entry.length};
+    }
+    return planned;
+}
+
+void ConfigTransaction::getRegisters(const RegisterSpan& write, uint16_t* registers) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto& entry = entries[i];
+        if (entry.address < write.address || entry.address + entry.length > write.end())
+        {
+            continue;
+        }
+        for (uint16_t j = 0; j < entry.length; j++)
+        {
+            registers[entry.address - write.address + j] = entry.registers[j];
+        }
+    }
+}
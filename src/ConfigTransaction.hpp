@@ -0,0 +1,100 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ReadPlanner.hpp"
+
+/**
+ * @brief Most registers in one "Write Multiple Registers" (0x10) request.
+ * @see Modbus Specification V1.1b3 P.30
+ */
+constexpr uint16_t MAX_WRITE_REGISTERS = 123;
+
+/**
+ * @brief A set of configuration writes, applied to a drive all at once.
+ * @details Stage any number of writes, then pass this to `LinearMotor::commit()`.
+ *          The drive is disabled once, contiguous registers are written together,
+ *          and flash is persisted once before re-enabling.
+ */
+class ConfigTransaction
+{
+public:
+    static constexpr size_t CAPACITY = 16;
+
+    ///@brief One staged register write.
+    struct Entry
+    {
+        uint16_t address = 0;
+        uint8_t length = 0;
+        std::array<uint16_t, 2> registers = {};
+    };
+
+    /**
+     * @brief Stage a write.  Replaces any earlier write to the same register.
+     * @tparam R Read write register from `MotionGRegisters.hpp`, like `MotionG::Inertia`.
+     * @return false if the transaction is full.
+     */
+    template <typename R>
+    bool stage(const typename R::type value)
+    {
+        static_assert(R::writable, "Register is read only");
+        std::array<uint16_t, R::length> raw = {};
+        R::encode(value, raw.data());
+        return stage(R::address, R::length, raw.data());
+    }
+
+    /**
+     * @brief Stage a write of raw registers.
+     * @param address First register.
+     * @param length Number of registers.  At most 2.
+     * @param registers Raw values.
+     * @return false if the transaction is full, or the write is too long.
+     */
+    bool stage(uint16_t address, uint16_t length, const uint16_t* registers);
+
+    [[nodiscard]] bool empty() const
+    {
+        return count == 0;
+    }
+
+    void clear()
+    {
+        count = 0;
+    }
+
+    /**
+     * @brief Group staged writes into runs of consecutive registers.
+     * @param writes Receives up to `CAPACITY` runs.
+     * @return Number of runs.
+     */
+    size_t plan(RegisterSpan* writes) const;
+
+    /**
+     * @brief Copy the raw values for a run returned by `plan()`.
+     * @param registers Receives `write.length` values.
+     */
+    void getRegisters(const RegisterSpan& write, uint16_t* registers) const;
+
+    ///@brief Staged writes, sorted by address.
+    [[nodiscard]] const Entry* begin() const
+    {
+        return entries.data();
+    }
+
+    [[nodiscard]] const Entry* end() const
+    {
+        return entries.data() + count;
+    }
+
+private:
+    std::array<Entry, CAPACITY> entries = {};
+    size_t count = 0;
+};
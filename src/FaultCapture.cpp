@@ -0,0 +1,63 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "FaultCapture.hpp"
+
+void FaultCapture::add(const LinearMotorStatus& status)
+{
+    // Tracked even while done, so a rearmed capture only triggers on a new fault.
+    const auto isError = status.isError();
+    const auto isTrigger = isError && not wasError;
+    wasError = isError;
+
+    auto current = state.load(std::memory_order_acquire);
+    if (current == CAPTURE_DONE)
+    {
+        return;
+    }
+
+    auto& sample = samples[added % SAMPLES];
+    sample.time = status.timestamp;
+    sample.followingError = status.followingError;
+    sample.velocity = status.velocity;
+    sample.dcLinkVoltage = status.dcLinkVoltage;
+    sample.current = status.current;
+    sample.errorCode = status.errorCode;
+    sample.fields = status.fields;
+    sample.modbusError = status.modbusError;
+    added++;
+
+    if (current == CAPTURE_ARMED)
+    {
+        if (not isTrigger)
+        {
+            return;
+        }
+        window = postTrigger.load(std::memory_order_relaxed);
+        afterTrigger = 0;
+        current = CAPTURE_TRIGGERED;
+    }
+    else
+    {
+        afterTrigger++;
+    }
+    // Published last, so the client sees every sample once it sees done.
+    state.store(afterTrigger >= window ? CAPTURE_DONE : current, std::memory_order_release);
+}
+
+bool FaultCapture::rearm()
+{
+    if (state.load(std::memory_order_acquire) != CAPTURE_DONE)
+    {
+        return false;
+    }
+    // The adding task leaves everything but the state alone until it is armed again.
+    added = 0;
+    afterTrigger = 0;
+    state.store(CAPTURE_ARMED, std::memory_order_release);
+    return true;
+}
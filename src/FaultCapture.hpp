@@ -0,0 +1,138 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "LinearMotor.hpp"
+
+///@brief Status fields each capture sample needs.
+constexpr uint16_t CAPTURE_STATUS_FIELDS = STATUS_ERROR_CODE | STATUS_VELOCITY | STATUS_CURRENT | STATUS_DC_LINK_VOLTAGE | STATUS_FOLLOWING_ERROR;
+
+enum CaptureState : uint8_t
+{
+    ///@brief Keeping the latest samples, waiting for an error.
+    CAPTURE_ARMED = 0,
+    ///@brief Recording the samples after an error.
+    CAPTURE_TRIGGERED = 1,
+    ///@brief Finished, and kept until rearmed.
+    CAPTURE_DONE = 2
+};
+
+/**
+ * @brief One polled status, as captured.
+ * @details Also the downloaded form, as-is.  Little endian, with no padding.
+ */
+struct CaptureSample
+{
+    ///@brief `micros()` when the status was read.
+    uint32_t time = 0;
+    ///@brief "Following_error_actual_value" register (INTEGER32)
+    int32_t followingError = 0;
+    ///@brief "Velocity_actual_value" register (INTEGER32)
+    int32_t velocity = 0;
+    ///@brief "DC_link_circuit_voltage" register (UNS32)
+    uint32_t dcLinkVoltage = 0;
+    ///@brief "Current_actual_value" register (INTEGER16)
+    int16_t current = 0;
+    ///@brief "Error_code" register (UNS16)
+    uint16_t errorCode = 0;
+    ///@brief Which values were read.  `LinearMotorStatusField` flags.
+    uint16_t fields = 0;
+    ///@brief `ModbusRTUMasterError` of the poll.
+    uint16_t modbusError = 0;
+};
+static_assert(sizeof(CaptureSample) == 24, "Downloaded samples have a fixed layout");
+
+/**
+ * @brief Keeps one drive's signals from around its latest fault.
+ * @details Every polled status goes into a ring, so the time before a fault is always at hand.
+ *          When `LinearMotorStatus::isError()` goes from clear to set, the post-trigger window is recorded, then the capture stops.
+ *          It is kept, and later faults ignored, until `rearm()`.
+ *          <br/>
+ *          Samples come from the worker's sample polls, which follow each status poll whenever the bus is otherwise idle.
+ *          So anything which slows polls, or keeps the bus busy, lowers the resolution.
+ *          A drive which was never seen without an error does not trigger, so one which powers up faulted does not fill the capture.
+ *          <br/>
+ *          One task adds samples, and one client reads them.  Only the state is shared, so neither waits on the other.
+ */
+class FaultCapture
+{
+public:
+    static constexpr size_t SAMPLES = 512;
+    static constexpr uint16_t DEFAULT_POST_TRIGGER = 128;
+
+    /**
+     * @brief Add a polled status.  Never blocks.
+     * @details Only one task may add.  Ignored once the capture is done.
+     */
+    void add(const LinearMotorStatus& status);
+
+    /**
+     * @brief Set how many samples to keep after the trigger.  The rest of the ring holds the time before.
+     * @details Takes effect from the next trigger.
+     */
+    void setPostTrigger(const size_t samples)
+    {
+        postTrigger = static_cast<uint16_t>(std::min(samples, SAMPLES - 1));
+    }
+
+    [[nodiscard]] uint16_t getPostTrigger() const
+    {
+        return postTrigger.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] CaptureState getState() const
+    {
+        return state.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Forget a finished capture, and wait for the next fault.  Client only.
+     * @return false if the capture is not done.
+     */
+    bool rearm();
+
+    ///@brief Samples held.  Only valid once done.
+    [[nodiscard]] size_t getCount() const
+    {
+        return std::min(added, SAMPLES);
+    }
+
+    ///@brief Index of the first sample with an error.  Only valid once done.
+    [[nodiscard]] size_t getTriggerIndex() const
+    {
+        return getCount() - 1 - afterTrigger;
+    }
+
+    /**
+     * @brief Get a sample, oldest first.  Only valid once done.
+     * @param index Below `getCount()`.
+     */
+    [[nodiscard]] const CaptureSample& getSample(const size_t index) const
+    {
+        return samples[(added - getCount() + index) % SAMPLES];
+    }
+
+private:
+    std::array<CaptureSample, SAMPLES> samples = {};
+    ///@brief Samples added since armed.  The newest is at `(added - 1) % SAMPLES`.
+    size_t added = 0;
+    ///@brief Samples added after the trigger.
+    uint16_t afterTrigger = 0;
+    ///@brief Post-trigger window of the capture in progress.
+    uint16_t window = 0;
+    ///@brief Adding task only.  Starts set, so a clear status must come first.
+    bool wasError = true;
+
+    std::atomic<CaptureState> state{CAPTURE_ARMED};
+    std::atomic<uint16_t> postTrigger{DEFAULT_POST_TRIGGER};
+};
@@ -0,0 +1,138 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "FaultSupervisor.hpp"
+
+FaultSupervisor::FaultSupervisor(const uint8_t pin):
+    pin{pin}
+{
+}
+
+void FaultSupervisor::begin(const BaseType_t core, const UBaseType_t priority)
+{
+    pinMode(pin, OUTPUT);
+    digitalWrite(pin, HIGH);
+    xTaskCreatePinnedToCore(_task, "FaultSupervisor", 2048, this, priority, &task, core);
+}
+
+void FaultSupervisor::report(const size_t axis, const LinearMotorStatus& status)
+{
+    if (axis >= MAX_AXES)
+    {
+        return;
+    }
+    // Taken here, so latency covers everything after the read, whatever the status' own timestamp means.
+    latest[axis].write({status, static_cast<uint32_t>(micros())});
+    if (task != nullptr)
+    {
+        xTaskNotifyGive(task);
+    }
+}
+
+void FaultSupervisor::setEnabled(const bool enabled)
+{
+    if (this->enabled.exchange(enabled) != enabled && task != nullptr)
+    {
+        xTaskNotifyGive(task);
+    }
+}
+
+void FaultSupervisor::_task(void* supervisorPtr)
+{
+    static_cast<FaultSupervisor*>(supervisorPtr)->run();
+}
+
+void FaultSupervisor::run()
+{
+    auto report = Report();
+    std::array<uint32_t, MAX_AXES> reportedAt = {};
+    auto wasEnabled = false;
+    TickType_t wait = portMAX_DELAY;
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, wait);
+
+        const auto now = xTaskGetTickCount();
+        const auto isEnabled = enabled.load();
+        // Nothing is polled while disabled, so every axis gets a fresh start.
+        if (isEnabled && not wasEnabled)
+        {
+            lastReportAt.fill(now);
+        }
+        wasEnabled = isEnabled;
+
+        const auto timeout = staleTimeout.load(std::memory_order_relaxed);
+        const auto watchedAxes = watched.load(std::memory_order_relaxed);
+        std::array<bool, MAX_AXES> fresh = {};
+        auto isError = false;
+        wait = portMAX_DELAY;
+        for (size_t axis = 0; axis < MAX_AXES; axis++)
+        {
+            if (latest[axis].read(report))
+            {
+                fresh[axis] = true;
+                reportedAt[axis] = report.reportedAt;
+                axisErrors[axis] = report.status.isError();
+                lastReportAt[axis] = now;
+            }
+            // Ticks, not microseconds, so a long silence can not wrap back around to looking recent.
+            const auto age = now - lastReportAt[axis];
+            const auto isStale = isEnabled && (watchedAxes & 1 << axis) != 0 && age > timeout;
+            if (isStale && not axisStale[axis])
+            {
+                staleAxes.increment();
+            }
+            axisStale[axis] = isStale;
+            if (isEnabled && (watchedAxes & 1 << axis) != 0 && not isStale)
+            {
+                // Wake once it would go stale, even if nothing else happens.
+                wait = std::min<TickType_t>(wait, timeout - age + 1);
+            }
+            isError |= axisErrors[axis] || isStale;
+        }
+
+        if (not isEnabled)
+        {
+            continue;
+        }
+        setErrorState(isError);
+
+        // Measured once the pin is written, so the histogram covers the whole path.
+        const auto written = static_cast<uint32_t>(micros());
+        for (size_t axis = 0; axis < MAX_AXES; axis++)
+        {
+            if (not fresh[axis])
+            {
+                continue;
+            }
+            const auto elapsed = written - reportedAt[axis];
+            latency.add(elapsed);
+            if (elapsed > deadline.load(std::memory_order_relaxed))
+            {
+                deadlineMisses.increment();
+            }
+        }
+    }
+}
+
+void FaultSupervisor::setErrorState(const bool isError)
+{
+    if (tripped.load(std::memory_order_relaxed) == isError)
+    {
+        return;
+    }
+    digitalWrite(pin, !isError);
+    tripped.store(isError, std::memory_order_relaxed);
+    if (isError)
+    {
+        trips.increment();
+        if (tripListener)
+        {
+            tripListener();
+        }
+    }
+}
@@ -0,0 +1,175 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+
+#include "LinearMotor.hpp"
+#include "SpscQueue.hpp"
+#include "Statistics.hpp"
+
+/**
+ * @brief High priority FreeRTOS task which owns the emergency stop pin.
+ * @details Motor workers hand every polled "Error_code" straight to the supervisor, which wakes and updates the pin.
+ *          Nothing waits on `loop()`, blocking commands, or host traffic, so a fault reaches the pin within microseconds of being read.
+ *          <br/>
+ *          Detection latency is measured from the report, made as soon as the poll's "Error_code" read completes, to the pin being written.
+ *          Anything slower than the deadline is counted as a miss.
+ *          <br/>
+ *          Silence is treated as a fault too.
+ *          A watched axis with no report for longer than the stale timeout trips the pin, whether its worker is stuck, hung, or starved.
+ *          <br/>
+ *          Each axis passes its status through its own lock-free slot, so only one task may report each axis.
+ * @warning Once `begin()` is called, nothing else may write the pin.
+ */
+class FaultSupervisor
+{
+public:
+    ///@brief Most drives watched, across every bus.
+    static constexpr size_t MAX_AXES = 8;
+
+    ///@brief Default detection to pin deadline, in microseconds.
+    static constexpr uint32_t DEFAULT_DEADLINE = 1000;
+
+    ///@brief Default longest a watched axis may go without a report, in milliseconds.
+    static constexpr uint32_t DEFAULT_STALE_TIMEOUT = 100;
+
+    ///@param pin Driven low while any axis has an error.
+    explicit FaultSupervisor(uint8_t pin);
+    FaultSupervisor(const FaultSupervisor&) = delete;
+    FaultSupervisor(const FaultSupervisor&&) = delete;
+
+    /**
+     * @brief Clear the pin, and start the supervisor task.
+     * @param core Core to pin the task to.  Sharing a core with the motor workers lets it preempt them the moment they report.
+     * @param priority FreeRTOS task priority.  Should be above every other application task.
+     */
+    void begin(BaseType_t core, UBaseType_t priority);
+
+    /**
+     * @brief Hand over a newly polled status.  Never blocks.
+     * @details Only one task may report each axis.
+     */
+    void report(size_t axis, const LinearMotorStatus& status);
+
+    /**
+     * @brief Trip if this axis stops reporting.
+     * @details Each axis' clock starts from when the supervisor is enabled, so polls have time to start.
+     */
+    void watch(const size_t axis)
+    {
+        if (axis < MAX_AXES)
+        {
+            watched.fetch_or(1 << axis);
+        }
+    }
+
+    /**
+     * @brief Enable or disable driving the pin.
+     * @details While disabled, reports are still tracked, but the pin is left as-is.
+     *          Enabling applies the latest known state immediately.
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @brief Called from the supervisor task each time the pin goes from clear to error, right after it is written.
+     * @details Must not block.  Set before calling `begin()`.
+     */
+    void setTripListener(const std::function<void()>& listener)
+    {
+        tripListener = listener;
+    }
+
+    ///@brief Set the detection to pin deadline, in microseconds.
+    void setDeadline(const uint32_t micros)
+    {
+        deadline = std::max<uint32_t>(micros, 1);
+    }
+
+    [[nodiscard]] uint32_t getDeadline() const
+    {
+        return deadline.load(std::memory_order_relaxed);
+    }
+
+    ///@brief Set how long a watched axis may go without a report, in milliseconds.
+    void setStaleTimeout(const uint32_t milliseconds)
+    {
+        staleTimeout = std::max<TickType_t>(pdMS_TO_TICKS(milliseconds), 1);
+    }
+
+    ///@return true if the pin is signalling an error.
+    [[nodiscard]] bool isTripped() const
+    {
+        return tripped.load(std::memory_order_relaxed);
+    }
+
+    ///@brief Time from reading a status to the pin reflecting it.
+    [[nodiscard]] const LatencyHistogram& getLatency() const
+    {
+        return latency;
+    }
+
+    ///@brief Statuses which took longer than the deadline to reach the pin.
+    [[nodiscard]] const Counter& getDeadlineMisses() const
+    {
+        return deadlineMisses;
+    }
+
+    ///@brief Times the pin went from clear to error.
+    [[nodiscard]] const Counter& getTrips() const
+    {
+        return trips;
+    }
+
+    ///@brief Times a watched axis went without a report for longer than the stale timeout.
+    [[nodiscard]] const Counter& getStaleAxes() const
+    {
+        return staleAxes;
+    }
+
+private:
+    const uint8_t pin;
+    TaskHandle_t task = nullptr;
+    std::atomic<bool> enabled{false};
+    std::atomic<bool> tripped{false};
+    std::atomic<uint32_t> deadline{DEFAULT_DEADLINE};
+    std::atomic<TickType_t> staleTimeout{pdMS_TO_TICKS(DEFAULT_STALE_TIMEOUT)};
+    ///@brief Axes which trip when they stop reporting.  One bit per axis.
+    std::atomic<uint8_t> watched{0};
+    static_assert(MAX_AXES <= 8, "One bit per axis");
+
+    ///@brief A reported status, and `micros()` when it was handed over.
+    struct Report
+    {
+        LinearMotorStatus status;
+        uint32_t reportedAt = 0;
+    };
+    std::array<SpscLatest<Report>, MAX_AXES> latest;
+    std::function<void()> tripListener;
+
+    ///@brief Supervisor task only.
+    std::array<bool, MAX_AXES> axisErrors = {};
+    ///@brief Supervisor task only.  When each axis last reported.
+    std::array<TickType_t, MAX_AXES> lastReportAt = {};
+    ///@brief Supervisor task only.
+    std::array<bool, MAX_AXES> axisStale = {};
+
+    LatencyHistogram latency;
+    Counter deadlineMisses;
+    Counter trips;
+    Counter staleAxes;
+
+    static void _task(void* supervisorPtr);
+    [[noreturn]] void run();
+
+    ///@brief Drive the pin.  Supervisor task only.
+    void setErrorState(bool isError);
+};
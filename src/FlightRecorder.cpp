@@ -0,0 +1,143 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "FlightRecorder.hpp"
+
+#include <algorithm>
+
+void FlightRecorder::record(const uint8_t channel, const FlightDirection direction, const uint32_t time,
+                            const uint8_t* frame, const uint16_t length)
+{
+    if (channel >= CHANNELS)
+    {
+        return;
+    }
+    // Announced before checking, so `clear()` either sees this writer, or this writer sees it pause.
+    writers.fetch_add(1);
+    if (paused.load())
+    {
+        writers.fetch_sub(1, std::memory_order_release);
+        return;
+    }
+    auto& ring = channels[channel];
+    const auto isRead = length >= 3 && (frame[1] == 0x03 || frame[1] == 0x04);
+    const auto waited = ring.waiting.exchange(false, std::memory_order_acquire);
+    if (waited && direction == ring.heldDirection.load(std::memory_order_relaxed))
+    {
+        // Another request, so the held back one got no reply.  Kept even once frozen, as it may be why.
+        append(ring, channel, direction, ring.heldAt, ring.held.data(), ring.held.size());
+    }
+    else if (waited && isRead && length == 5 + frame[2])
+    {
+        ring.skipped.fetch_add(1, std::memory_order_relaxed);
+        writers.fetch_sub(1, std::memory_order_release);
+        return;
+    }
+    if (frozen.load())
+    {
+        writers.fetch_sub(1, std::memory_order_release);
+        return;
+    }
+
+    // Replies to reads always have an odd length, so only a request fits.
+    if (isRead && length == ring.held.size() && isRoutine(ring, time, frame))
+    {
+        std::copy_n(frame, length, ring.held.begin());
+        ring.heldAt = time;
+        ring.heldDirection.store(direction, std::memory_order_relaxed);
+        ring.waiting.store(true, std::memory_order_release);
+    }
+    else
+    {
+        append(ring, channel, direction, time, frame, length);
+    }
+    writers.fetch_sub(1, std::memory_order_release);
+}
+
+void FlightRecorder::append(Channel& ring, const uint8_t channel, const FlightDirection direction, const uint32_t time,
+                            const uint8_t* frame, const uint16_t length)
+{
+    const auto index = ring.next.fetch_add(1, std::memory_order_relaxed);
+    auto& slot = ring.slots[index % RECORDS];
+
+    // Marked first, so a reader never mistakes a half written record for the old one.
+    slot.stamp.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    auto& record = slot.record;
+    record.time = time;
+    record.sequence = sequence.fetch_add(1, std::memory_order_relaxed);
+    record.length = length;
+    record.skipped = static_cast<uint16_t>(std::min<uint32_t>(ring.skipped.exchange(0, std::memory_order_relaxed), UINT16_MAX));
+    record.channel = channel;
+    record.direction = direction;
+    std::copy_n(frame, std::min<size_t>(length, FlightRecord::DATA_SIZE), record.data.begin());
+
+    slot.stamp.store(index + 1, std::memory_order_release);
+}
+
+bool FlightRecorder::isRoutine(Channel& ring, const uint32_t time, const uint8_t* frame)
+{
+    // Counts never exceed 125, so fit in 7 bits.
+    const auto key = static_cast<uint32_t>(frame[0]) << 24 | static_cast<uint32_t>(frame[1] & 0x01) << 23
+        | static_cast<uint32_t>(frame[2]) << 15 | static_cast<uint32_t>(frame[3]) << 7 | (frame[5] & 0x7F);
+    auto& poll = ring.polls[(key * 2654435761u >> 16) % POLLS];
+    if (poll.key == key && time - poll.keptAt < POLL_INTERVAL)
+    {
+        return true;
+    }
+    poll.key = key;
+    poll.keptAt = time;
+    return false;
+}
+
+void FlightRecorder::resume()
+{
+    // A reply dropped meanwhile must not make its held back request look unanswered.
+    for (auto& ring : channels)
+    {
+        ring.waiting.store(false, std::memory_order_relaxed);
+    }
+    paused = false;
+}
+
+void FlightRecorder::clear()
+{
+    paused = true;
+    // Writers only take a few hundred nanoseconds.
+    while (writers.load(std::memory_order_acquire) != 0)
+    {
+    }
+    for (auto& ring : channels)
+    {
+        for (auto& slot : ring.slots)
+        {
+            slot.stamp.store(0, std::memory_order_relaxed);
+        }
+        ring.next.store(0, std::memory_order_relaxed);
+        ring.polls = {};
+        ring.waiting.store(false, std::memory_order_relaxed);
+        ring.skipped.store(0, std::memory_order_relaxed);
+    }
+    sequence.store(0, std::memory_order_relaxed);
+    frozen = false;
+    paused = false;
+}
+
+bool FlightRecorder::read(const uint8_t channel, const uint32_t index, FlightRecord& record) const
+{
+    const auto& slot = channels[channel].slots[index % RECORDS];
+    const auto stamp = slot.stamp.load(std::memory_order_acquire);
+    if (stamp != index + 1)
+    {
+        return false;
+    }
+    record = slot.record;
+    // Rewritten while copying, if the stamp moved.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.stamp.load(std::memory_order_relaxed) == stamp;
+}
@@ -0,0 +1,180 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+enum FlightDirection : uint8_t
+{
+    FLIGHT_SENT = 0,
+    FLIGHT_RECEIVED = 1
+};
+
+/**
+ * @brief One recorded frame.
+ * @details Also the downloaded form, as-is.  Little endian, with no padding.
+ */
+struct FlightRecord
+{
+    ///@brief `micros()` when the frame started.
+    uint32_t time = 0;
+    ///@brief Counts every frame recorded, on every channel, so records can be put back in order.
+    uint32_t sequence = 0;
+    ///@brief Whole frame length, including the CRC.  Only the first `DATA_SIZE` bytes are kept.
+    uint16_t length = 0;
+    ///@brief Routine polls left out on this channel since the record before.
+    uint16_t skipped = 0;
+    ///@brief Which port, as passed to `RtuTransport::setRecorder()`.
+    uint8_t channel = 0;
+    FlightDirection direction = FLIGHT_SENT;
+
+    static constexpr size_t DATA_SIZE = 34;
+    ///@brief Start of the frame.  Enough for the header, and the first 15 registers of a reply.
+    std::array<uint8_t, DATA_SIZE> data = {};
+};
+static_assert(sizeof(FlightRecord) == 48, "Downloaded records have a fixed layout");
+
+/**
+ * @brief Always-on recording of the latest frames on every port, for post-mortems.
+ * @details A fixed ring per channel, which overwrites that channel's oldest record.  Nothing is allocated.
+ *          So a busy motor bus never pushes a quieter port's history out.
+ *          <br/>
+ *          Routine polls are thinned, as status polls alone would fill a motor bus' ring in about 150ms.
+ *          A read request repeating one kept less than `POLL_INTERVAL` ago is held back, and left out with its reply.
+ *          Anything else is kept, like writes, exception replies, and held back requests which got no reply.
+ *          Each record counts the polls left out before it.
+ *          So a bus with one drive polled flat out keeps about the last 5 seconds, or 2.5 with two.
+ *          Writes shorten that.  Fault captures keep every polled status meanwhile.
+ *          <br/>
+ *          Any task may record, on either core, without locks.
+ *          Each writer claims a slot with one atomic increment.
+ *          The slot is stamped with its index once filled, so a reader can spot records still being written.
+ *          <br/>
+ *          Freezing keeps what led up to a fault.  Frames are dropped until `clear()`.
+ *          Pausing, while the records are read out, is separate, so `resume()` never undoes a freeze.
+ */
+class FlightRecorder
+{
+public:
+    ///@brief Channels kept apart.  Frames on any other channel are dropped.
+    static constexpr size_t CHANNELS = 3;
+    ///@brief Records held per channel.
+    static constexpr size_t RECORDS = 512;
+    ///@brief Each routine poll is kept at most this often, in microseconds.
+    static constexpr uint32_t POLL_INTERVAL = 100000;
+    ///@brief Routine polls told apart per channel.  Any more are thinned less.
+    static constexpr size_t POLLS = 16;
+
+    /**
+     * @brief Record a frame.  Never blocks.
+     * @param time `micros()` when the frame started.
+     */
+    void record(uint8_t channel, FlightDirection direction, uint32_t time, const uint8_t* frame, uint16_t length);
+
+    /**
+     * @brief Stop recording, to keep what led up to a fault.
+     * @return true if already frozen.
+     */
+    bool freeze()
+    {
+        return frozen.exchange(true);
+    }
+
+    ///@brief Stop recording while the records are read out.
+    void pause()
+    {
+        paused = true;
+    }
+
+    ///@brief Carry on recording after a pause, unless frozen meanwhile.
+    void resume();
+
+    /**
+     * @brief Forget every record, and start recording again, even if frozen or paused.
+     * @details Waits for any frame being recorded to finish first, so nothing half written survives.
+     * @warning Spins meanwhile, so must not be called from a task which could keep a recording task on its core from running.
+     */
+    void clear();
+
+    [[nodiscard]] bool isFrozen() const
+    {
+        return frozen.load(std::memory_order_relaxed);
+    }
+
+    ///@brief Frames recorded on every channel, since the last clear.
+    [[nodiscard]] uint32_t getRecorded() const
+    {
+        return sequence.load(std::memory_order_relaxed);
+    }
+
+    ///@brief Index the next record on a channel gets.
+    [[nodiscard]] uint32_t getNext(const uint8_t channel) const
+    {
+        return channels[channel].next.load(std::memory_order_acquire);
+    }
+
+    ///@brief Index of the oldest record on a channel which may still be held.
+    [[nodiscard]] uint32_t getOldest(const uint8_t channel) const
+    {
+        const auto last = getNext(channel);
+        return last < RECORDS ? 0 : last - RECORDS;
+    }
+
+    /**
+     * @brief Copy out one record.
+     * @param index Below `getNext(channel)`.
+     * @return false if it was overwritten, or is still being written.
+     */
+    bool read(uint8_t channel, uint32_t index, FlightRecord& record) const;
+
+private:
+    struct Slot
+    {
+        ///@brief Index plus one once written.  0 while being written.
+        std::atomic<uint32_t> stamp{0};
+        FlightRecord record;
+    };
+
+    ///@brief A routine poll, keyed by unit id, function, address, and count.
+    struct Poll
+    {
+        uint32_t key = 0;
+        uint32_t keptAt = 0;
+    };
+
+    struct Channel
+    {
+        std::array<Slot, RECORDS> slots;
+        std::atomic<uint32_t> next{0};
+
+        // Only requests touch these, and only one is sent at a time.
+        std::array<Poll, POLLS> polls;
+        uint32_t heldAt = 0;
+        std::array<uint8_t, 8> held = {};
+        ///@brief Direction requests take on this channel.
+        std::atomic<FlightDirection> heldDirection{FLIGHT_SENT};
+        ///@brief Set while a held back request waits for its reply.
+        std::atomic<bool> waiting{false};
+        std::atomic<uint32_t> skipped{0};
+    };
+
+    ///@brief Copy a frame into the next slot on a channel.
+    void append(Channel& ring, uint8_t channel, FlightDirection direction, uint32_t time, const uint8_t* frame, uint16_t length);
+
+    ///@brief true if this read request was kept less than `POLL_INTERVAL` ago.  Otherwise notes it as kept now.
+    static bool isRoutine(Channel& ring, uint32_t time, const uint8_t* frame);
+
+    std::array<Channel, CHANNELS> channels;
+    std::atomic<uint32_t> sequence{0};
+    std::atomic<bool> frozen{false};
+    std::atomic<bool> paused{false};
+    ///@brief Frames being recorded right now.  `clear()` waits for this to drain.
+    std::atomic<uint32_t> writers{0};
+};
@@ -0,0 +1,115 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "HostLink.hpp"
+#include <Preferences.h>
+#include <algorithm>
+
+namespace
+{
+    constexpr auto PREFERENCES_NAMESPACE = "hostlink";
+    constexpr auto BAUD_KEY = "baud";
+}
+
+HostLink::HostLink(HardwareSerial& serial, RtuTransport& transport):
+    serial{serial},
+    transport{transport}
+{
+}
+
+void HostLink::begin()
+{
+    auto preferences = Preferences();
+    preferences.begin(PREFERENCES_NAMESPACE, true);
+    const auto saved = preferences.getULong(BAUD_KEY, DEFAULT_BAUD);
+    preferences.end();
+
+    baud = isSupported(saved) ? saved : DEFAULT_BAUD;
+    serial.begin(baud);
+    transport.begin(baud, SERIAL_8N1);
+}
+
+bool HostLink::request(const uint32_t baud)
+{
+    if (not isSupported(baud))
+    {
+        return false;
+    }
+    switch (state)
+    {
+    case HOST_LINK_STEADY:
+        if (baud != this->baud)
+        {
+            other = baud;
+            state = HOST_LINK_SWITCHING;
+        }
+        return true;
+    case HOST_LINK_SWITCHING:
+        // Still at the old rate, so nothing to confirm yet.
+        return false;
+    case HOST_LINK_CONFIRMING:
+        if (baud != this->baud)
+        {
+            return false;
+        }
+        save();
+        state = HOST_LINK_STEADY;
+        return true;
+    }
+    return false;
+}
+
+void HostLink::update()
+{
+    switch (state)
+    {
+    case HOST_LINK_STEADY:
+        break;
+    case HOST_LINK_SWITCHING:
+    {
+        const auto previous = baud;
+        apply(other);
+        other = previous;
+        switchedAt = millis();
+        state = HOST_LINK_CONFIRMING;
+        break;
+    }
+    case HOST_LINK_CONFIRMING:
+        if (millis() - switchedAt >= CONFIRM_TIMEOUT)
+        {
+            apply(other);
+            state = HOST_LINK_STEADY;
+        }
+        break;
+    }
+}
+
+bool HostLink::isSupported(const uint32_t baud)
+{
+    return std::find(BAUD_RATES.begin(), BAUD_RATES.end(), baud) != BAUD_RATES.end();
+}
+
+void HostLink::apply(const uint32_t newBaud)
+{
+    serial.flush();
+    baud = newBaud;
+    serial.updateBaudRate(baud);
+    transport.begin(baud, SERIAL_8N1);
+    // Anything received at the old rate is stale now.
+    transport.clear();
+}
+
+void HostLink::save() const
+{
+    auto preferences = Preferences();
+    preferences.begin(PREFERENCES_NAMESPACE, false);
+    if (preferences.getULong(BAUD_KEY, DEFAULT_BAUD) != baud)
+    {
+        preferences.putULong(BAUD_KEY, baud);
+    }
+    preferences.end();
+}
@@ -0,0 +1,83 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <array>
+
+#include "RtuTransport.hpp"
+
+enum HostLinkState : uint8_t
+{
+    ///@brief Running at a confirmed rate.
+    HOST_LINK_STEADY = 0,
+    ///@brief Switch requested.  Happens once the reply has been sent.
+    HOST_LINK_SWITCHING = 1,
+    ///@brief Running at the new rate, waiting for the host to confirm it.
+    HOST_LINK_CONFIRMING = 2
+};
+
+/**
+ * @brief Baud rate of the host serial port, with a confirm-or-revert handshake.
+ * @details Requesting a rate switches to it once the reply has gone out at the old rate.
+ *          The host then has `CONFIRM_TIMEOUT` to request the same rate again, at the new rate.
+ *          Confirmed rates are saved, and used from the next boot on.
+ *          Otherwise, the previous rate comes back, so a rate the host cannot use never sticks.
+ */
+class HostLink
+{
+public:
+    static constexpr uint32_t DEFAULT_BAUD = 115200;
+    ///@brief Rates the CH340 handles with little enough error.
+    static constexpr std::array<uint32_t, 7> BAUD_RATES = {DEFAULT_BAUD, 230400, 460800, 921600, 1000000, 1500000, 2000000};
+    ///@brief Time the host has to confirm a new rate, in milliseconds.
+    static constexpr unsigned long CONFIRM_TIMEOUT = 3000;
+
+    HostLink(HardwareSerial& serial, RtuTransport& transport);
+    HostLink(const HostLink&) = delete;
+    HostLink(const HostLink&&) = delete;
+
+    ///@brief Start the serial port at the saved rate.
+    void begin();
+
+    /**
+     * @brief Switch to a new rate, or confirm the one just switched to.
+     * @details Call `update()` once the reply has been written.
+     * @return false if the rate is not supported, or a different rate is waiting for confirmation.
+     */
+    bool request(uint32_t baud);
+
+    ///@brief Make a requested switch, or revert an unconfirmed one.
+    void update();
+
+    [[nodiscard]] uint32_t getBaud() const
+    {
+        return baud;
+    }
+
+    [[nodiscard]] HostLinkState getState() const
+    {
+        return state;
+    }
+
+    [[nodiscard]] static bool isSupported(uint32_t baud);
+
+private:
+    HardwareSerial& serial;
+    RtuTransport& transport;
+    HostLinkState state = HOST_LINK_STEADY;
+    uint32_t baud = DEFAULT_BAUD;
+    ///@brief Rate to switch to, or back to.
+    uint32_t other = DEFAULT_BAUD;
+    unsigned long switchedAt = 0;
+
+    ///@brief Change rates, once everything at the old rate is sent.
+    void apply(uint32_t newBaud);
+
+    ///@brief Save the current rate for the next boot.
+    void save() const;
+};
@@ -8,209 +8,886 @@
 #include "LinearMotor.hpp"
 #include "ModbusDefinitions.hpp"
 
-LinearMotor::LinearMotor(HardwareSerial& serial, const uint8_t id):
-    id{id},
-    serial{serial},
-    rtuComm(serial),
-    driver(serial)
+#include <algorithm>
+
+namespace
 {
+    struct StatusRegister
+    {
+        LinearMotorStatusField field;
+        RegisterSpan span;
+    };
+
+    ///@brief Where each status field lives.  Sorted by address.
+    constexpr std::array<StatusRegister, 8> STATUS_REGISTERS = {{
+        {STATUS_ERROR_CODE, {MotionG::Error_code::address, MotionG::Error_code::length}},
+        {STATUS_STATUSWORD, {MotionG::Statusword::address, MotionG::Statusword::length}},
+        {STATUS_POSITION, {MotionG::Position_actual_value::address, MotionG::Position_actual_value::length}},
+        {STATUS_VELOCITY, {MotionG::Velocity_actual_value::address, MotionG::Velocity_actual_value::length}},
+        {STATUS_TORQUE, {MotionG::Torque_actual_value::address, MotionG::Torque_actual_value::length}},
+        {STATUS_CURRENT, {MotionG::Current_actual_value::address, MotionG::Current_actual_value::length}},
+        {STATUS_DC_LINK_VOLTAGE, {MotionG::DC_link_circuit_voltage::address, MotionG::DC_link_circuit_voltage::length}},
+        {STATUS_FOLLOWING_ERROR, {MotionG::Following_error_actual_value::address, MotionG::Following_error_actual_value::length}},
+    }};
+
+    constexpr auto PLANNER = ReadPlanner(MotionG::LAYOUT.data(), MotionG::LAYOUT.size());
 }
 
-void LinearMotor::begin(const uint32_t baud, const uint32_t config, const int8_t rxPin, const int8_t txPin)
+bool LinearMotorStatus::getRegisters(const uint16_t address, const uint16_t length, uint16_t* registers) const
 {
-    serial.setRxBufferSize(sizeof(ModbusADU));
-    serial.setTxBufferSize(sizeof(ModbusADU));
-    serial.begin(baud, config, rxPin, txPin);
-    rtuComm.begin(baud, config);
-    rtuComm.setTimeout(500); // This is what ModbusRTUMaster does
-    driver.begin(baud, config);
+    if (modbusError)
+    {
+        return false;
+    }
+    uint16_t covered = 0;
+    for (const auto& statusRegister : STATUS_REGISTERS)
+    {
+        const auto& span = statusRegister.span;
+        if (span.address < address || span.end() > address + length)
+        {
+            continue;
+        }
+        if (not has(statusRegister.field))
+        {
+            return false;
+        }
+        const auto value = registers + (span.address - address);
+        switch (statusRegister.field)
+        {
+        case STATUS_ERROR_CODE:
+            MotionG::Error_code::encode(errorCode, value);
+            break;
+        case STATUS_STATUSWORD:
+            MotionG::Statusword::encode(statusword, value);
+            break;
+        case STATUS_POSITION:
+            MotionG::Position_actual_value::encode(position, value);
+            break;
+        case STATUS_VELOCITY:
+            MotionG::Velocity_actual_value::encode(velocity, value);
+            break;
+        case STATUS_TORQUE:
+            MotionG::Torque_actual_value::encode(torque, value);
+            break;
+        case STATUS_CURRENT:
+            MotionG::Current_actual_value::encode(current, value);
+            break;
+        case STATUS_DC_LINK_VOLTAGE:
+            MotionG::DC_link_circuit_voltage::encode(dcLinkVoltage, value);
+            break;
+        case STATUS_FOLLOWING_ERROR:
+            MotionG::Following_error_actual_value::encode(followingError, value);
+            break;
+        case STATUS_DEFAULT:
+        case STATUS_ALL:
+            break;
+        }
+        covered += span.length;
+    }
+    // Anything else in the range was never read, so the drive has to answer.
+    return covered == length;
 }
 
-ModbusRTUMasterError LinearMotor::disable()
+LinearMotor::LinearMotor(MotorBus& bus, const uint8_t id):
+    id{id},
+    bus{bus}
 {
-    //"Controlword" register  (UNS16) Read Write
-    return driver.writeSingleHoldingRegister(id, 0xF002, 0x06);
+    bus.attach(id);
 }
 
-void LinearMotor::enable()
+ModbusRTUMasterError LinearMotor::disable()
 {
-    disable();
-    clearError();
-    disable();  // Needs to be sent here if an error was cleared.
-    sendEnableCommand();
+    return write<MotionG::Controlword>(0x06);
 }
 
-void LinearMotor::setInertia(uint32_t value)
+ModbusRTUMasterError LinearMotor::enable()
 {
-    std::array<uint16_t, 2> raw =
-        {static_cast<uint16_t>(value >> 16),static_cast<uint16_t>(value & 0xFFFF)};
-
-    disable();
-    // "Inertia" register (UNS32) Read Write
-    driver.writeMultipleHoldingRegisters(id, 0x0028, raw.data(), raw.size());
-    persistToFlash();
-    enable();
+    auto self = this;
+    auto error = MODBUS_RTU_MASTER_SUCCESS;
+    enableAll(&self, 1, error);
+    return error;
 }
 
-void LinearMotor::setCurrentGain(uint32_t value)
+uint32_t LinearMotor::enableAll(LinearMotor* const* motors, size_t count, ModbusRTUMasterError& error)
 {
-    std::array<uint16_t, 2> raw =
-        {static_cast<uint16_t>(value >> 16),static_cast<uint16_t>(value & 0xFFFF)};
+    count = std::min(count, MotorBus::MAX_DRIVES);
+    std::array<Cia402State, MotorBus::MAX_DRIVES> states = {};
+    std::array<bool, MotorBus::MAX_DRIVES> known = {};
+    std::array<ModbusRTUMasterError, MotorBus::MAX_DRIVES> errors = {};
+    const uint32_t all = (1 << count) - 1;
+    uint32_t enabled = 0;
 
-    disable();
-    // "CurrentBandwidth" register (UNS32) Read Write
-    driver.writeMultipleHoldingRegisters(id, 0x0018, raw.data(), raw.size());
-    persistToFlash();
-    enable();
+    const auto start = millis();
+    do
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (enabled & 1 << i)
+            {
+                continue;
+            }
+            auto& motor = *motors[i];
+            // After a failure the drive may or may not have moved, so look before stepping again.
+            errors[i] = known[i] ? motor.stepEnable(states[i]) : motor.readDriveState(states[i]);
+            known[i] = errors[i] == MODBUS_RTU_MASTER_SUCCESS;
+            if (known[i] && states[i] == CIA402_OPERATION_ENABLED)
+            {
+                enabled |= 1 << i;
+            }
+        }
+    } while (enabled != all && millis() - start < ENABLE_TIMEOUT);
+
+    error = MODBUS_RTU_MASTER_SUCCESS;
+    for (size_t i = 0; i < count && error == MODBUS_RTU_MASTER_SUCCESS; i++)
+    {
+        if (not (enabled & 1 << i))
+        {
+            error = errors[i] != MODBUS_RTU_MASTER_SUCCESS ? errors[i] : MODBUS_RTU_MASTER_UNEXPECTED_VALUE;
+        }
+    }
+    return enabled;
 }
 
-void LinearMotor::setAutoGain(const bool enabled)
+ModbusRTUMasterError LinearMotor::readDriveState(Cia402State& state)
 {
-    disable();
-    // "AutoGainTuningEnable" register (UNS8) Read Write
-    driver.writeSingleHoldingRegister(id, 0x0455, enabled);
-    persistToFlash();
-    enable();
+    static_assert(MotionG::Statusword::address == MotionG::Controlword::address + 1);
+    std::array<uint16_t, 2> registers = {};
+    const auto result = bus.readRegisters(id, MotionG::Controlword::address, registers.data(), registers.size());
+    if (result == MODBUS_RTU_MASTER_SUCCESS)
+    {
+        controlword = registers[0];
+        state = decodeCia402State(registers[1]);
+        settling = false;
+    }
+    return result;
 }
 
-std::variant<bool, ModbusRTUMasterError> LinearMotor::getAutoGain()
+ModbusRTUMasterError LinearMotor::stepEnable(Cia402State& state)
 {
-    uint16_t value = -1;
-    //"AutoGainTuningEnable" register (UNS8) Read Write
-    const auto result =
-        driver.readHoldingRegisters(id, 0x0455, &value, 1);
-    if (result)
+    auto next = controlword;
+    if (settling || not nextEnableControlword(state, next))
     {
-        return result;
+        // Changing state by itself, or still acting on the last command.  Just look again.
+        return readDriveState(state);
     }
-    return value;
+    if (next & CONTROLWORD_FAULT_RESET)
+    {
+        // A fault reset can reload parameters on some drives, so start over.
+        cache.invalidate();
+    }
+    std::array<uint16_t, 2> registers = {};
+    const auto result = writeAndRead(MotionG::Controlword::address, &next, 1, MotionG::Controlword::address, registers.data(), registers.size());
+    if (result == MODBUS_RTU_MASTER_SUCCESS)
+    {
+        const auto previous = state;
+        controlword = registers[0];
+        state = decodeCia402State(registers[1]);
+        // Drives take a moment to change state.  Give it that before sending anything else.
+        settling = state == previous;
+    }
+    return result;
+}
+
+void LinearMotor::setInertia(const uint32_t value)
+{
+    auto transaction = ConfigTransaction();
+    transaction.stage<MotionG::Inertia>(value);
+    commit(transaction);
+}
+
+void LinearMotor::setCurrentGain(const uint32_t value)
+{
+    auto transaction = ConfigTransaction();
+    transaction.stage<MotionG::CurrentBandwidth>(value);
+    commit(transaction);
+}
+
+void LinearMotor::setAutoGain(const bool enabled)
+{
+    auto transaction = ConfigTransaction();
+    transaction.stage<MotionG::AutoGainTuningEnable>(enabled);
+    commit(transaction);
 }
 
 void LinearMotor::setFilter1Off()
 {
-    disable();
-    // "CurrentTargetFilter1Type" register (UNS8) Read Write
-    driver.writeSingleHoldingRegister(id, 0x0406, 0x00);
-    persistToFlash();
-    enable();
+    auto transaction = ConfigTransaction();
+    transaction.stage<MotionG::CurrentTargetFilter1Type>(0x00);
+    commit(transaction);
 }
 
 void LinearMotor::setFilter2Off()
 {
-    disable();
-    // "CurrentTargetFilter2Type" register (UNS8) Read Write
-    driver.writeSingleHoldingRegister(id, 0x040B, 0x00);
-    persistToFlash();
-    enable();
+    auto transaction = ConfigTransaction();
+    transaction.stage<MotionG::CurrentTargetFilter2Type>(0x00);
+    commit(transaction);
+}
+
+void LinearMotor::setFiltersOff()
+{
+    auto transaction = ConfigTransaction();
+    transaction.stage<MotionG::CurrentTargetFilter1Type>(0x00);
+    transaction.stage<MotionG::CurrentTargetFilter2Type>(0x00);
+    commit(transaction);
 }
 
-void LinearMotor::persistToFlash()
+ModbusRTUMasterError LinearMotor::commit(const ConfigTransaction& transaction)
 {
-    // "ControlCmd" register (UNS8)
-    driver.writeSingleHoldingRegister(id, 0x6000, 0x01);
+    auto changes = ConfigTransaction();
+    auto unsaved = false;
+    auto error = findChanges(transaction, changes, unsaved);
+    if (error != MODBUS_RTU_MASTER_SUCCESS)
+    {
+        return error;
+    }
+    // Nothing to write, and nothing left unsaved, so the drive can keep running.
+    if (changes.empty() && not unsaved)
+    {
+        return MODBUS_RTU_MASTER_SUCCESS;
+    }
 
-    // Check if save worked.
-    uint16_t value = 0;
-    // "FlashStorageStatus" register (UNS8) Read Only
-    const auto result =
-        driver.readHoldingRegisters(id, 0x018A, &value, 1);
+    std::array<RegisterSpan, ConfigTransaction::CAPACITY> writes = {};
+    std::array<uint16_t, ConfigTransaction::CAPACITY * 2> registers = {};
+    std::array<uint16_t, ConfigTransaction::CAPACITY * 2> readback = {};
+    const auto count = changes.plan(writes.data());
 
-    if (result || value)
+    // A drive which may still be running must never be written to.
+    error = disable();
+    if (error != MODBUS_RTU_MASTER_SUCCESS)
     {
-        // Not sure what success is for "value"
-        // Do something
+        return error;
     }
+    for (size_t i = 0; i < count && error == MODBUS_RTU_MASTER_SUCCESS; i++)
+    {
+        const auto& write = writes[i];
+        changes.getRegisters(write, registers.data());
+        auto result = writeAndRead(write.address, registers.data(), write.length, write.address, readback.data(), write.length);
+        if (result == MODBUS_RTU_MASTER_SUCCESS)
+        {
+            // Cache what the drive kept, even if it is not what was asked for.
+            for (const auto& entry : changes)
+            {
+                if (entry.address >= write.address && entry.address < write.end())
+                {
+                    cache.put(entry.address, entry.length, readback.data() + (entry.address - write.address), true);
+                }
+            }
+            if (not std::equal(registers.begin(), registers.begin() + write.length, readback.begin()))
+            {
+                result = MODBUS_RTU_MASTER_UNEXPECTED_VALUE;
+            }
+        }
+        else
+        {
+            // The write may or may not have landed.
+            cache.invalidate(write.address, write.length);
+        }
+        // Stops at the first failure, so a half applied configuration is never built on.
+        error = result;
+    }
+    // Only a fully applied and verified configuration is worth keeping across a power cycle.
+    if (error == MODBUS_RTU_MASTER_SUCCESS)
+    {
+        error = persistToFlash();
+    }
+    const auto enabled = enable();
+    return error != MODBUS_RTU_MASTER_SUCCESS ? error : enabled;
 }
 
-std::variant<int8_t, ModbusRTUMasterError> LinearMotor::getModeOfOperation()
+ModbusRTUMasterError LinearMotor::findChanges(const ConfigTransaction& transaction, ConfigTransaction& changes, bool& unsaved)
 {
-    uint16_t value;
-    // "Modes_of_operation_display" register (INTEGER8) Read Only
-    const auto result =
-        driver.readHoldingRegisters(id, 0xF00A, &value, 1);
-    if (result)
+    std::array<RegisterSpan, ConfigTransaction::CAPACITY> missing = {};
+    size_t missingCount = 0;
+    for (const auto& entry : transaction)
     {
-        return result;
+        std::array<uint16_t, 2> current = {};
+        if (not cache.get(entry.address, entry.length, current.data()))
+        {
+            missing[missingCount++] = {entry.address, entry.length};
+        }
+        else if (not std::equal(entry.registers.begin(), entry.registers.begin() + entry.length, current.begin()))
+        {
+            changes.stage(entry.address, entry.length, entry.registers.data());
+        }
+        else if (cache.isDirty(entry.address, entry.length))
+        {
+            // Already written, but an earlier save never finished.
+            unsaved = true;
+        }
     }
-    return value & 0xFF;
+    if (missingCount == 0)
+    {
+        return MODBUS_RTU_MASTER_SUCCESS;
+    }
+
+    // Staged writes are sorted by address, so these are too.
+    std::array<RegisterSpan, ConfigTransaction::CAPACITY> reads = {};
+    std::array<uint16_t, MAX_READ_REGISTERS> registers = {};
+    const auto splitCost = ReadPlanner::estimateSplitCost(bus.getRttEstimator().getMean(), bus.getBaud());
+    const auto readCount = PLANNER.plan(missing.data(), missingCount, reads.data(), splitCost);
+    for (size_t i = 0; i < readCount; i++)
+    {
+        const auto& read = reads[i];
+        const auto result = bus.readRegisters(id, read.address, registers.data(), read.length);
+        if (result != MODBUS_RTU_MASTER_SUCCESS)
+        {
+            return result;
+        }
+        for (const auto& entry : transaction)
+        {
+            if (entry.address < read.address || entry.address + entry.length > read.end())
+            {
+                continue;
+            }
+            const auto current = registers.data() + (entry.address - read.address);
+            cache.put(entry.address, entry.length, current, false);
+            if (not std::equal(entry.registers.begin(), entry.registers.begin() + entry.length, current))
+            {
+                changes.stage(entry.address, entry.length, entry.registers.data());
+            }
+        }
+    }
+    return MODBUS_RTU_MASTER_SUCCESS;
 }
 
-std::variant<int32_t, ModbusRTUMasterError> LinearMotor::getPositionActual()
+ModbusRTUMasterError LinearMotor::writeAndRead(const uint16_t writeAddress, const uint16_t* registers, const uint16_t writeLength,
+                                               const uint16_t readAddress, uint16_t* readback, const uint16_t readLength)
 {
-    std::array<uint16_t, 2> value = {};
-    // "Position_actual_value" register (INTEGER32) Read Only
-    const auto result =
-        driver.readHoldingRegisters(id, 0xF010, value.data(), value.size());
-    if (result)
+    if (readWriteSupported)
+    {
+        uint8_t exception = 0;
+        const auto result = bus.writeReadRegisters(id, writeAddress, registers, writeLength, readAddress, readback, readLength, exception);
+        if (exception != ILLEGAL_FUNCTION)
+        {
+            return result;
+        }
+        // Nothing was written.  Remember, and take the long way from now on.
+        readWriteSupported = false;
+    }
+    const auto result = bus.writeRegisters(id, writeAddress, registers, writeLength);
+    if (result != MODBUS_RTU_MASTER_SUCCESS)
     {
         return result;
     }
-    return value[0] << 16 | value[1];
+    return bus.readRegisters(id, readAddress, readback, readLength);
 }
 
-std::variant<uint32_t,ModbusRTUMasterError> LinearMotor::getInertia()
+ModbusRTUMasterError LinearMotor::readCached(const uint16_t address, const uint16_t length, uint16_t* registers)
 {
-    std::array<uint16_t, 2> value = {};
-    // "Inertia" register (UNS32) Read Write
-    const auto result =
-        driver.readHoldingRegisters(id, 0x0028, value.data(), value.size());
-    if (result)
+    const auto isConfiguration = MotionG::isConfiguration(address);
+    if (isConfiguration && cache.get(address, length, registers))
     {
-        return result;
+        return MODBUS_RTU_MASTER_SUCCESS;
+    }
+    const auto result = bus.readRegisters(id, address, registers, length);
+    if (result == MODBUS_RTU_MASTER_SUCCESS && isConfiguration)
+    {
+        cache.put(address, length, registers, false);
     }
-    return value[0] << 16 | value[1];
+    return result;
 }
 
-std::variant<uint32_t,ModbusRTUMasterError> LinearMotor::getCurrentGain()
+ModbusRTUMasterError LinearMotor::persistToFlash()
 {
-    std::array<uint16_t, 2> value = {};
-    // "CurrentBandwidth" register (UNS32) Read Write
-    const auto result =
-        driver.readHoldingRegisters(id, 0x0018, value.data(), value.size());
-    if (result)
+    if (bus.getBaud() != MotorBus::DEFAULT_BAUD)
     {
+        // The drive has to leave the bus rate to save, so the save is waited for here.
+        const auto result = bus.saveToFlash(id, FLASH_TIMEOUT);
+        flashState = result == MODBUS_RTU_MASTER_SUCCESS ? FLASH_SAVED : FLASH_FAILED;
+        if (flashState == FLASH_SAVED)
+        {
+            cache.markClean();
+        }
         return result;
     }
-    return value[0] << 16 | value[1];
+    // Some drives do not answer until the save is done, so allow the worst case.
+    const auto result = write<MotionG::ControlCmd>(0x01, bus.getRttEstimator().getCeiling());
+    if (result != MODBUS_RTU_MASTER_SUCCESS)
+    {
+        flashState = FLASH_FAILED;
+        return result;
+    }
+    // Status polls pick up the rest.
+    flashState = FLASH_SAVING;
+    flashStartedAt = millis();
+    return result;
+}
+
+void LinearMotor::checkFlash(const RegisterSpan& read, const uint16_t* registers)
+{
+    constexpr auto span = RegisterSpan{MotionG::FlashStorageStatus::address, MotionG::FlashStorageStatus::length};
+    if (flashState != FLASH_SAVING || span.address < read.address || span.end() > read.end())
+    {
+        return;
+    }
+    // Anything else means it is still busy.
+    if (MotionG::FlashStorageStatus::decode(registers + (span.address - read.address)) == 0)
+    {
+        flashState = FLASH_SAVED;
+        cache.markClean();
+    }
+}
+
+ModbusRTUMasterError LinearMotor::readConfiguration(const std::function<ModbusRTUMasterError(const ConfigurationBatch& batch)>& visit)
+{
+    const auto& configuration = MotionG::CONFIGURATION;
+    const auto splitCost = ReadPlanner::estimateSplitCost(bus.getRttEstimator().getMean(), bus.getBaud());
+    std::array<uint16_t, MAX_READ_REGISTERS> registers = {};
+    size_t offset = 0;
+    for (size_t first = 0; first < configuration.size();)
+    {
+        auto batch = ConfigurationBatch{first, 0, offset, {}, registers.data()};
+        batch.count = PLANNER.planNext(configuration.data() + first, configuration.size() - first, batch.read, splitCost);
+        // 8 byte request, and a 5 byte response header and CRC.
+        const auto timeout = bus.getTimeout(13 + 2 * batch.read.length);
+        const auto result = bus.readRegisters(id, batch.read.address, registers.data(), batch.read.length, timeout);
+        if (result != MODBUS_RTU_MASTER_SUCCESS)
+        {
+            return result;
+        }
+        const auto error = visit(batch);
+        if (error != MODBUS_RTU_MASTER_SUCCESS)
+        {
+            return error;
+        }
+        for (size_t i = first; i < first + batch.count; i++)
+        {
+            offset += configuration[i].length;
+        }
+        first += batch.count;
+    }
+    return MODBUS_RTU_MASTER_SUCCESS;
+}
+
+ModbusRTUMasterError LinearMotor::capture(ParameterSnapshot& snapshot)
+{
+    snapshot.clear();
+    const auto result = readConfiguration([&snapshot](const ConfigurationBatch& batch)
+    {
+        auto values = snapshot.getRegisters() + batch.offset;
+        for (size_t i = batch.first; i < batch.first + batch.count; i++)
+        {
+            const auto& span = MotionG::CONFIGURATION[i];
+            std::copy_n(batch.registers + (span.address - batch.read.address), span.length, values);
+            values += span.length;
+        }
+        return MODBUS_RTU_MASTER_SUCCESS;
+    });
+    if (result == MODBUS_RTU_MASTER_SUCCESS)
+    {
+        snapshot.seal();
+    }
+    return result;
+}
+
+ModbusRTUMasterError LinearMotor::restore(const ParameterSnapshot& snapshot, const bool apply, uint16_t& changed)
+{
+    changed = 0;
+    if (not snapshot.isValid())
+    {
+        return MODBUS_RTU_MASTER_INVALID_BUFFER;
+    }
+
+    const auto splitCost = ReadPlanner::estimateSplitCost(bus.getRttEstimator().getMean(), bus.getBaud());
+    auto disabled = false;
+    auto writeError = MODBUS_RTU_MASTER_SUCCESS;
+
+    // Pending write, from `start` up to the end of the last changed value.
+    auto pending = false;
+    uint16_t start = 0;
+    size_t startOffset = 0;
+    uint32_t changedEnd = 0;
+    // End of the unbroken run of configuration registers since `start`.  Only those may be written across.
+    uint32_t runEnd = 0;
+
+    const auto flush = [&]()
+    {
+        if (not pending)
+        {
+            return;
+        }
+        pending = false;
+        // Stops at the first failure, so a half applied configuration is never built on.
+        if (not apply || writeError != MODBUS_RTU_MASTER_SUCCESS)
+        {
+            return;
+        }
+        if (not disabled)
+        {
+            // A drive which may still be running must never be written to.
+            writeError = disable();
+            if (writeError != MODBUS_RTU_MASTER_SUCCESS)
+            {
+                return;
+            }
+            disabled = true;
+        }
+        const auto length = changedEnd - start;
+        // 9 byte request header and CRC, and an 8 byte response.
+        const auto result = bus.writeRegisters(id, start, snapshot.getRegisters() + startOffset, length, bus.getTimeout(17 + 2 * length));
+        writeError = result;
+    };
+
+    const auto result = readConfiguration([&](const ConfigurationBatch& batch)
+    {
+        auto offset = batch.offset;
+        for (size_t i = batch.first; i < batch.first + batch.count; i++)
+        {
+            const auto& span = MotionG::CONFIGURATION[i];
+            const auto live = batch.registers + (span.address - batch.read.address);
+            const auto saved = snapshot.getRegisters() + offset;
+            const auto contiguous = pending && span.address == runEnd;
+            if (contiguous)
+            {
+                runEnd = span.end();
+            }
+            if (not std::equal(saved, saved + span.length, live))
+            {
+                changed++;
+                // Rewriting unchanged values is cheaper than another request, up to a point.
+                const auto extend = contiguous && span.end() - start <= MAX_WRITE_REGISTERS && 2 * (span.address - changedEnd) <= splitCost;
+                if (not extend)
+                {
+                    flush();
+                    pending = true;
+                    start = span.address;
+                    startOffset = offset;
+                    runEnd = span.end();
+                }
+                changedEnd = span.end();
+            }
+            offset += span.length;
+        }
+        // Values in the next batch have not been compared yet, so never write across.
+        flush();
+        return MODBUS_RTU_MASTER_SUCCESS;
+    });
+
+    cache.invalidate();
+    auto error = result != MODBUS_RTU_MASTER_SUCCESS ? result : writeError;
+    if (not disabled)
+    {
+        return error;
+    }
+    if (error == MODBUS_RTU_MASTER_SUCCESS)
+    {
+        error = persistToFlash();
+    }
+    const auto enabled = enable();
+    return error != MODBUS_RTU_MASTER_SUCCESS ? error : enabled;
 }
 
 //test1: 01 03 f0 0a 00 01 97 08
 //test2: 01 06 f0 0a 00 03 da c9
 LinearMotorStatus LinearMotor::getStatus()
 {
-    uint16_t value = -1;
-    // "Error_code" register (UNS16) Read Only
-    const auto result =
-        driver.readHoldingRegisters(id, 0xF001, &value, 1);
-    return {value, result};
+    auto status = LinearMotorStatus();
+    status.errorCode = -1;
+
+    std::array<RegisterSpan, MAX_STATUS_READS> reads = {};
+    std::array<uint16_t, MAX_READ_REGISTERS> registers = {};
+    const auto count = planStatus(reads.data());
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto result = bus.readRegisters(id, reads[i].address, registers.data(), reads[i].length);
+        if (result)
+        {
+            // Only the first read decides whether the drive is at fault.
+            (i == 0 ? status.modbusError : status.fieldError) = result;
+            break;
+        }
+        parseStatus(reads[i], registers.data(), status);
+        checkFlash(reads[i], registers.data());
+    }
+    status.timestamp = micros();
+    checkForReset(status);
+    return status;
+}
+
+size_t LinearMotor::planStatus(RegisterSpan* reads)
+{
+    static_assert(STATUS_REGISTERS.size() == STATUS_REGISTER_COUNT);
+    std::array<RegisterSpan, MAX_STATUS_READS> wanted = {};
+    size_t count = 0;
+    if (flashState == FLASH_SAVING && millis() - flashStartedAt > FLASH_TIMEOUT)
+    {
+        flashState = FLASH_FAILED;
+    }
+    // On its own, so nothing optional holds up fault detection.
+    // "Statusword" is only one register further on, so costs almost nothing to bring along.
+    constexpr RegisterSpan ERROR_CODE = STATUS_REGISTERS[0].span;
+    constexpr RegisterSpan STATUSWORD = STATUS_REGISTERS[1].span;
+    static_assert(STATUSWORD.address == ERROR_CODE.end() + 1);
+    reads[0] = ERROR_CODE;
+    if (statusFields & STATUS_STATUSWORD)
+    {
+        reads[0].length = STATUSWORD.end() - ERROR_CODE.address;
+    }
+
+    if (flashState == FLASH_SAVING)
+    {
+        wanted[count++] = {MotionG::FlashStorageStatus::address, MotionG::FlashStorageStatus::length};
+    }
+    for (const auto& statusRegister : STATUS_REGISTERS)
+    {
+        const auto isFirstRead = statusRegister.field == STATUS_ERROR_CODE || statusRegister.field == STATUS_STATUSWORD;
+        if (statusFields & statusRegister.field && not isFirstRead)
+        {
+            wanted[count++] = statusRegister.span;
+        }
+    }
+    const auto splitCost = ReadPlanner::estimateSplitCost(bus.getRttEstimator().getMean(), bus.getBaud());
+    return 1 + PLANNER.plan(wanted.data(), count, reads + 1, splitCost);
+}
+
+void LinearMotor::parseStatus(const RegisterSpan& read, const uint16_t* registers, LinearMotorStatus& status) const
+{
+    for (const auto& statusRegister : STATUS_REGISTERS)
+    {
+        const auto& span = statusRegister.span;
+        if (not (statusFields & statusRegister.field) || span.address < read.address || span.end() > read.end())
+        {
+            continue;
+        }
+        const auto value = registers + (span.address - read.address);
+        switch (statusRegister.field)
+        {
+        case STATUS_ERROR_CODE:
+            status.errorCode = MotionG::Error_code::decode(value);
+            break;
+        case STATUS_STATUSWORD:
+            status.statusword = MotionG::Statusword::decode(value);
+            break;
+        case STATUS_POSITION:
+            status.position = MotionG::Position_actual_value::decode(value);
+            break;
+        case STATUS_VELOCITY:
+            status.velocity = MotionG::Velocity_actual_value::decode(value);
+            break;
+        case STATUS_TORQUE:
+            status.torque = MotionG::Torque_actual_value::decode(value);
+            break;
+        case STATUS_CURRENT:
+            status.current = MotionG::Current_actual_value::decode(value);
+            break;
+        case STATUS_DC_LINK_VOLTAGE:
+            status.dcLinkVoltage = MotionG::DC_link_circuit_voltage::decode(value);
+            break;
+        case STATUS_FOLLOWING_ERROR:
+            status.followingError = MotionG::Following_error_actual_value::decode(value);
+            break;
+        case STATUS_DEFAULT:
+        case STATUS_ALL:
+            break;
+        }
+        status.fields |= statusRegister.field;
+    }
 }
 
 bool LinearMotor::forwardAdu(ModbusADU& adu)
 {
     const auto originalId = adu.getUnitId();
+    const auto functionCode = adu.getFunctionCode();
+    invalidateWrites(adu);
 
     adu.setUnitId(id);
-    writeAdu(adu);
-    const auto readStatus = readAdu(adu);
-    if (readStatus)
+    const auto result = bus.transact(adu);
+    adu.setUnitId(originalId);
+    // Exception responses are the drive's answer, so pass them through as-is.
+    if (result != MODBUS_RTU_MASTER_SUCCESS && result != MODBUS_RTU_MASTER_EXCEPTION_RESPONSE)
     {
-        adu.setUnitId(originalId);
-        //adu.prepareExceptionResponse(readStatus);
+        adu.setFunctionCode(functionCode);
         adu.prepareExceptionResponse(GATEWAY_TARGET_DEVICE_FAILED_TO_RESPOND);
         return false;
     }
-    adu.setUnitId(originalId);
     return true;
 }
 
-ModbusRTUMasterError LinearMotor::clearError()
+ModbusTransactionHandle LinearMotor::submitForward(ModbusADU& adu, const std::function<void(ModbusADU& response, bool success)>& callback)
 {
-    //"Controlword" register (UNS16) Read Write
-    return driver.writeSingleHoldingRegister(id, 0xF002, 0x80);
+    const auto originalId = adu.getUnitId();
+    const auto functionCode = adu.getFunctionCode();
+
+    invalidateWrites(adu);
+    adu.setUnitId(id);
+    const auto handle = bus.submit(adu, [originalId, functionCode, callback](ModbusADU& response, const ModbusRTUMasterError error)
+    {
+        // Exception responses are the drive's answer, so pass them through as-is.
+        const auto success = error == MODBUS_RTU_MASTER_SUCCESS || error == MODBUS_RTU_MASTER_EXCEPTION_RESPONSE;
+        response.setUnitId(originalId);
+        if (not success)
+        {
+            response.setFunctionCode(functionCode);
+            response.prepareExceptionResponse(GATEWAY_TARGET_DEVICE_FAILED_TO_RESPOND);
+        }
+        callback(response, success);
+    });
+    adu.setUnitId(originalId);
+    return handle;
+}
+
+ModbusTransactionHandle LinearMotor::submitGetStatus(const std::function<void(const LinearMotorStatus& status)>& callback,
+                                                     const std::function<void(const LinearMotorStatus& status)>& errorCallback,
+                                                     const std::function<void()>& pauseCallback)
+{
+    statusPoll.count = planStatus(statusPoll.reads.data());
+    statusPoll.index = 0;
+    statusPoll.status = LinearMotorStatus();
+    statusPoll.status.errorCode = -1;
+    statusPoll.callback = callback;
+    statusPoll.errorCallback = errorCallback;
+    statusPoll.pauseCallback = pauseCallback;
+    return submitNextStatusRead();
 }
 
-ModbusRTUMasterError LinearMotor::sendEnableCommand()
+ModbusTransactionHandle LinearMotor::resumeGetStatus()
 {
-    //"Controlword" register (UNS16) Read Write
-    return driver.writeSingleHoldingRegister(id, 0xF002, 0x0F);
+    const auto handle = submitNextStatusRead();
+    if (handle == INVALID_TRANSACTION)
+    {
+        finishStatusPoll(MODBUS_RTU_MASTER_UNKNOWN_COMM_ERROR);
+    }
+    return handle;
+}
+
+ModbusTransactionHandle LinearMotor::submitNextStatusRead()
+{
+    const auto& read = statusPoll.reads[statusPoll.index];
+    auto adu = ModbusADU();
+    prepareReadHoldingRegisters(adu, id, read.address, read.length);
+    return bus.submit(adu, [this](ModbusADU& response, ModbusRTUMasterError error)
+    {
+        const auto& read = statusPoll.reads[statusPoll.index];
+        if (error == MODBUS_RTU_MASTER_SUCCESS && response.data[0] != read.length * 2)
+        {
+            error = MODBUS_RTU_MASTER_UNEXPECTED_BYTE_COUNT;
+        }
+        if (error == MODBUS_RTU_MASTER_SUCCESS)
+        {
+            std::array<uint16_t, MAX_READ_REGISTERS> registers = {};
+            for (uint16_t i = 0; i < read.length; i++)
+            {
+                registers[i] = getResponseRegister(response, i);
+            }
+            parseStatus(read, registers.data(), statusPoll.status);
+            checkFlash(read, registers.data());
+            if (statusPoll.index == 0)
+            {
+                reportErrorCode(MODBUS_RTU_MASTER_SUCCESS);
+            }
+
+            if (++statusPoll.index < statusPoll.count)
+            {
+                if (statusPoll.pauseCallback != nullptr)
+                {
+                    statusPoll.pauseCallback();
+                    return;
+                }
+                if (submitNextStatusRead() != INVALID_TRANSACTION)
+                {
+                    return;
+                }
+                error = MODBUS_RTU_MASTER_UNKNOWN_COMM_ERROR;
+            }
+        }
+        else if (statusPoll.index == 0)
+        {
+            reportErrorCode(error);
+        }
+        finishStatusPoll(error);
+    });
+}
+
+void LinearMotor::finishStatusPoll(const ModbusRTUMasterError error)
+{
+    // Only the first read decides whether the drive is at fault.
+    if (statusPoll.index == 0)
+    {
+        statusPoll.status.modbusError = error;
+    }
+    else
+    {
+        statusPoll.status.fieldError = error;
+    }
+    statusPoll.status.timestamp = micros();
+    checkForReset(statusPoll.status);
+    statusPoll.callback(statusPoll.status);
+}
+
+ModbusRTUMasterError LinearMotor::adopt(const uint8_t fromId)
+{
+    if (fromId == id)
+    {
+        return MODBUS_RTU_MASTER_SUCCESS;
+    }
+
+    // Skip the shadow cache.  Whatever answers at this id afterwards is a different drive.
+    std::array<uint16_t, MotionG::ModbusNodeID::length> raw = {};
+    MotionG::ModbusNodeID::encode(id, raw.data());
+    const auto result = bus.writeRegisters(fromId, MotionG::ModbusNodeID::address, raw.data(), raw.size());
+    if (result == MODBUS_RTU_MASTER_EXCEPTION_RESPONSE)
+    {
+        return result;
+    }
+    cache.invalidate();
+
+    uint8_t value = 0;
+    if (read<MotionG::ModbusNodeID>(value) == MODBUS_RTU_MASTER_SUCCESS)
+    {
+        persistToFlash();
+        return value == id ? MODBUS_RTU_MASTER_SUCCESS : MODBUS_RTU_MASTER_UNEXPECTED_VALUE;
+    }
+
+    // Still at the old id, waiting for a restart.
+    const auto pending = bus.readRegisters(fromId, MotionG::ModbusNodeID::address, raw.data(), raw.size());
+    if (pending != MODBUS_RTU_MASTER_SUCCESS)
+    {
+        return pending;
+    }
+    if (MotionG::ModbusNodeID::decode(raw.data()) != id)
+    {
+        return MODBUS_RTU_MASTER_UNEXPECTED_VALUE;
+    }
+    return bus.saveToFlash(fromId, FLASH_TIMEOUT);
+}
+
+void LinearMotor::invalidateWrites(ModbusADU& adu)
+{
+    switch (adu.getFunctionCode())
+    {
+    case 0x06: // Write Single Register
+        cache.invalidate(adu.getDataRegister(0), 1);
+        break;
+    case 0x10: // Write Multiple Registers
+        cache.invalidate(adu.getDataRegister(0), adu.getDataRegister(1));
+        break;
+    case 0x17: // Read/Write Multiple Registers
+        cache.invalidate(adu.getDataRegister(2), adu.getDataRegister(3));
+        break;
+    default:
+        break;
+    }
+}
+
+void LinearMotor::reportErrorCode(const ModbusRTUMasterError error)
+{
+    if (statusPoll.errorCallback == nullptr)
+    {
+        return;
+    }
+    auto status = statusPoll.status;
+    status.modbusError = error;
+    status.timestamp = micros();
+    statusPoll.errorCallback(status);
+}
+
+void LinearMotor::checkForReset(const LinearMotorStatus& status)
+{
+    const auto reachedDrive = status.modbusError == MODBUS_RTU_MASTER_SUCCESS;
+    bus.watchBaud(reachedDrive);
+    if (reachedDrive && not lastPollReachedDrive)
+    {
+        cache.invalidate();
+    }
+    lastPollReachedDrive = reachedDrive;
 }
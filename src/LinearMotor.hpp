@@ -6,36 +6,145 @@
  */
 
 #pragma once
-#include <ModbusRTUComm.h>
 #include <ModbusRTUMaster.h>
-#include <variant>
+#include <array>
+#include <functional>
+
+#include "AsyncModbusMaster.hpp"
+#include "Cia402.hpp"
+#include "ConfigTransaction.hpp"
+#include "MotionGRegisters.hpp"
+#include "MotorBus.hpp"
+#include "ParameterCache.hpp"
+#include "ParameterSnapshot.hpp"
+#include "ReadPlanner.hpp"
+
+///@brief Optional parts of a `LinearMotorStatus`.  Flags.
+enum LinearMotorStatusField : uint16_t
+{
+    ///@brief Always read.
+    STATUS_ERROR_CODE = 1 << 0,
+    STATUS_STATUSWORD = 1 << 1,
+    STATUS_POSITION = 1 << 2,
+    STATUS_VELOCITY = 1 << 3,
+    STATUS_TORQUE = 1 << 4,
+    STATUS_CURRENT = 1 << 5,
+    STATUS_DC_LINK_VOLTAGE = 1 << 6,
+    STATUS_FOLLOWING_ERROR = 1 << 7,
+    ///@brief What background polling reads, unless told otherwise.
+    STATUS_DEFAULT = 0x7F,
+    STATUS_ALL = 0xFF
+};
+
+///@brief Progress of the latest save to a drive's flash.
+enum FlashState : uint8_t
+{
+    ///@brief Nothing saved since power on.
+    FLASH_IDLE = 0,
+    ///@brief Waiting for "FlashStorageStatus" to report the save finished.
+    FLASH_SAVING = 1,
+    FLASH_SAVED = 2,
+    ///@brief Refused, or never reported finishing.  Changes are still unsaved.
+    FLASH_FAILED = 3
+};
 
 class LinearMotorStatus
 {
 public:
+    ///@brief "Error_code" register (UNS16)
     uint16_t errorCode = 0;
+    ///@brief Error reading "Error_code".  The drive's state is unknown, so this counts as an error.
     ModbusRTUMasterError modbusError = MODBUS_RTU_MASTER_SUCCESS;
+    ///@brief Error reading an optional field.  Those fields are left out of `fields`, but the drive is not at fault.
+    ModbusRTUMasterError fieldError = MODBUS_RTU_MASTER_SUCCESS;
+
+    ///@brief Which fields were successfully read.  `LinearMotorStatusField` flags.
+    uint16_t fields = 0;
+    ///@brief "Statusword" register (UNS16)
+    uint16_t statusword = 0;
+    ///@brief "Position_actual_value" register (INTEGER32)
+    int32_t position = 0;
+    ///@brief "Velocity_actual_value" register (INTEGER32)
+    int32_t velocity = 0;
+    ///@brief "Torque_actual_value" register (INTEGER16)
+    int16_t torque = 0;
+    ///@brief "Current_actual_value" register (INTEGER16)
+    int16_t current = 0;
+    ///@brief "DC_link_circuit_voltage" register (UNS32)
+    uint32_t dcLinkVoltage = 0;
+    ///@brief "Following_error_actual_value" register (INTEGER32)
+    int32_t followingError = 0;
+
+    ///@brief `micros()` when the snapshot was taken.
+    unsigned long timestamp = 0;
+
     [[nodiscard]] bool isError() const
     {
         return modbusError || errorCode;
         //return modbusError || errorCode & 0xFF != 0x00 && (errorCode >> 8 & 0xFF) != 0x00;
     }
+
+    [[nodiscard]] bool has(const LinearMotorStatusField field) const
+    {
+        return fields & field;
+    }
+
+    /**
+     * @brief Get the raw registers behind this snapshot, as the drive would return them.
+     * @param address First register.
+     * @param length Number of registers.
+     * @param registers Receives `length` values.
+     * @return false unless every register was read in this snapshot.
+     */
+    bool getRegisters(uint16_t address, uint16_t length, uint16_t* registers) const;
 };
 
+/**
+ * @brief One drive, on a bus it may share with others.
+ * @details Keeps its own shadow cache and status poll.  Everything on the wire goes through the bus.
+ */
 class LinearMotor {
 public:
-    LinearMotor(HardwareSerial& serial, uint8_t id);
-
     /**
-     * @copydoc HardwareSerial::begin
+     * @param bus Bus the drive is on.  Shared by every drive on the same wire.
+     * @param id Modbus node id.  Must be unique on the bus.
      */
-    void begin(uint32_t baud, uint32_t config, int8_t rxPin, int8_t txPin);
+    LinearMotor(MotorBus& bus, uint8_t id);
+
+    [[nodiscard]] MotorBus& getBus() const
+    {
+        return bus;
+    }
+
+    ///@return true if the latest status poll reached the drive.
+    [[nodiscard]] bool isReachable() const
+    {
+        return lastPollReachedDrive;
+    }
 
     ModbusRTUMasterError disable();
-    void enable();
+
+    /**
+     * @brief Bring the drive to Operation Enabled, clearing any fault on the way.
+     * @details Reads the drive's state, then sends only the transitions needed from there.
+     *          Each transition writes "Controlword" and reads back "Statusword" in the same request, where the drive supports it.
+     * @return `MODBUS_RTU_MASTER_UNEXPECTED_VALUE` if the drive did not get there within `ENABLE_TIMEOUT`.
+     */
+    ModbusRTUMasterError enable();
+
+    /**
+     * @brief Enable several drives at once.
+     * @details Drives take turns, one transition each, so each drive settles while the others are talked to.
+     * @param motors Drives to enable.  At most `MotorBus::MAX_DRIVES`.
+     * @param error Set to the first error of any drive which did not get there.
+     * @return Bit `i` set if `motors[i]` reached Operation Enabled.
+     */
+    static uint32_t enableAll(LinearMotor* const* motors, size_t count, ModbusRTUMasterError& error);
+
+    ///@brief Longest enabling waits for a drive to reach Operation Enabled, in milliseconds.
+    static constexpr uint32_t ENABLE_TIMEOUT = 1000;
 
     void setInertia(uint32_t value);
-    std::variant<uint32_t, ModbusRTUMasterError> getInertia();
 
     /**
      * @brief Set the electrical gain.
@@ -43,56 +152,198 @@ public:
      */
     void setCurrentGain(uint32_t value = 100);
 
-    /**
-     * @brief Get the current electrical gain.
-     * @return The current electrical gain, or the error code.
-     */
-    std::variant<uint32_t, ModbusRTUMasterError> getCurrentGain();
-
     /**
      * @brief Enable or disable AutoGainTuning
      */
     void setAutoGain(bool enabled);
-    std::variant<bool, ModbusRTUMasterError> getAutoGain();
 
     void setFilter1Off();
     void setFilter2Off();
 
     /**
-     * @brief Save the active settings to permanent storage.
+     * @brief Turn off both current target filters, in a single transaction.
      */
-    void persistToFlash();
+    void setFiltersOff();
 
-    std::variant<int8_t, ModbusRTUMasterError> getModeOfOperation();
-    std::variant<int32_t, ModbusRTUMasterError> getPositionActual();
+    /**
+     * @brief Apply a batch of configuration writes.
+     * @details Values the drive already has are skipped, and if that is all of them, nothing else happens.
+     *          Otherwise the drive is disabled once, contiguous registers are written with a single request,
+     *          and settings are persisted to flash once before the drive is re-enabled.
+     *          <br/>
+     *          Each write reads its registers back in the same request, where the drive supports it.
+     *          A value the drive does not keep, like one it clamps, is `MODBUS_RTU_MASTER_UNEXPECTED_VALUE`.
+     *          <br/>
+     *          If the drive can not be disabled, nothing is written.
+     *          Writing stops at the first write or readback which fails, and the drive is re-enabled without saving to flash.
+     * @return The first error, if disabling or any write failed.
+     */
+    ModbusRTUMasterError commit(const ConfigTransaction& transaction);
 
     /**
-     * @brief Determine if an error is present, and what the status is.
-     * @return The error bytes if an error is present.  Otherwise, nothing.
+     * @brief Start saving the active settings to permanent storage.
+     * @details The drive takes a while, so this does not wait.
+     *          Status polls watch "FlashStorageStatus" until the save finishes, or `FLASH_TIMEOUT` passes.
+     *          Unsaved changes are only cleared once the drive reports the save finished.
+     *          <br/>
+     *          Above `MotorBus::DEFAULT_BAUD`, the save is waited for instead, so the negotiated rate is never saved.
+     *          See `MotorBus::saveToFlash()`.
+     * @return Error sending the request.
      */
-    LinearMotorStatus getStatus();
+    ModbusRTUMasterError persistToFlash();
 
-    [[nodiscard]] uint8_t getId() const
+    ///@brief Longest the drive may take to save to flash, in milliseconds.
+    static constexpr uint32_t FLASH_TIMEOUT = 2000;
+
+    [[nodiscard]] FlashState getFlashState() const
     {
-        return id;
+        return flashState;
+    }
+
+    /**
+     * @brief Read every configuration register into a snapshot.
+     * @details Reads across registers which are not wanted, when that is cheaper than another request.
+     * @param snapshot Sealed on success.  Cleared on failure.
+     */
+    ModbusRTUMasterError capture(ParameterSnapshot& snapshot);
+
+    /**
+     * @brief Put a drive's configuration back the way it was captured.
+     * @details The live configuration is read in bulk, and only registers which differ are written.
+     *          Runs of changed registers are written together, along with any short gaps between them.
+     *          If anything changed, the drive is disabled once, and persisted to flash once before being re-enabled.
+     *          Nothing is written if it could not be disabled, and writing stops at the first failure.
+     *          Flash is left alone if anything failed, so a power cycle undoes a partial restore.
+     * @param snapshot From `capture()`.  May come from another drive.
+     * @param apply false to only count the differences.
+     * @param changed Set to the number of configuration values which differ.
+     * @return The first error, including from saving and re-enabling.  `MODBUS_RTU_MASTER_INVALID_BUFFER` if the snapshot is not valid.
+     */
+    ModbusRTUMasterError restore(const ParameterSnapshot& snapshot, bool apply, uint16_t& changed);
+
+    /**
+     * @brief Read any register.
+     * @tparam R Register from `MotionGRegisters.hpp`, like `MotionG::Inertia`.
+     * @param value Set to the register's value.  Unchanged on error.
+     */
+    template <typename R>
+    ModbusRTUMasterError read(typename R::type& value)
+    {
+        std::array<uint16_t, R::length> raw = {};
+        const auto result = bus.readRegisters(id, R::address, raw.data(), raw.size());
+        if (result == MODBUS_RTU_MASTER_SUCCESS)
+        {
+            value = R::decode(raw.data());
+        }
+        return result;
+    }
+
+    /**
+     * @brief Read raw registers, chosen at run time.
+     * @param registers Receives `length` values.
+     */
+    ModbusRTUMasterError read(const uint16_t address, const uint16_t length, uint16_t* registers)
+    {
+        return bus.readRegisters(id, address, registers, length);
+    }
+
+    /**
+     * @brief Read a configuration register, from the shadow cache if possible.
+     * @details Only this firmware changes configuration, so after the first read the drive is not asked again.
+     * @tparam R Read write register from `MotionGRegisters.hpp`, like `MotionG::Inertia`.
+     * @param value Set to the register's value.  Unchanged on error.
+     */
+    template <typename R>
+    ModbusRTUMasterError readCached(typename R::type& value)
+    {
+        static_assert(MotionG::isConfiguration(R::address), "Only configuration registers are cached");
+        std::array<uint16_t, R::length> raw = {};
+        const auto result = readCached(R::address, R::length, raw.data());
+        if (result == MODBUS_RTU_MASTER_SUCCESS)
+        {
+            value = R::decode(raw.data());
+        }
+        return result;
+    }
+
+    /**
+     * @brief Read raw configuration registers, chosen at run time, from the shadow cache if possible.
+     * @details Anything outside `MotionG::CONFIGURATION` is always read from the drive, and never cached.
+     *          Commands and set points change by themselves, so would go stale.
+     * @param registers Receives `length` values.
+     */
+    ModbusRTUMasterError readCached(uint16_t address, uint16_t length, uint16_t* registers);
+
+    /**
+     * @brief Write any writable register.
+     * @details The shadow cache is updated on success, but only for configuration registers.
+     *          Commands like "Controlword" are never cached, so they never count as unsaved changes.
+     * @tparam R Register from `MotionGRegisters.hpp`, like `MotionG::Inertia`.
+     * @param value New value.
+     * @param timeout Response timeout, in milliseconds.  0 uses the adaptive timeout.
+     * @warning Changes are not persisted.  See `persistToFlash()`.
+     */
+    template <typename R>
+    ModbusRTUMasterError write(const typename R::type value, const uint32_t timeout = 0)
+    {
+        static_assert(R::writable, "Register is read only");
+        std::array<uint16_t, R::length> raw = {};
+        R::encode(value, raw.data());
+        const auto result = bus.writeRegisters(id, R::address, raw.data(), raw.size(), timeout);
+        if constexpr (MotionG::isConfiguration(R::address))
+        {
+            if (result == MODBUS_RTU_MASTER_SUCCESS)
+            {
+                cache.put(R::address, R::length, raw.data(), true);
+            }
+            else
+            {
+                // The write may or may not have landed.
+                cache.invalidate(R::address, R::length);
+            }
+        }
+        return result;
     }
 
     /**
-     * @see ModBusRTUComm::writeAdu
+     * @return true if configuration was changed, but not persisted to flash.
      */
-    bool writeAdu(ModbusADU& adu)
+    [[nodiscard]] bool hasUnsavedChanges() const
     {
-        return rtuComm.writeAdu(adu);
+        return cache.isDirty();
     }
 
     /**
-     * @see ModBusRTUComm::readAdu
+     * @brief Determine if an error is present, and what the status is.
+     * @details Reads "Error_code" first, then every other field selected by `setStatusFields()`, merged into as few requests as is worthwhile.
+     *          Only failing to read "Error_code" sets `modbusError`.  Failing to read the rest sets `fieldError`.
+     * @return The error bytes if an error is present, and any other fields read.
      */
-    ModbusRTUCommError readAdu(ModbusADU& adu)
+    LinearMotorStatus getStatus();
+
+    /**
+     * @brief Choose which optional fields `getStatus()` reads.
+     * @param fields `LinearMotorStatusField` flags.  The error code is always read.
+     */
+    void setStatusFields(const uint16_t fields)
+    {
+        statusFields = fields | STATUS_ERROR_CODE;
+    }
+
+    [[nodiscard]] uint8_t getId() const
     {
-        return rtuComm.readAdu(adu);
+        return id;
     }
 
+    /**
+     * @brief Move a drive from another node id to this one, and persist it.
+     * @details Drives usually ship with the same id, so each one on a shared bus has to be moved before the next is connected.
+     *          The drive may answer from either id, or switch before answering at all, so the result is checked with a read.
+     *          Some drives only switch after a power cycle.  Then the change is persisted at the old id, and this still succeeds.
+     * @param fromId Node id the drive answers to now.
+     */
+    ModbusRTUMasterError adopt(uint8_t fromId);
+
     /**
      * @brief Forward an ADU to a motor, adjusting the id & CRC as needed.
      * @details The caller is responsible for returning the response message to the sender.
@@ -102,6 +353,45 @@ public:
      */
     bool forwardAdu(ModbusADU& adu);
 
+    /**
+     * @brief Queue a raw ADU, without blocking.
+     * @see AsyncModbusMaster::submit
+     */
+    ModbusTransactionHandle submitAdu(ModbusADU& adu, const ModbusTransactionCallback& callback = nullptr)
+    {
+        invalidateWrites(adu);
+        return bus.submit(adu, callback);
+    }
+
+    /**
+     * @brief Non-blocking version of `forwardAdu`.
+     * @param adu To forward.  Copied, so may be reused as soon as this returns.
+     * @param callback Receives the response message, and whether forwarding succeeded.
+     * @return Transaction handle, or `INVALID_TRANSACTION` if the queue is full.
+     */
+    ModbusTransactionHandle submitForward(ModbusADU& adu, const std::function<void(ModbusADU& response, bool success)>& callback);
+
+    /**
+     * @brief Non-blocking version of `getStatus`.
+     * @details The status may take several requests.  Only one status poll may be outstanding at a time.
+     * @param callback Receives the whole status.
+     * @param errorCallback Optional.  Receives the status as soon as "Error_code" is read, or fails, with only it and "Statusword" filled in.
+     *                      Lets faults be acted on without waiting for the rest.
+     * @param pauseCallback Optional.  If given, the poll stops after each read but the last, and calls this.
+     *                      It carries on once `resumeGetStatus()` is called, so other traffic can go in between.
+     * @return Handle of the first request, or `INVALID_TRANSACTION` if the queue is full.
+     */
+    ModbusTransactionHandle submitGetStatus(const std::function<void(const LinearMotorStatus& status)>& callback,
+                                            const std::function<void(const LinearMotorStatus& status)>& errorCallback = nullptr,
+                                            const std::function<void()>& pauseCallback = nullptr);
+
+    /**
+     * @brief Carry on with a status poll which paused.
+     * @details A paused poll may also be abandoned, by submitting a new one.  Its callback is then never called.
+     * @return Handle of the next request.  If it is `INVALID_TRANSACTION`, the poll has already finished with an error.
+     */
+    ModbusTransactionHandle resumeGetStatus();
+
 private:
     /**
      * @brief Modbus Unit Identifier
@@ -109,21 +399,136 @@ private:
     const uint8_t id;
 
     /**
-     * @brief Underlying connection.
+     * @brief Every transaction goes through here.
      */
-    HardwareSerial& serial;
+    MotorBus& bus;
 
     /**
-     * @brief Communication interface.
-     * @details For manual adu handling.
+     * @brief Shadow copy of configuration registers.
      */
-    ModbusRTUComm rtuComm;
+    ParameterCache cache;
+
+    ///@brief Whether the last status poll reached the drive.  Used to detect drive resets.
+    bool lastPollReachedDrive = false;
+
+    FlashState flashState = FLASH_IDLE;
+    ///@brief `millis()` when the latest save was requested.
+    unsigned long flashStartedAt = 0;
+
+    ///@brief Cleared if the drive turns out not to support "Read/Write Multiple Registers" (0x17).
+    bool readWriteSupported = true;
+
+    ///@brief Latest "Controlword" read from or written to the drive.  For the fault reset edge.
+    uint16_t controlword = 0;
+    ///@brief The last transition sent had not shown up in "Statusword" yet.
+    bool settling = false;
 
     /**
-     * @brief High level interface.
+     * @brief Drop cached values for anything a raw or forwarded ADU writes.
      */
-    ModbusRTUMaster driver;
+    void invalidateWrites(ModbusADU& adu);
 
-    ModbusRTUMasterError clearError();
-    ModbusRTUMasterError sendEnableCommand();
+    ///@brief Fill in the status poll's errors and time, and pass it to the poll's callback.
+    void finishStatusPoll(ModbusRTUMasterError error);
+
+    /**
+     * @brief Pass the status poll's first read, or its failure, to the poll's error callback, if it has one.
+     */
+    void reportErrorCode(ModbusRTUMasterError error);
+
+    /**
+     * @brief A drive which stops responding may have been power cycled, losing unsaved changes.
+     * @param status Result of a status poll.
+     */
+    void checkForReset(const LinearMotorStatus& status);
+
+    ///@brief `LinearMotorStatusField` flags.
+    uint16_t statusFields = STATUS_DEFAULT;
+
+    ///@brief One entry per `LinearMotorStatusField`.
+    static constexpr size_t STATUS_REGISTER_COUNT = 8;
+
+    ///@brief Every status register, and "FlashStorageStatus" while a save is in progress.
+    static constexpr size_t MAX_STATUS_READS = STATUS_REGISTER_COUNT + 1;
+
+    ///@brief Non-blocking status poll in progress.
+    struct StatusPoll
+    {
+        std::array<RegisterSpan, MAX_STATUS_READS> reads = {};
+        size_t count = 0;
+        size_t index = 0;
+        LinearMotorStatus status;
+        std::function<void(const LinearMotorStatus& status)> callback = nullptr;
+        std::function<void(const LinearMotorStatus& status)> errorCallback = nullptr;
+        std::function<void()> pauseCallback = nullptr;
+    } statusPoll;
+
+    /**
+     * @brief Plan the reads needed for a status snapshot.
+     * @details The first read is always "Error_code", with "Statusword" if wanted, so faults are known after one round trip.
+     *          Gives up on a save to flash which has taken too long, so it is no longer read.
+     * @param reads Receives up to `MAX_STATUS_READS` requests.
+     * @return Number of requests.
+     */
+    size_t planStatus(RegisterSpan* reads);
+
+    /**
+     * @brief Fill in every status field covered by a read.
+     * @param read Registers which were read.
+     * @param registers Their values.
+     * @param status Status to update.
+     */
+    void parseStatus(const RegisterSpan& read, const uint16_t* registers, LinearMotorStatus& status) const;
+
+    ModbusTransactionHandle submitNextStatusRead();
+
+    /**
+     * @brief Finish a save to flash, if a status read covers "FlashStorageStatus" and it reports being done.
+     * @param read Registers which were read.
+     * @param registers Their values.
+     */
+    void checkFlash(const RegisterSpan& read, const uint16_t* registers);
+
+    /**
+     * @brief Find the staged values which differ from the drive's.
+     * @details Uses the shadow cache where possible, and reads whatever it is missing in as few requests as is worthwhile.
+     * @param changes Receives the writes which are still needed.
+     * @param unsaved Set if any value the drive already has was never saved to flash.
+     */
+    ModbusRTUMasterError findChanges(const ConfigTransaction& transaction, ConfigTransaction& changes, bool& unsaved);
+
+    /**
+     * @brief Write registers, then read some.
+     * @details One "Read/Write Multiple Registers" (0x17) request if the drive supports it, otherwise a write and then a read.
+     * @param readback Receives `readLength` values.
+     */
+    ModbusRTUMasterError writeAndRead(uint16_t writeAddress, const uint16_t* registers, uint16_t writeLength,
+                                      uint16_t readAddress, uint16_t* readback, uint16_t readLength);
+
+    ///@brief Read "Controlword" and "Statusword".
+    ModbusRTUMasterError readDriveState(Cia402State& state);
+
+    /**
+     * @brief Send the next transition towards Operation Enabled, if there is one, and read the state it leads to.
+     * @param state The drive's current state.  Updated.
+     */
+    ModbusRTUMasterError stepEnable(Cia402State& state);
+
+    ///@brief Some of `MotionG::CONFIGURATION`, and the live values from a single read.
+    struct ConfigurationBatch
+    {
+        ///@brief Index of the first entry.
+        size_t first;
+        size_t count;
+        ///@brief Where the first entry's values go in a `ParameterSnapshot`.
+        size_t offset;
+        RegisterSpan read;
+        const uint16_t* registers;
+    };
+
+    /**
+     * @brief Read every configuration register, in as few requests as is worthwhile.
+     * @param visit Called with each batch, in address order.  Stops on the first error it returns.
+     */
+    ModbusRTUMasterError readConfiguration(const std::function<ModbusRTUMasterError(const ConfigurationBatch& batch)>& visit);
 };
@@ -8,6 +8,34 @@
 
 #pragma once
 #include <ModbusADU.h>
+#include <cstring>
+
+/**
+ * @brief Largest possible RTU frame, including unit id and CRC.
+ * @see Modbus over Serial Line V1.02 P.13
+ */
+constexpr uint16_t MODBUS_RTU_MAX_ADU_SIZE = 256;
+
+/**
+ * @brief 'ILLEGAL FUNCTION' exception
+ * @details The device does not support the function code.
+ * @see Modbus Specification V1.1b3 P.48
+ */
+constexpr uint8_t ILLEGAL_FUNCTION = 0x01;
+
+/**
+ * @brief 'ILLEGAL DATA ADDRESS' exception
+ * @details The device does not have a register at an address in the request.
+ * @see Modbus Specification V1.1b3 P.48
+ */
+constexpr uint8_t ILLEGAL_DATA_ADDRESS = 0x02;
+
+/**
+ * @brief 'ILLEGAL DATA VALUE' exception
+ * @details A value in the request is not allowed.
+ * @see Modbus Specification V1.1b3 P.48
+ */
+constexpr uint8_t ILLEGAL_DATA_VALUE = 0x03;
 
 /**
  * @brief 'GATEWAY PATH UNAVAILABLE' exception
@@ -22,3 +50,130 @@ constexpr uint8_t GATEWAY_PATH_UNAVAILABLE = 0x0A;
  * @see Modbus Specification V1.1b3 P.49
  */
 constexpr uint8_t GATEWAY_TARGET_DEVICE_FAILED_TO_RESPOND = 0x0B;
+
+
+/**
+ * @brief Copy the contents of one ADU into another.
+ * @details `ModbusADU` holds pointers into its own buffer, so it must never be copied by value.
+ * @param destination ADU to overwrite.
+ * @param source ADU to copy from.
+ */
+inline void copyAdu(ModbusADU& destination, ModbusADU& source)
+{
+    const auto length = source.getRtuLen();
+    std::memcpy(destination.rtu, source.rtu, length);
+    destination.setRtuLen(length);
+}
+
+/**
+ * @brief Build a "Read Holding Registers" (0x03) request.
+ * @param adu ADU to overwrite.
+ * @param unitId Device to read from.
+ * @param address First register.
+ * @param quantity Number of registers.
+ */
+inline void prepareReadHoldingRegisters(ModbusADU& adu, const uint8_t unitId, const uint16_t address, const uint16_t quantity)
+{
+    adu.setUnitId(unitId);
+    adu.setFunctionCode(0x03);
+    adu.setDataRegister(0, address);
+    adu.setDataRegister(1, quantity);
+    adu.setDataLen(4);
+}
+
+/**
+ * @brief Build a "Write Single Register" (0x06) request.
+ * @param adu ADU to overwrite.
+ * @param unitId Device to write to.
+ * @param address Register.
+ * @param value New value.
+ */
+inline void prepareWriteSingleRegister(ModbusADU& adu, const uint8_t unitId, const uint16_t address, const uint16_t value)
+{
+    adu.setUnitId(unitId);
+    adu.setFunctionCode(0x06);
+    adu.setDataRegister(0, address);
+    adu.setDataRegister(1, value);
+    adu.setDataLen(4);
+}
+
+/**
+ * @brief Build a "Write Multiple Registers" (0x10) request.
+ * @param adu ADU to overwrite.
+ * @param unitId Device to write to.
+ * @param address First register.
+ * @param registers New values.
+ * @param quantity Number of registers.  At most 123.
+ */
+inline void prepareWriteMultipleRegisters(ModbusADU& adu, const uint8_t unitId, const uint16_t address, const uint16_t* registers, const uint16_t quantity)
+{
+    adu.setUnitId(unitId);
+    adu.setFunctionCode(0x10);
+    adu.setDataRegister(0, address);
+    adu.setDataRegister(1, quantity);
+    adu.data[4] = quantity * 2;
+    for (uint16_t i = 0; i < quantity; i++)
+    {
+        adu.data[5 + i * 2] = registers[i] >> 8;
+        adu.data[6 + i * 2] = registers[i] & 0xFF;
+    }
+    adu.setDataLen(5 + quantity * 2);
+}
+
+/**
+ * @brief Build a "Read/Write Multiple Registers" (0x17) request.
+ * @details The write happens before the read.
+ * @param adu ADU to overwrite.
+ * @param unitId Device to write to.
+ * @param readAddress First register to read.
+ * @param readQuantity Number of registers to read.  At most 125.
+ * @param writeAddress First register to write.
+ * @param registers New values.
+ * @param writeQuantity Number of registers to write.  At most 121.
+ */
+inline void prepareReadWriteMultipleRegisters(ModbusADU& adu, const uint8_t unitId, const uint16_t readAddress, const uint16_t readQuantity,
+                                              const uint16_t writeAddress, const uint16_t* registers, const uint16_t writeQuantity)
+{
+    adu.setUnitId(unitId);
+    adu.setFunctionCode(0x17);
+    adu.setDataRegister(0, readAddress);
+    adu.setDataRegister(1, readQuantity);
+    adu.setDataRegister(2, writeAddress);
+    adu.setDataRegister(3, writeQuantity);
+    adu.data[8] = writeQuantity * 2;
+    for (uint16_t i = 0; i < writeQuantity; i++)
+    {
+        adu.data[9 + i * 2] = registers[i] >> 8;
+        adu.data[10 + i * 2] = registers[i] & 0xFF;
+    }
+    adu.setDataLen(9 + writeQuantity * 2);
+}
+
+/**
+ * @brief Get a register from a "Read Holding Registers" (0x03), or "Read/Write Multiple Registers" (0x17) response.
+ * @details The response data starts with a byte count, so `ModbusADU::getDataRegister` can not be used.
+ * @param adu Response.
+ * @param index Register index, relative to the first register read.
+ */
+inline uint16_t getResponseRegister(const ModbusADU& adu, const uint16_t index)
+{
+    return adu.data[1 + index * 2] << 8 | adu.data[2 + index * 2];
+}
+
+/**
+ * @brief Turn a "Read Holding Registers" (0x03) request into its response.
+ * @details Unit id and function code are left as-is.
+ * @param adu Request to overwrite.
+ * @param registers Values read.
+ * @param quantity Number of registers.
+ */
+inline void prepareReadHoldingRegistersResponse(ModbusADU& adu, const uint16_t* registers, const uint16_t quantity)
+{
+    adu.data[0] = quantity * 2;
+    for (uint16_t i = 0; i < quantity; i++)
+    {
+        adu.data[1 + i * 2] = registers[i] >> 8;
+        adu.data[2 + i * 2] = registers[i] & 0xFF;
+    }
+    adu.setDataLen(1 + quantity * 2);
+}
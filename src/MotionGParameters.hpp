@@ -0,0 +1,516 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief Every named parameter in the MotionG DN1-G60xxN parameter list, with its limits.
+ * @details Generated by tools/generate_registers.py from docs/MotionG/params_info.csv.  Do not edit.
+ *          Only include from one translation unit.  Look parameters up with `findParameter()`.
+ */
+
+#pragma once
+#include <array>
+
+#include "Parameter.hpp"
+
+namespace MotionG
+{
+    ///@brief Every parameter, sorted by name.  Limits are raw values, in units of 1 / scale.
+    constexpr std::array<ParameterInfo, 495> PARAMETERS = {{
+        {"abort_connection_action_mode", 0xF000, PARAMETER_INT16, READ_WRITE, true, 1, 0, 3},
+        {"acc_display_unit", 0x047D, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"acc_factor_den", 0xF06E, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"acc_factor_num", 0xF06C, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"adc1_raw_data_actual_value", 0x0214, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"adc1_sampling_offset", 0x031A, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"adc1_sampling_res_reduction", 0x02F0, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 31},
+        {"adc1_voltage_range", 0x01BB, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 11},
+        {"adc2_raw_data_actual_value", 0x0216, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"adc2_sampling_offset", 0x031C, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"adc2_sampling_res_reduction", 0x02F2, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 31},
+        {"adc2_voltage_range", 0x01BC, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 11},
+        {"adc_hw_voltage_lower_limit", 0x0468, PARAMETER_INT32, READ_ONLY, false, 1000, -2147483648, 2147483647},
+        {"adc_hw_voltage_upper_limit", 0x046A, PARAMETER_INT32, READ_ONLY, false, 1000, -2147483648, 2147483647},
+        {"adc_user_voltage_lower_limit", 0x046C, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"adc_user_voltage_upper_limit", 0x046E, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"analog_control_signal_source", 0x02EE, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"analog_input1_deadzone", 0x04F2, PARAMETER_UNS32, READ_WRITE, false, 1, 0, 65535},
+        {"analog_input2_deadzone", 0x04F4, PARAMETER_UNS32, READ_WRITE, false, 1, 0, 65535},
+        {"app_acc_limit", 0xF09C, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"app_current_limit", 0x0462, PARAMETER_UNS32, READ_WRITE, true, 1000, 0, 4294967295},
+        {"app_current_limit_relative", 0xF024, PARAMETER_UNS16, READ_WRITE, true, 1000, 0, 65535},
+        {"app_dec_limit", 0xF09E, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"app_force_limit", 0x0964, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"app_position_limit_enable", 0x004B, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"app_speed_limit", 0xF03C, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"app_torque_limit_relative", 0xF023, PARAMETER_UNS16, READ_WRITE, true, 1000, 0, 65535},
+        {"auto_elec_angle_align_enable", 0x041C, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 2},
+        {"auto_gain_estimation_speed", 0x0457, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 7},
+        {"auto_gain_tuning_enable", 0x0455, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"auto_gain_tuning_method", 0x0456, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"axis_alpha_current_actual_value", 0x0459, PARAMETER_INT32, READ_ONLY, false, 1000, -2147483648, 2147483647},
+        {"axis_alpha_voltage_actual_value", 0x03D8, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"axis_alpha_voltage_demand_value", 0x03DC, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"axis_alpha_voltage_target_value", 0x03D2, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"axis_beta_current_actual_value", 0x045B, PARAMETER_INT32, READ_ONLY, false, 1000, -2147483648, 2147483647},
+        {"axis_beta_voltage_actual_value", 0x03DA, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"axis_beta_voltage_demand_value", 0x03DE, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"axis_beta_voltage_target_value", 0x03D4, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"axis_d_current_actual_value", 0x03D6, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"axis_d_current_demand_value", 0x03D0, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"axis_d_current_target_value", 0x03CE, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"buff_repetitive_enable", 0x0065, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"bus_over_voltage_threshold", 0x003B, PARAMETER_UNS32, READ_WRITE, true, 1000, 0, 4294967295},
+        {"bus_under_voltage_threshold", 0x003D, PARAMETER_UNS32, READ_WRITE, true, 1000, 0, 4294967295},
+        {"bus_voltage_actual_value", 0xF02D, PARAMETER_UNS32, READ_ONLY, false, 1000, 0, 4294967295},
+        {"can_baudrate", 0x002E, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"can_node_id", 0x002F, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"comm_func_option_code_1", 0x045D, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"comm_func_option_code_2", 0x045F, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"communication_type", 0x0002, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 3},
+        {"current_actual_value", 0xF02B, PARAMETER_INT16, READ_ONLY, false, 1, -32768, 32767},
+        {"current_controller_bw_designed_value", 0x022D, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"current_controller_bw_verified_value", 0x03C2, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"current_controller_gain", 0x0018, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"current_error_value", 0x0033, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"current_loop_control_algo", 0x0230, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"current_loop_freq", 0x018C, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"current_target_filter1_bw", 0x040A, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"current_target_filter1_freq", 0x0408, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"current_target_filter1_type", 0x0406, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"current_target_filter2_bw", 0x040F, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"current_target_filter2_freq", 0x040D, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"current_target_filter2_type", 0x040B, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"current_target_filter3_bw", 0x0414, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"current_target_filter3_freq", 0x0412, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"current_target_filter3_type", 0x0410, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"current_target_filter4_bw", 0x0419, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"current_target_filter4_freq", 0x0417, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"current_target_filter4_type", 0x0415, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"database_rw_error_code", 0x0444, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"deadzone_comp_enable", 0x0318, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"debug_param1", 0x031E, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"debug_param2", 0x0320, PARAMETER_INT32, READ_WRITE, true, 1, 0, 2147483647},
+        {"debug_param3", 0x0322, PARAMETER_INT32, READ_WRITE, true, 1, 0, 2147483647},
+        {"debug_param4", 0x0324, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"debug_param5", 0x0325, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 255},
+        {"debug_param6", 0x0326, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"debug_param7", 0x0328, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"digital_input_status", 0xF0D4, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"digital_io_input_active_level", 0x01D6, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"digital_io_input_auto_trigger_enable", 0x0464, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"digital_io_output_mask", 0xF0D8, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"digital_output_status", 0xF0D6, PARAMETER_UNS32, READ_WRITE, false, 1, 0, 4294967295},
+        {"direction_ident_distance", 0x0189, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 100000},
+        {"disable_operation_action_mode", 0xF006, PARAMETER_INT16, READ_WRITE, true, 1, 0, 1},
+        {"drive_accumulated_heat", 0x03C6, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"drive_bus_voltage_lower_limit", 0x0382, PARAMETER_UNS32, READ_ONLY, false, 1000, 0, 4294967295},
+        {"drive_bus_voltage_upper_limit", 0x0380, PARAMETER_UNS32, READ_ONLY, false, 1000, 0, 4294967295},
+        {"drive_cont_current", 0x0336, PARAMETER_UNS32, READ_ONLY, false, 1000, 0, 4294967295},
+        {"drive_high_temp_fault_threshold", 0x0052, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 100},
+        {"drive_high_temp_warning_threshold", 0x0058, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"drive_low_temp_fault_threshold", 0x0054, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"drive_overload_current", 0x0336, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"drive_overload_current_duration", 0x033C, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"drive_overload_detect_enable", 0x03A0, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"drive_peak_current", 0x0338, PARAMETER_UNS32, READ_ONLY, false, 1000, 0, 4294967295},
+        {"drive_peak_current_detect_enable", 0x03A1, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"drive_peak_current_duration", 0x033A, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"drive_temp", 0x0035, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"drive_temp_detect_enable", 0x03AD, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"drive_temp_threshold_time", 0x0209, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"driveboard_hw_version", 0x0194, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"driveboard_sw_version", 0x0196, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"ds402_controlword", 0xF002, PARAMETER_UNS16, READ_WRITE, false, 1, 0, 65535},
+        {"ds402_statusword", 0xF003, PARAMETER_UNS16, READ_ONLY, false, 1, 0, 65535},
+        {"dynamic_braking_enable", 0x04F0, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 1},
+        {"elec_angle_actual_value", 0x051C, PARAMETER_INT32, READ_ONLY, false, 1000, -2147483648, 2147483647},
+        {"elec_angle_align_auto_return_enable", 0x0475, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"elec_angle_fb_mapping", 0x0392, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"elec_angle_ident_mode", 0x0440, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"elec_angle_ident_param_1", 0x0470, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 2},
+        {"elec_angle_ident_param_2", 0x0472, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 1000},
+        {"elec_angle_ident_param_3", 0x0474, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 1000},
+        {"elec_angle_ident_target_elec_angle", 0x03BB, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 5},
+        {"elec_angle_ident_timeout_time", 0x0442, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 100000},
+        {"elec_angle_offset", 0x02E8, PARAMETER_UNS32, READ_WRITE, true, 1000, 0, 4294967295},
+        {"enc1_ack_bits", 0x0172, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 36},
+        {"enc1_baudrate", 0x005E, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"enc1_control_word_status", 0x033F, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 2},
+        {"enc1_crc_bits", 0x0174, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 36},
+        {"enc1_crc_poly", 0x0176, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"enc1_data_coding_format", 0x0178, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"enc1_data_polling_time", 0x0344, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 7},
+        {"enc1_error_active_level", 0x0177, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 2},
+        {"enc1_error_bit_num", 0x0343, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"enc1_error_bits", 0x0173, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 36},
+        {"enc1_glitch_filter_coef", 0x03F1, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"enc1_high_mask_bits", 0x0342, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"enc1_multi_turn_hw_res", 0x005A, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"enc1_multi_turn_position", 0x0526, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"enc1_positon_lsb_num", 0x0341, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"enc1_protocol_total_bits", 0x0340, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"enc1_signal_type", 0x0465, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"enc1_single_turn_eff_res", 0x038E, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"enc1_single_turn_hw_res", 0x033E, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"enc1_single_turn_position", 0x0524, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"enc1_single_turn_sw_res", 0x0B88, PARAMETER_UNS32, READ_WRITE, false, 1, 0, 4294967295},
+        {"enc1_status", 0x0004, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 255},
+        {"enc1_temp", 0x0345, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 255},
+        {"enc1_temp_threshold", 0x0346, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"enc1_type", 0x0001, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 127},
+        {"enc1_zero_bits", 0x0061, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 36},
+        {"enc2_ack_bits", 0x0179, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 36},
+        {"enc2_baudrate", 0x0060, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"enc2_control_word_status", 0x034F, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 2},
+        {"enc2_crc_bits", 0x017B, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 36},
+        {"enc2_crc_poly", 0x017D, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"enc2_data_coding_format", 0x017F, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"enc2_data_polling_time", 0x0354, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 7},
+        {"enc2_error_active_level", 0x017E, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 2},
+        {"enc2_error_bit_num", 0x0353, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"enc2_error_bits", 0x017A, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 36},
+        {"enc2_glitch_filter_coef", 0x03F3, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"enc2_high_mask_bits", 0x0352, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"enc2_multi_turn_hw_res", 0x005C, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"enc2_multi_turn_position", 0x052A, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"enc2_positon_lsb_num", 0x0351, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"enc2_protocol_total_bits", 0x0350, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"enc2_signal_type", 0x0466, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"enc2_single_turn_eff_res", 0x004F, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"enc2_single_turn_hw_res", 0x034E, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"enc2_single_turn_position", 0x0528, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"enc2_single_turn_sw_res", 0x0B8A, PARAMETER_UNS32, READ_WRITE, false, 1, 0, 4294967295},
+        {"enc2_status", 0x0212, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 255},
+        {"enc2_temp", 0x0355, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 255},
+        {"enc2_temp_threshold", 0x0356, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"enc2_type", 0x004D, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 127},
+        {"enc2_zero_bits", 0x0062, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 36},
+        {"encoder_divided_pulse_output_zero_duration", 0x04AC, PARAMETER_UNS32, READ_WRITE, true, 1, 100, 100000},
+        {"encoder_errors_reset_cmd", 0x04EF, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 127},
+        {"encoder_multi_turn_data_reset_cmd", 0x04EE, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 127},
+        {"encoder_single_turn_data_reset_cmd", 0x04ED, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 127},
+        {"error_code", 0xF001, PARAMETER_UNS16, READ_ONLY, false, 1, 0, 65535},
+        {"ext_force_comp_enable", 0x04E5, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 1},
+        {"ext_force_comp_interp_interval", 0x04EA, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"ext_force_comp_point_number", 0x04E6, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 255},
+        {"ext_force_comp_start_position", 0x04E8, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"fault_response_action_mode", 0xF008, PARAMETER_INT16, READ_WRITE, true, 1, 0, 4},
+        {"flash_status_detect_enable", 0x039C, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"flash_storage_status", 0x018A, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 127},
+        {"force_constant_calib_enable", 0x075F, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 1},
+        {"force_constant_calib_interp_interval", 0x0764, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"force_constant_calib_point_number", 0x0760, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 255},
+        {"force_constant_calib_start_position", 0x0762, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"force_control_cycle", 0x021E, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"force_control_mode", 0x021C, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 3},
+        {"force_control_search_speed", 0x0477, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"force_demand_value", 0x03BE, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"force_display_unit", 0x047E, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"force_error_value", 0x0403, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"force_factor_den", 0x043E, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"force_factor_num", 0x043C, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"force_param_unit", 0x022B, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"force_position_admittance_b", 0x0222, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"force_position_admittance_k", 0x0220, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"force_position_admittance_m", 0x0224, PARAMETER_INT32, READ_WRITE, true, 1, 1, 2147483647},
+        {"force_position_admittance_unit_index", 0x03E0, PARAMETER_INT8, READ_WRITE, true, 1, -6, 0},
+        {"force_position_impedance_b", 0x020D, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"force_position_impedance_k", 0x020B, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"force_position_impedance_m", 0x020F, PARAMETER_INT32, READ_WRITE, true, 1, 1, 2147483647},
+        {"force_range_detect_enable", 0x03AC, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"force_sensor_actual_value", 0x03FC, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"force_sensor_cutoff_freq", 0x0226, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"force_sensor_direction", 0x0229, PARAMETER_INT8, READ_WRITE, true, 1, -128, 127},
+        {"force_sensor_sampling_offset", 0x0228, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"force_sensor_type", 0x021B, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 3},
+        {"force_slope", 0x01A3, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"force_target_reached_detect_enable", 0x03FD, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"force_target_reached_window", 0x03FE, PARAMETER_UNS16, READ_WRITE, true, 1, 0, 65535},
+        {"force_target_reached_window_time", 0x0400, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 65535},
+        {"force_target_value", 0x0218, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"force_torque_feedforward", 0x0396, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"force_torque_ki", 0x039A, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"force_torque_kp", 0x0398, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"force_torque_unit_index", 0x03DF, PARAMETER_INT8, READ_WRITE, true, 1, -6, 0},
+        {"friction_comp_enable", 0x0183, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"fwc_current", 0x0207, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"gear_ratio_load_rev", 0xF05A, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"gear_ratio_motor_rev", 0xF058, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"hall_error_counting_time", 0x019C, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"hall_sensor_data", 0x052B, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 127},
+        {"hall_status", 0x0005, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 127},
+        {"hall_status_detect_enable", 0x039E, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"hall_type", 0x0046, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 2},
+        {"halt_action_mode", 0xF007, PARAMETER_INT16, READ_WRITE, true, 1, 1, 4},
+        {"home_offset", 0xF035, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"homing_acc", 0xF075, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"homing_method", 0xF06F, PARAMETER_INT8, READ_WRITE, true, 1, -127, 35},
+        {"homing_speed_for_switch_search", 0xF071, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"homing_speed_for_zero_search", 0xF073, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"homing_stall_current_relative", 0x043F, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 150},
+        {"homing_stall_time", 0x0198, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"homing_timeout_time", 0x0454, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"hw_short_circuit_detect_enable", 0x039B, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"ident_current_amp_relative", 0x000A, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 200},
+        {"ident_current_freq", 0x0008, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"ident_state", 0x0006, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 127},
+        {"inc_enc_wire_saving_type", 0x04AF, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 3},
+        {"inertia_adaptive_freq", 0x016F, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 40000},
+        {"inertia_adaptive_gain", 0x016D, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"input_shaping_enable", 0x04D4, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"interfaceboard_hw_version", 0x0190, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"interfaceboard_sw_version", 0x0192, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"ip_algo_coef1", 0xF08C, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"ip_algo_coef2", 0xF08E, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"ip_mode", 0xF01D, PARAMETER_INT32, READ_WRITE, false, 1, -32768, 32767},
+        {"ip_period_actual_value", 0x051E, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"ip_period_est_value", 0x0520, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"ip_time_index", 0xF090, PARAMETER_INT8, READ_WRITE, true, 1, -128, 127},
+        {"ip_time_phase", 0x0522, PARAMETER_INT32, READ_ONLY, false, 1000000, -2147483648, 2147483647},
+        {"ip_time_unit", 0xF08F, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"load_position_actual_raw_value", 0x0446, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"load_position_actual_value", 0xF010, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"load_position_error_value", 0xF0CE, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"load_position_fb_direction", 0x0233, PARAMETER_INT8, READ_WRITE, true, 1, -128, 127},
+        {"load_position_fb_res", 0xF054, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"load_speed_observer_actual_value", 0x03EF, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"load_torque_fb_actual_value", 0x021A, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"load_velocity_actual_value", 0xF01D, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"load_velocity_error_value", 0x0031, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"load_zero_pulse_error_value", 0x03C0, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"low_freq_vibra_filter1_bw", 0x04B4, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"low_freq_vibra_filter1_freq", 0x04B2, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"low_freq_vibra_filter1_type", 0x04B0, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"low_freq_vibra_filter2_bw", 0x04B9, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"low_freq_vibra_filter2_freq", 0x04B7, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"low_freq_vibra_filter2_type", 0x04B5, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"low_freq_vibra_filter3_bw", 0x04BE, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"low_freq_vibra_filter3_freq", 0x04BC, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"low_freq_vibra_filter3_type", 0x04BA, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"low_freq_vibra_filter4_bw", 0x04C3, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"low_freq_vibra_filter4_freq", 0x04C1, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"low_freq_vibra_filter4_type", 0x04BF, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"mech_ident_current_amp_relative", 0x0010, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 200},
+        {"mech_ident_motor_freq", 0x000C, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"mech_ident_motor_speed_relative", 0x000E, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 100},
+        {"mech_ident_position_lower_limit", 0x0014, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"mech_ident_position_upper_limit", 0x0012, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"modbus_baudrate", 0x0479, PARAMETER_UNS32, READ_WRITE, false, 1, 0, 4294967295},
+        {"modbus_node_id", 0x047A, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 255},
+        {"motion_polarity", 0xF03A, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"motion_profile_type", 0xF049, PARAMETER_INT16, READ_WRITE, true, 1, 0, 3},
+        {"motor_accumulated_heat", 0x02EA, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"motor_brake_control_mode", 0x02FB, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"motor_brake_engage_speed_threshold", 0x02F6, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_brake_engage_sw_delay_time", 0x02FF, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_brake_engage_time", 0x02FA, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_brake_engage_time_threshold", 0x0301, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_brake_pwm_signal_duty_cycle", 0x03BA, PARAMETER_UNS8, READ_WRITE, true, 1, 1, 100},
+        {"motor_brake_pwm_signal_freq", 0x03B9, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"motor_brake_release_sw_delay_time", 0x02FD, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_brake_release_time", 0x02F8, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_cont_current", 0xF027, PARAMETER_UNS32, READ_WRITE, true, 1000, 0, 4294967295},
+        {"motor_damping", 0x002A, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"motor_flux_linkage", 0x002C, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_force_constant", 0x038A, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_high_temp_fault_threshold", 0x0056, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"motor_high_temp_warning_threshold", 0x03B2, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"motor_inductance", 0x0022, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"motor_low_temp_fault_threshold", 0x03B0, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"motor_max_speed_rpm", 0xF03E, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"motor_mover_mass", 0x038C, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_op_status", 0x0003, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 127},
+        {"motor_overload_current", 0x03A4, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_overload_current_duration", 0x0037, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_overload_detect_enable", 0x03A2, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"motor_peak_current", 0x003F, PARAMETER_UNS32, READ_WRITE, true, 1000, 0, 4294967295},
+        {"motor_peak_current_detect_enable", 0x03A5, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"motor_peak_current_duration", 0x03A7, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_pole_pair_pitch", 0x0388, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"motor_pole_pairs", 0x0026, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"motor_position_actual_value", 0x01B0, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"motor_position_error_value", 0x01B2, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"motor_position_fb_direction", 0x0232, PARAMETER_INT8, READ_WRITE, true, 1, 0, 127},
+        {"motor_position_fb_res", 0x0394, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"motor_rated_torque", 0xF029, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_resistance", 0x0024, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"motor_rotor_inertia", 0x0028, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_speed_observer_actual_value", 0x03ED, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"motor_stuck_current_threshold_relative", 0x03F8, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 100},
+        {"motor_stuck_detect_enable", 0x03AA, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"motor_stuck_threshold_time", 0x0039, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_stuck_velocity_threshold", 0x03FA, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_temp", 0x0041, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"motor_temp_detect_enable", 0x03AE, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"motor_temp_threshold_time", 0x03B4, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_torque_constant", 0x0048, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"motor_type", 0xF0DB, PARAMETER_UNS16, READ_WRITE, true, 1, 0, 65535},
+        {"motor_velocity_actual_value", 0x01B4, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"motor_velocity_error_value", 0x01B6, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"motor_zero_pulse_error_value", 0x019E, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"multi_segment_running_segment", 0x0404, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 255},
+        {"multi_segment_running_state", 0x0405, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 255},
+        {"multi_segment_selection_cmd", 0x03F6, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 255},
+        {"multi_segment_set_param_index", 0x0430, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 7},
+        {"multi_segment_set_segment_index", 0x042F, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 16},
+        {"multi_segment_set_value", 0x0432, PARAMETER_UNS32, READ_WRITE, false, 1, 0, 4294967295},
+        {"multi_segment_trigger_cmd", 0x03F7, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 255},
+        {"negative_limit_switch_alert_enable", 0x0064, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"negative_torque_limit_relative", 0xF0A6, PARAMETER_UNS16, READ_WRITE, true, 1000, 0, 65535},
+        {"op_mode_actual", 0xF00A, PARAMETER_INT8, READ_ONLY, false, 1, -128, 127},
+        {"op_mode_cmd", 0xF009, PARAMETER_INT8, READ_WRITE, false, 1, -128, 127},
+        {"over_force_threshold", 0x032C, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"overspeed_detect_enable", 0x004C, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"overspeed_threshold", 0x03A9, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"overtravel_action_mode", 0x044D, PARAMETER_INT16, READ_WRITE, true, 1, -32768, 32767},
+        {"phase_u_current_actual_value", 0x01BE, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"phase_u_voltage_actual_value", 0x01C4, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"phase_v_current_actual_value", 0x01C0, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"phase_v_voltage_actual_value", 0x01C6, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"phase_w_current_actual_value", 0x01C2, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"phase_w_voltage_actual_value", 0x01C8, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"point_program_dwell_time", 0x041E, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"pole_pairs_ident_elec_cycles", 0x0185, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 100},
+        {"pole_pairs_ident_wait_time", 0x0187, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 100000},
+        {"position_acc_ff", 0x0020, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"position_controller_bw_designed_value", 0x0016, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"position_controller_bw_verified_value", 0x03C4, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"position_controller_gain", 0x0016, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"position_demand_value", 0xF00C, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"position_display_unit", 0x047B, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"position_error_correction_active_number", 0x0428, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 1000},
+        {"position_error_correction_enable", 0x0420, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"position_error_correction_interval", 0x0424, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 2147483647},
+        {"position_error_correction_param_reset_cmd", 0x0437, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 255},
+        {"position_error_correction_set_index", 0x0434, PARAMETER_UNS32, READ_WRITE, false, 1, 0, 4294967295},
+        {"position_error_correction_set_value", 0x0436, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"position_error_correction_start_index_offset", 0x0426, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 999},
+        {"position_error_correction_start_position", 0x0422, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"position_error_correction_status", 0x0438, PARAMETER_INT8, READ_ONLY, false, 1, -128, 127},
+        {"position_factor_den", 0xF062, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"position_factor_num", 0xF060, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"position_fb_attr", 0x0448, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"position_fb_mapping", 0x0390, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"position_fb_status_detect_enable", 0x039D, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"position_following_error_detect_enable", 0x03AB, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"position_following_error_threshold", 0xF012, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"position_following_error_threshold_time", 0xF013, PARAMETER_UNS16, READ_WRITE, true, 1, 0, 65535},
+        {"position_loop_control_algo", 0x038F, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"position_loop_freq", 0x018E, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"position_overflow_threshold", 0xF033, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"position_target_reached_detect_enable", 0x03B5, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"position_target_reached_window", 0xF015, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"position_target_reached_window_time", 0xF016, PARAMETER_UNS16, READ_WRITE, true, 1, 0, 65535},
+        {"position_target_value", 0xF02F, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"position_underflow_threshold", 0xF031, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"position_user_target_value", 0xF02F, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"position_velocity_ff", 0x001E, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"positioning_option_code", 0xF0CC, PARAMETER_UNS16, READ_WRITE, true, 1, 0, 65535},
+        {"positive_limit_switch_alert_enable", 0x0063, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"positive_torque_limit_relative", 0xF0A5, PARAMETER_UNS16, READ_WRITE, true, 1000, 0, 65535},
+        {"power_on_auto_enable", 0x03EB, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"product_code", 0x0211, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"production_batch_version", 0x03CC, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"profile_acc", 0xF044, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"profile_dec", 0xF046, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"profile_velocity", 0xF040, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"pulse_capture_channel", 0x041F, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"pulse_capture_glitch_filter_coef", 0x03F5, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"pulse_capture_signal_counts", 0x03CA, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"pulse_capture_signal_type", 0x0317, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"pulse_input_ratio_den", 0x042E, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"pulse_input_ratio_num", 0x042C, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"pulse_input_resolution", 0x042A, PARAMETER_UNS32, READ_WRITE, true, 1, 10, 10000000},
+        {"pulse_output_freq_div", 0x03C7, PARAMETER_UNS8, READ_WRITE, true, 1, 1, 255},
+        {"pulse_output_mode", 0x03C7, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 2},
+        {"pulse_output_resolution", 0x041B, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"pwm_capture_period_filter_time", 0x02DA, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"pwm_capture_period_res_reduction", 0x02DB, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 32},
+        {"pwm_control_basic_freq", 0x02EC, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 0},
+        {"quick_stop_action_mode", 0xF004, PARAMETER_INT16, READ_WRITE, true, 1, 0, 8},
+        {"quick_stop_deceleration", 0xF048, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"ref_signal_amp", 0x01CC, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"ref_signal_control_object", 0x03BC, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"ref_signal_freq", 0x01CE, PARAMETER_UNS32, READ_WRITE, true, 1000, 0, 4294967295},
+        {"ref_signal_offset", 0x01D0, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"ref_signal_slope", 0x01D2, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"ref_signal_type", 0x01C9, PARAMETER_UNS8, READ_WRITE, true, 1, 1, 2},
+        {"regeneration_function_enable", 0x03E9, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"regeneration_resistor_overload_protection_enable", 0x03EA, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"regeneration_voltage_lower_threshold", 0x03E8, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"regeneration_voltage_upper_threshold", 0x03E6, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"residual_vibration_ratio", 0x04DA, PARAMETER_UNS32, READ_WRITE, true, 1000, 1, 1000},
+        {"resolver1_ch1_excitation_signal_freq", 0x04C7, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"resolver1_ch1_multiplication_factor", 0x04C5, PARAMETER_UNS8, READ_WRITE, true, 1, 2, 255},
+        {"resolver1_ch1_pole_pairs", 0x04C4, PARAMETER_UNS8, READ_WRITE, true, 1, 1, 255},
+        {"resolver1_ch2_excitation_signal_freq", 0x04CB, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"resolver1_ch2_multiplication_factor", 0x04C9, PARAMETER_UNS8, READ_WRITE, true, 1, 2, 255},
+        {"resolver1_ch2_pole_pairs", 0x04C8, PARAMETER_UNS8, READ_WRITE, true, 1, 1, 255},
+        {"resolver2_ch1_excitation_signal_freq", 0x04CF, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"resolver2_ch1_multiplication_factor", 0x04CD, PARAMETER_UNS8, READ_WRITE, true, 1, 2, 255},
+        {"resolver2_ch1_pole_pairs", 0x04CC, PARAMETER_UNS8, READ_WRITE, true, 1, 1, 255},
+        {"resolver2_ch2_excitation_signal_freq", 0x04D3, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"resolver2_ch2_multiplication_factor", 0x04D1, PARAMETER_UNS8, READ_WRITE, true, 1, 2, 255},
+        {"resolver2_ch2_pole_pairs", 0x04D0, PARAMETER_UNS8, READ_WRITE, true, 1, 1, 255},
+        {"script_running_status", 0x044E, PARAMETER_INT8, READ_ONLY, false, 1, -128, 127},
+        {"serial_enc_error_counting_time", 0x019A, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"shutdown_action_mode", 0xF005, PARAMETER_INT16, READ_WRITE, true, 1, 0, 1},
+        {"smoothing_factor", 0x004A, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 1000},
+        {"smoothing_factor_index", 0x0460, PARAMETER_INT8, READ_WRITE, true, 1, -3, 3},
+        {"speed_measurement_cycle", 0x0181, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 1000000},
+        {"speed_observer_bw", 0x0043, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"static_friction_current", 0x0045, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"sto_enable", 0x0050, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"supported_communication_type", 0x02F3, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 255},
+        {"supported_op_modes", 0xF0DD, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"supported_position_fb_type", 0x02F4, PARAMETER_UNS8, READ_ONLY, false, 1, 0, 255},
+        {"sys_perf_verf_mode", 0x0315, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 3},
+        {"system_control_cmd", 0x6000, PARAMETER_UNS8, READ_WRITE, false, 1, 0, 255},
+        {"system_vibration_damping_ratio", 0x04D8, PARAMETER_UNS32, READ_WRITE, true, 1000, 1, 1000},
+        {"system_vibration_freq", 0x04D6, PARAMETER_UNS32, READ_WRITE, true, 10, 1, 4294967295},
+        {"target_force_offset", 0x0B94, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"target_position_after_homing", 0x043A, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"target_position_buff_size", 0x016B, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 129},
+        {"torque_actual_value", 0xF02A, PARAMETER_INT16, READ_ONLY, false, 1, -32768, 32767},
+        {"torque_demand_value", 0xF025, PARAMETER_INT16, READ_ONLY, false, 1, -32768, 32767},
+        {"torque_max_record_value", 0x04AE, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"torque_ripple_comp_enable", 0x0182, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"torque_slope", 0xF04B, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 2},
+        {"torque_target_value", 0xF022, PARAMETER_INT16, READ_WRITE, false, 1, -32768, 32767},
+        {"touch_probe_1_negative_edge_counter", 0xF0A2, PARAMETER_UNS16, READ_ONLY, false, 1, 0, 65535},
+        {"touch_probe_1_negative_edge_position", 0xF085, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"touch_probe_1_positive_edge_counter", 0xF0A1, PARAMETER_UNS16, READ_ONLY, false, 1, 0, 65535},
+        {"touch_probe_1_positive_edge_position", 0xF083, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"touch_probe_2_negative_edge_counter", 0xF0A4, PARAMETER_UNS16, READ_ONLY, false, 1, 0, 65535},
+        {"touch_probe_2_negative_edge_position", 0xF089, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"touch_probe_2_positive_edge_counter", 0xF0A3, PARAMETER_UNS16, READ_ONLY, false, 1, 0, 65535},
+        {"touch_probe_2_positive_edge_position", 0xF087, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"touch_probe_function_controlword", 0xF080, PARAMETER_UNS16, READ_WRITE, false, 1, 0, 65535},
+        {"touch_probe_status", 0xF081, PARAMETER_UNS16, READ_ONLY, false, 1, 0, 65535},
+        {"under_force_threshold", 0x032A, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"user_position_lower_limit", 0xF037, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"user_position_upper_limit", 0xF039, PARAMETER_INT32, READ_WRITE, true, 1, -2147483648, 2147483647},
+        {"velocity_control_mode", 0x0401, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"velocity_demand_value", 0xF01B, PARAMETER_INT32, READ_ONLY, false, 1, -2147483648, 2147483647},
+        {"velocity_display_unit", 0x047C, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"velocity_factor_den", 0xF066, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"velocity_factor_num", 0xF064, PARAMETER_UNS32, READ_WRITE, true, 1, 1, 4294967295},
+        {"velocity_fb_mapping", 0x0391, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 4},
+        {"velocity_target_reached_detect_enable", 0x03B6, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"velocity_target_reached_window", 0xF01E, PARAMETER_UNS16, READ_WRITE, true, 1, 0, 65535},
+        {"velocity_target_reached_window_time", 0xF01F, PARAMETER_UNS16, READ_WRITE, true, 1, 0, 65535},
+        {"velocity_target_value", 0xF0DA, PARAMETER_INT32, READ_WRITE, false, 1, -2147483648, 2147483647},
+        {"velocity_zero_detect_enable", 0x03B7, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"velocity_zero_window", 0xF020, PARAMETER_UNS16, READ_WRITE, true, 1, 65535, 65535},
+        {"velocity_zero_window_time", 0xF021, PARAMETER_UNS16, READ_WRITE, true, 1, 0, 65535},
+        {"voltage_range_detect_enable", 0x039F, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 1},
+        {"warning_bitmask_segment1", 0x044A, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"warning_bitmask_segment2", 0x044C, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+        {"warning_code_segment1", 0x0450, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"warning_code_segment2", 0x0452, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295},
+        {"zero_pulse_clear_error_enable", 0x019F, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255},
+        {"zero_pulse_elec_angle", 0x02E6, PARAMETER_UNS32, READ_WRITE, true, 1000, 0, 4294967295},
+        {"zero_pulse_output_duration", 0x0480, PARAMETER_UNS32, READ_WRITE, true, 1, 0, 4294967295},
+    }};
+}
@@ -0,0 +1,3558 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief Every register in the MotionG DN1-G60xxN Modbus dictionary.
+ * @details Generated by tools/generate_registers.py from docs/MotionG/Modbus Dictionary.csv.  Do not edit.
+ */
+
+#pragma once
+#include <array>
+
+#include "ReadPlanner.hpp"
+#include "Register.hpp"
+
+namespace MotionG
+{
+    ///@brief 编码器1类型
+    using EncodeType = Register<0x0001, uint8_t, READ_WRITE>;
+    ///@brief 通讯类型
+    using CommType = Register<0x0002, uint8_t, READ_WRITE>;
+    ///@brief 电机运行状态
+    using MotorShowState = Register<0x0003, uint8_t, READ_ONLY>;
+    ///@brief 编码器1当前状态
+    using EncodeState = Register<0x0004, uint8_t, READ_ONLY>;
+    ///@brief 霍尔状态
+    using HallState = Register<0x0005, uint8_t, READ_ONLY>;
+    ///@brief 辨识状态
+    using IndetifyState = Register<0x0006, uint8_t, READ_ONLY>;
+    ///@brief 辨识电流频率
+    using FixCurrentFre = Register<0x0008, uint32_t, READ_WRITE>;
+    ///@brief 辨识电流幅度相对值
+    using FixCurrentAmp = Register<0x000A, uint32_t, READ_WRITE>;
+    ///@brief 机械辨识电机频率
+    using FixMacFre = Register<0x000C, uint32_t, READ_WRITE>;
+    ///@brief 机械辨识电机速度相对值
+    using FixMacSpeed = Register<0x000E, uint32_t, READ_WRITE>;
+    ///@brief 机械辨识电流幅度相对值
+    using FixMacCurrent = Register<0x0010, uint32_t, READ_WRITE>;
+    ///@brief 机械辨识位置限制最大值
+    using FixMacPosP = Register<0x0012, int32_t, READ_WRITE>;
+    ///@brief 机械辨识位置限制最小值
+    using FixMacPosN = Register<0x0014, int32_t, READ_WRITE>;
+    ///@brief 位置环带宽设计值
+    using PosBandwidth = Register<0x0016, uint32_t, READ_WRITE>;
+    ///@brief 电流控制器增益
+    using CurrentBandwidth = Register<0x0018, uint32_t, READ_WRITE>;
+    using TestAmp = Register<0x001A, uint32_t, READ_WRITE>;
+    using TestFre = Register<0x001C, uint32_t, READ_WRITE>;
+    ///@brief 位置速度前馈
+    using SpeedFeedForward = Register<0x001E, uint32_t, READ_WRITE>;
+    ///@brief 位置加速度前馈
+    using AccFeedForward = Register<0x0020, uint32_t, READ_WRITE>;
+    ///@brief 电机相间电感
+    using Inductance = Register<0x0022, uint32_t, READ_WRITE>;
+    ///@brief 电机相间电阻
+    using Resistance = Register<0x0024, uint32_t, READ_WRITE>;
+    ///@brief 电机极对数（旋转电机）
+    using PolarPositives = Register<0x0026, uint32_t, READ_WRITE>;
+    ///@brief 电机转子惯量（旋转电机）
+    using Inertia = Register<0x0028, uint32_t, READ_WRITE>;
+    ///@brief 电机速度阻尼系数
+    using Damping = Register<0x002A, int32_t, READ_WRITE>;
+    ///@brief 电机磁链
+    using Magnetic = Register<0x002C, uint32_t, READ_WRITE>;
+    ///@brief CAN通讯波特率
+    using CanOpenBaudrate = Register<0x002E, uint32_t, READ_WRITE>;
+    ///@brief CAN节点ID
+    using CanOpenId = Register<0x002F, uint8_t, READ_WRITE>;
+    ///@brief 负载端速度误差值
+    using CurSpeedError = Register<0x0031, int32_t, READ_ONLY>;
+    ///@brief 电流误差值
+    using CurCurrentError = Register<0x0033, int32_t, READ_ONLY>;
+    ///@brief 驱动器温度
+    using DeviceTemp = Register<0x0035, int32_t, READ_ONLY>;
+    ///@brief 电机过载电流持续时间
+    using MaxCurrentTime = Register<0x0037, uint32_t, READ_WRITE>;
+    ///@brief 电机堵转检测阈值时间
+    using MotorBlockTimer = Register<0x0039, uint32_t, READ_WRITE>;
+    using HardwareVolMaxLimit = Register<0x003B, uint32_t, READ_WRITE>;
+    using HardwareVolMinLimit = Register<0x003D, uint32_t, READ_WRITE>;
+    ///@brief 电机峰值电流
+    using HardwareCurMaxLimit = Register<0x003F, uint32_t, READ_WRITE>;
+    ///@brief 电机温度
+    using MotorTemp = Register<0x0041, int32_t, READ_ONLY>;
+    ///@brief 速度观测器带宽
+    using SpeedObserveBandwith = Register<0x0043, uint32_t, READ_WRITE>;
+    ///@brief 静摩擦对应的力矩电流
+    using StaticFriction = Register<0x0045, uint32_t, READ_WRITE>;
+    ///@brief 霍尔类型
+    using CiaHallType = Register<0x0046, uint8_t, READ_WRITE>;
+    ///@brief 电机转矩常数（旋转电机）
+    using TorqueConstant = Register<0x0048, uint32_t, READ_WRITE>;
+    ///@brief 平滑系数
+    using SmoothFactor = Register<0x004A, uint32_t, READ_WRITE>;
+    ///@brief 应用位置限制开关
+    using PositionLimitEnable = Register<0x004B, uint8_t, READ_WRITE>;
+    ///@brief 过速检测开关
+    using SpeedMaxLimitEnable = Register<0x004C, uint8_t, READ_WRITE>;
+    ///@brief 编码器2类型
+    using OutLoopEncoderType = Register<0x004D, uint8_t, READ_WRITE>;
+    ///@brief 编码器2单圈有效分辨率脉冲数
+    using OutLoopEncoderResolution = Register<0x004F, uint32_t, READ_WRITE>;
+    ///@brief STO功能开关
+    using STO1Enable = Register<0x0050, uint8_t, READ_WRITE>;
+    ///@brief 驱动器高温报错阈值
+    using DeviceMaxTemp = Register<0x0052, int32_t, READ_WRITE>;
+    ///@brief 驱动器低温报错阈值
+    using DeviceMinTemp = Register<0x0054, int32_t, READ_WRITE>;
+    ///@brief 电机高温报错阈值
+    using MotorMaxTemp = Register<0x0056, int32_t, READ_WRITE>;
+    ///@brief 驱动器高温警告阈值
+    using DeviceWarningTemp = Register<0x0058, int32_t, READ_WRITE>;
+    ///@brief 编码器1多圈硬件分辨率脉冲数
+    using Encoder1MulRes = Register<0x005A, uint32_t, READ_WRITE>;
+    ///@brief 编码器2多圈硬件分辨率脉冲数
+    using Encoder2MulRes = Register<0x005C, uint32_t, READ_WRITE>;
+    ///@brief 编码器1通讯波特率
+    using Encoder1Baudrate = Register<0x005E, uint32_t, READ_WRITE>;
+    ///@brief 编码器2通讯波特率
+    using Encoder2Baudrate = Register<0x0060, uint32_t, READ_WRITE>;
+    ///@brief 编码器1通讯零位
+    using Encoder1Zerobits = Register<0x0061, uint8_t, READ_WRITE>;
+    ///@brief 编码器2通讯零位
+    using Encoder2Zerobits = Register<0x0062, uint8_t, READ_WRITE>;
+    ///@brief 正极限开关检测开关
+    using PSWProtectEnable = Register<0x0063, uint8_t, READ_WRITE>;
+    ///@brief 负极限开关检测开关
+    using NSWProtectEnable = Register<0x0064, uint8_t, READ_WRITE>;
+    using RepetitiveEnable = Register<0x0065, uint8_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_0 = Register<0x0067, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_1 = Register<0x0069, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_2 = Register<0x006B, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_3 = Register<0x006D, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_4 = Register<0x006F, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_5 = Register<0x0071, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_6 = Register<0x0073, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_7 = Register<0x0075, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_8 = Register<0x0077, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_9 = Register<0x0079, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_10 = Register<0x007B, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_11 = Register<0x007D, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_12 = Register<0x007F, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_13 = Register<0x0081, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_14 = Register<0x0083, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_15 = Register<0x0085, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_16 = Register<0x0087, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_17 = Register<0x0089, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_18 = Register<0x008B, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_19 = Register<0x008D, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_20 = Register<0x008F, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_21 = Register<0x0091, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_22 = Register<0x0093, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_23 = Register<0x0095, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_24 = Register<0x0097, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_25 = Register<0x0099, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_26 = Register<0x009B, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_27 = Register<0x009D, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_28 = Register<0x009F, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_29 = Register<0x00A1, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_30 = Register<0x00A3, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_31 = Register<0x00A5, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_32 = Register<0x00A7, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_33 = Register<0x00A9, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_34 = Register<0x00AB, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_35 = Register<0x00AD, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_36 = Register<0x00AF, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_37 = Register<0x00B1, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_38 = Register<0x00B3, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_39 = Register<0x00B5, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_40 = Register<0x00B7, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_41 = Register<0x00B9, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_42 = Register<0x00BB, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_43 = Register<0x00BD, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_44 = Register<0x00BF, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_45 = Register<0x00C1, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_46 = Register<0x00C3, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_47 = Register<0x00C5, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_48 = Register<0x00C7, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_49 = Register<0x00C9, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_50 = Register<0x00CB, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_51 = Register<0x00CD, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_52 = Register<0x00CF, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_53 = Register<0x00D1, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_54 = Register<0x00D3, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_55 = Register<0x00D5, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_56 = Register<0x00D7, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_57 = Register<0x00D9, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_58 = Register<0x00DB, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_59 = Register<0x00DD, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_60 = Register<0x00DF, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_61 = Register<0x00E1, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_62 = Register<0x00E3, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_63 = Register<0x00E5, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_64 = Register<0x00E7, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_65 = Register<0x00E9, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_66 = Register<0x00EB, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_67 = Register<0x00ED, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_68 = Register<0x00EF, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_69 = Register<0x00F1, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_70 = Register<0x00F3, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_71 = Register<0x00F5, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_72 = Register<0x00F7, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_73 = Register<0x00F9, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_74 = Register<0x00FB, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_75 = Register<0x00FD, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_76 = Register<0x00FF, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_77 = Register<0x0101, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_78 = Register<0x0103, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_79 = Register<0x0105, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_80 = Register<0x0107, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_81 = Register<0x0109, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_82 = Register<0x010B, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_83 = Register<0x010D, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_84 = Register<0x010F, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_85 = Register<0x0111, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_86 = Register<0x0113, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_87 = Register<0x0115, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_88 = Register<0x0117, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_89 = Register<0x0119, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_90 = Register<0x011B, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_91 = Register<0x011D, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_92 = Register<0x011F, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_93 = Register<0x0121, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_94 = Register<0x0123, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_95 = Register<0x0125, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_96 = Register<0x0127, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_97 = Register<0x0129, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_98 = Register<0x012B, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_99 = Register<0x012D, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_100 = Register<0x012F, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_101 = Register<0x0131, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_102 = Register<0x0133, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_103 = Register<0x0135, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_104 = Register<0x0137, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_105 = Register<0x0139, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_106 = Register<0x013B, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_107 = Register<0x013D, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_108 = Register<0x013F, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_109 = Register<0x0141, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_110 = Register<0x0143, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_111 = Register<0x0145, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_112 = Register<0x0147, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_113 = Register<0x0149, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_114 = Register<0x014B, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_115 = Register<0x014D, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_116 = Register<0x014F, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_117 = Register<0x0151, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_118 = Register<0x0153, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_119 = Register<0x0155, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_120 = Register<0x0157, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_121 = Register<0x0159, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_122 = Register<0x015B, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_123 = Register<0x015D, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_124 = Register<0x015F, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_125 = Register<0x0161, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_126 = Register<0x0163, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_127 = Register<0x0165, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_128 = Register<0x0167, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存
+    using TargetPositionBuff_129 = Register<0x0169, int32_t, READ_WRITE>;
+    ///@brief 目标位置缓存个数
+    using TargetPostionBuffNum = Register<0x016B, uint32_t, READ_WRITE>;
+    ///@brief 惯量自适应增益
+    using InertiaAdaptiveGain = Register<0x016D, uint32_t, READ_WRITE>;
+    ///@brief 惯量自适应低通滤波截止频率
+    using InertiaAdaptiveLPFHZ = Register<0x016F, uint32_t, READ_WRITE>;
+    using NumberOfPhaseIIT = Register<0x0171, uint32_t, READ_WRITE>;
+    ///@brief 编码器1应答位数
+    using Encoder1Ackbits = Register<0x0172, uint8_t, READ_WRITE>;
+    ///@brief 编码器1错误警告位数
+    using Encoder1ErrorWarnBits = Register<0x0173, uint8_t, READ_WRITE>;
+    ///@brief 编码器1CRC校验位数
+    using Encoder1CrcBits = Register<0x0174, uint8_t, READ_WRITE>;
+    ///@brief 编码器1CRC校验多项式
+    using Encoder1CrcPoly = Register<0x0176, uint32_t, READ_WRITE>;
+    ///@brief 编码器1错误应答电平
+    using Encoder1ErrorActiveLevel = Register<0x0177, uint8_t, READ_WRITE>;
+    ///@brief 编码器1数据编码格式
+    using Encoder1SensorDataPresentation = Register<0x0178, uint8_t, READ_WRITE>;
+    ///@brief 编码器2应答位数
+    using Encoder2Ackbits = Register<0x0179, uint8_t, READ_WRITE>;
+    ///@brief 编码器2错误警告位数
+    using Encoder2ErrorWarnBits = Register<0x017A, uint8_t, READ_WRITE>;
+    ///@brief 编码器2CRC校验位数
+    using Encoder2CrcBits = Register<0x017B, uint8_t, READ_WRITE>;
+    ///@brief 编码器2CRC校验多项式
+    using Encoder2CrcPoly = Register<0x017D, uint32_t, READ_WRITE>;
+    ///@brief 编码器2错误应答电平
+    using Encoder2ErrorActiveLevel = Register<0x017E, uint8_t, READ_WRITE>;
+    ///@brief 编码器2数据编码格式
+    using Encoder2SensorDataPresentation = Register<0x017F, uint8_t, READ_WRITE>;
+    using SpeedMeasurementCycle = Register<0x0181, uint32_t, READ_WRITE>;
+    ///@brief 转矩脉动补偿开关
+    using TRCEnable = Register<0x0182, uint8_t, READ_WRITE>;
+    ///@brief 摩擦补偿开关
+    using FCEnable = Register<0x0183, uint8_t, READ_WRITE>;
+    ///@brief 极对数辨识运行电周期数
+    using PolePairsIdElecCycles = Register<0x0185, uint32_t, READ_WRITE>;
+    ///@brief 极对数辨识等待稳定时间
+    using PolePairsIdWaitTime = Register<0x0187, uint32_t, READ_WRITE>;
+    ///@brief 方向辨识距离
+    using DirctionIdDistance = Register<0x0189, uint32_t, READ_WRITE>;
+    ///@brief Flash存储状态
+    using FlashStorageStatus = Register<0x018A, uint8_t, READ_ONLY>;
+    ///@brief 电流环运行频率
+    using CurrentLoopFrq = Register<0x018C, uint32_t, READ_WRITE>;
+    ///@brief 位置环运行频率
+    using PositionLoopFrq = Register<0x018E, uint32_t, READ_WRITE>;
+    ///@brief 接口板硬件版本号
+    using InterfaceBoardVersionHW = Register<0x0190, uint32_t, READ_ONLY>;
+    ///@brief 接口板软件版本号
+    using InterfaceBoardVersionSW = Register<0x0192, uint32_t, READ_ONLY>;
+    ///@brief 驱动板硬件版本号
+    using DriverBoardVersionHW = Register<0x0194, uint32_t, READ_ONLY>;
+    ///@brief 驱动板软件版本号
+    using DriverBoardVersionSW = Register<0x0196, uint32_t, READ_ONLY>;
+    ///@brief 回零检测堵转时间
+    using HomingStallTime = Register<0x0198, uint32_t, READ_WRITE>;
+    ///@brief 串行通信编码器错误计数时间窗口
+    using AbsEncoderErrorDetectWin = Register<0x019A, uint32_t, READ_WRITE>;
+    ///@brief 霍尔累计错误计数时间
+    using HallErrorDetectWin = Register<0x019C, uint32_t, READ_WRITE>;
+    ///@brief Z 相位检测误差
+    using ZPhaseDetectError = Register<0x019E, int32_t, READ_ONLY>;
+    using FPCtlEnable = Register<0x019F, uint8_t, READ_WRITE>;
+    using FPCtlMaxForce = Register<0x01A1, uint32_t, READ_WRITE>;
+    using FPCtlForceSlope = Register<0x01A3, uint32_t, READ_WRITE>;
+    using FPCtlMinForce = Register<0x01A5, uint32_t, READ_WRITE>;
+    using FVCtlEnable = Register<0x01A6, uint8_t, READ_WRITE>;
+    using FVCtlMaxForce = Register<0x01A8, uint32_t, READ_WRITE>;
+    using FVCtlForceSlope = Register<0x01AA, uint32_t, READ_WRITE>;
+    using FVCtlMinForce = Register<0x01AC, uint32_t, READ_WRITE>;
+    using CurrentLoopCtlSpeedMax = Register<0x01AE, uint32_t, READ_WRITE>;
+    ///@brief 电机端位置当前值
+    using OutloopPositionActualValue = Register<0x01B0, int32_t, READ_ONLY>;
+    ///@brief 电机端位置误差值
+    using OutloopFollowingError = Register<0x01B2, int32_t, READ_ONLY>;
+    ///@brief 电机端速度当前值
+    using OutloopSpeedActualValue = Register<0x01B4, int32_t, READ_ONLY>;
+    ///@brief 电机端速度误差值
+    using OutloopSpeedError = Register<0x01B6, int32_t, READ_ONLY>;
+    using ReductionRatioNumerator = Register<0x01B8, uint32_t, READ_WRITE>;
+    using ReductionRatioDenominator = Register<0x01BA, uint32_t, READ_WRITE>;
+    ///@brief ADC1电压范围
+    using ADC1VoltageRange = Register<0x01BB, uint8_t, READ_WRITE>;
+    ///@brief ADC2电压范围
+    using ADC2VoltageRange = Register<0x01BC, uint8_t, READ_WRITE>;
+    ///@brief U相电流当前值
+    using PhaseCurrent_U = Register<0x01BE, int32_t, READ_ONLY>;
+    ///@brief V相电流当前值
+    using PhaseCurrent_V = Register<0x01C0, int32_t, READ_ONLY>;
+    ///@brief W相电流当前值
+    using PhaseCurrent_W = Register<0x01C2, int32_t, READ_ONLY>;
+    using PhaseVoltage_U = Register<0x01C4, int32_t, READ_ONLY>;
+    using PhaseVoltage_V = Register<0x01C6, int32_t, READ_ONLY>;
+    using PhaseVoltage_W = Register<0x01C8, int32_t, READ_ONLY>;
+    ///@brief 参考信号类型
+    using ReferenceSignalType = Register<0x01C9, uint8_t, READ_WRITE>;
+    using ReferenceSignalRejectCmd = Register<0x01CA, uint8_t, READ_WRITE>;
+    ///@brief 参考信号幅值
+    using PositionReferenceSignal_Amplitude = Register<0x01CC, int32_t, READ_WRITE>;
+    ///@brief 参考信号频率
+    using PositionReferenceSignal_Frequency = Register<0x01CE, uint32_t, READ_WRITE>;
+    ///@brief 参考信号偏移
+    using PositionReferenceSignal_Offset = Register<0x01D0, int32_t, READ_WRITE>;
+    ///@brief 参考信号斜率
+    using PositionReferenceSignal_Slope = Register<0x01D2, int32_t, READ_WRITE>;
+    using VelocityReferenceSignal_Amplitude = Register<0x01D4, int32_t, READ_WRITE>;
+    using VelocityReferenceSignal_Frequency = Register<0x01D6, uint32_t, READ_WRITE>;
+    using VelocityReferenceSignal_Offset = Register<0x01D8, int32_t, READ_WRITE>;
+    using VelocityReferenceSignal_Slope = Register<0x01DA, int32_t, READ_WRITE>;
+    using TorqueReferenceSignal_Amplitude = Register<0x01DB, int16_t, READ_WRITE>;
+    using TorqueReferenceSignal_Frequency = Register<0x01DD, uint32_t, READ_WRITE>;
+    using TorqueReferenceSignal_Offset = Register<0x01DE, int16_t, READ_WRITE>;
+    using TorqueReferenceSignal_Slope = Register<0x01DF, int16_t, READ_WRITE>;
+    using SampleSwitchChannel0 = Register<0x01E0, uint8_t, READ_WRITE>;
+    using SampleSwitchChannel1 = Register<0x01E1, uint8_t, READ_WRITE>;
+    using SampleSwitchChannel2 = Register<0x01E2, uint8_t, READ_WRITE>;
+    using SampleSwitchChannel3 = Register<0x01E3, uint8_t, READ_WRITE>;
+    using SampleSwitchChannel4 = Register<0x01E4, uint8_t, READ_WRITE>;
+    using SampleSwitchChannel5 = Register<0x01E5, uint8_t, READ_WRITE>;
+    using SampleSwitchChannel6 = Register<0x01E6, uint8_t, READ_WRITE>;
+    using SampleSwitchChannel7 = Register<0x01E7, uint8_t, READ_WRITE>;
+    using UsbFrameCountChannel0 = Register<0x01E9, uint32_t, READ_ONLY>;
+    using UsbFrameCountChannel1 = Register<0x01EB, uint32_t, READ_ONLY>;
+    using UsbFrameCountChannel2 = Register<0x01ED, uint32_t, READ_ONLY>;
+    using UsbFrameCountChannel3 = Register<0x01EF, uint32_t, READ_ONLY>;
+    using UsbFrameCountChannel4 = Register<0x01F1, uint32_t, READ_ONLY>;
+    using UsbFrameCountChannel5 = Register<0x01F3, uint32_t, READ_ONLY>;
+    using UsbFrameCountChannel6 = Register<0x01F5, uint32_t, READ_ONLY>;
+    using UsbFrameCountChannel7 = Register<0x01F7, uint32_t, READ_ONLY>;
+    using SampledTriggerSignal = Register<0x01F8, uint8_t, READ_WRITE>;
+    using SampledTriggerMethod = Register<0x01F9, uint8_t, READ_WRITE>;
+    using SampledTriggerDirection = Register<0x01FA, uint8_t, READ_WRITE>;
+    using SampledTriggerDelay = Register<0x01FB, uint8_t, READ_WRITE>;
+    using SampledTriggerThreshold = Register<0x01FD, int32_t, READ_WRITE>;
+    using SampledResolution = Register<0x01FF, uint32_t, READ_WRITE>;
+    using SampleRecordTime = Register<0x0201, uint32_t, READ_WRITE>;
+    using SampleDataType = Register<0x0203, uint32_t, READ_WRITE>;
+    using DataSampleCmd = Register<0x0204, uint8_t, READ_WRITE>;
+    using DataSampleStatus = Register<0x0205, uint8_t, READ_ONLY>;
+    ///@brief 弱磁控制电流
+    using FieldWeakeningControlCurrent = Register<0x0207, int32_t, READ_WRITE>;
+    ///@brief 驱动器温度保护阈值时间
+    using DeviceTempProtectTimeWindow = Register<0x0209, uint32_t, READ_WRITE>;
+    ///@brief 力-位置阻抗控制系数K
+    using ImpedanceControl_K = Register<0x020B, int32_t, READ_WRITE>;
+    ///@brief 力-位置阻抗控制系数B
+    using ImpedanceControl_B = Register<0x020D, int32_t, READ_WRITE>;
+    ///@brief 力-位置阻抗控制系数M
+    using ImpedanceControl_M = Register<0x020F, int32_t, READ_WRITE>;
+    ///@brief 产品代号
+    using ProductCode = Register<0x0211, uint32_t, READ_ONLY>;
+    ///@brief 编码器2当前状态
+    using Encoder2State = Register<0x0212, uint8_t, READ_ONLY>;
+    using ExternalADC1RawData = Register<0x0214, int32_t, READ_ONLY>;
+    ///@brief ADC1原始数据当前值
+    using ExternalADC2RawData = Register<0x0216, int32_t, READ_ONLY>;
+    ///@brief ADC2原始数据当前值
+    using TargetPressure = Register<0x0218, int32_t, READ_WRITE>;
+    ///@brief 负载力矩反馈当前值
+    using EstimatedLoadTorqueCurrent = Register<0x021A, int32_t, READ_ONLY>;
+    ///@brief 力传感器数据来源
+    using ForceControlSensorType = Register<0x021B, uint8_t, READ_WRITE>;
+    ///@brief 力控模式
+    using ForceControlMode = Register<0x021C, uint8_t, READ_WRITE>;
+    ///@brief 力控制周期
+    using ForceControlCycle = Register<0x021E, uint32_t, READ_WRITE>;
+    ///@brief 力-位置导纳控制系数K
+    using AdmittanceControl_K = Register<0x0220, int32_t, READ_WRITE>;
+    ///@brief 力-位置导纳控制系数B
+    using AdmittanceControl_B = Register<0x0222, int32_t, READ_WRITE>;
+    ///@brief 力-位置导纳控制系数M
+    using AdmittanceControl_M = Register<0x0224, int32_t, READ_WRITE>;
+    ///@brief 力传感器低通滤波截止频率
+    using ForceSensorLPFCutOffFrq = Register<0x0226, uint32_t, READ_WRITE>;
+    ///@brief 力传感器采样偏移
+    using ForceSensorSamplingOffset = Register<0x0228, int32_t, READ_WRITE>;
+    ///@brief 力传感器方向
+    using ForceSensorDirection = Register<0x0229, int8_t, READ_WRITE>;
+    ///@brief 力控参数单位
+    using ForceSpaceParaUnit = Register<0x022B, uint32_t, READ_WRITE>;
+    ///@brief 电流环带宽设计值
+    using CurrentLoopDesignBW = Register<0x022D, uint32_t, READ_ONLY>;
+    using CurrentLoopEvaluationBW = Register<0x022F, uint32_t, READ_ONLY>;
+    ///@brief 电流环控制算法
+    using CurrentLoopControlMode = Register<0x0230, uint8_t, READ_WRITE>;
+    ///@brief 电机端位置反馈方向
+    using EncoderDirection_0 = Register<0x0231, int8_t, READ_WRITE>;
+    ///@brief 电机端位置反馈方向
+    using EncoderDirection_1 = Register<0x0232, int8_t, READ_WRITE>;
+    ///@brief 电机端位置反馈方向
+    using EncoderDirection_2 = Register<0x0233, int8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_0 = Register<0x0234, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_1 = Register<0x0235, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_2 = Register<0x0236, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_3 = Register<0x0237, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_4 = Register<0x0238, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_5 = Register<0x0239, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_6 = Register<0x023A, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_7 = Register<0x023B, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_8 = Register<0x023C, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_9 = Register<0x023D, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_10 = Register<0x023E, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_11 = Register<0x023F, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_12 = Register<0x0240, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_13 = Register<0x0241, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_14 = Register<0x0242, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_15 = Register<0x0243, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_16 = Register<0x0244, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_17 = Register<0x0245, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_18 = Register<0x0246, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_19 = Register<0x0247, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_20 = Register<0x0248, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_21 = Register<0x0249, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_22 = Register<0x024A, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_23 = Register<0x024B, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_24 = Register<0x024C, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_25 = Register<0x024D, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_26 = Register<0x024E, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_27 = Register<0x024F, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_28 = Register<0x0250, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_29 = Register<0x0251, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_30 = Register<0x0252, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_31 = Register<0x0253, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入上升沿触发事件表
+    using IOInputRisingEdgeTriggerEvent_32 = Register<0x0254, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_0 = Register<0x0255, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_1 = Register<0x0256, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_2 = Register<0x0257, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_3 = Register<0x0258, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_4 = Register<0x0259, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_6 = Register<0x025B, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_7 = Register<0x025C, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_8 = Register<0x025D, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_9 = Register<0x025E, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_10 = Register<0x025F, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_11 = Register<0x0260, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_12 = Register<0x0261, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_13 = Register<0x0262, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_14 = Register<0x0263, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_15 = Register<0x0264, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_16 = Register<0x0265, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_17 = Register<0x0266, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_18 = Register<0x0267, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_19 = Register<0x0268, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_20 = Register<0x0269, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_21 = Register<0x026A, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_22 = Register<0x026B, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_23 = Register<0x026C, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_24 = Register<0x026D, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_25 = Register<0x026E, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_26 = Register<0x026F, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_27 = Register<0x0270, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_28 = Register<0x0271, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_29 = Register<0x0272, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_30 = Register<0x0273, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_31 = Register<0x0274, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入下降沿触发事件表
+    using IOInputFallingEdgeTriggerEvent_32 = Register<0x0275, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_0 = Register<0x0276, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_1 = Register<0x0277, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_2 = Register<0x0278, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_3 = Register<0x0279, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_4 = Register<0x027A, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_5 = Register<0x027B, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_6 = Register<0x027C, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_7 = Register<0x027D, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_8 = Register<0x027E, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_9 = Register<0x027F, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_10 = Register<0x0280, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_11 = Register<0x0281, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_12 = Register<0x0282, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_13 = Register<0x0283, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_14 = Register<0x0284, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_15 = Register<0x0285, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_16 = Register<0x0286, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_17 = Register<0x0287, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_18 = Register<0x0288, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_19 = Register<0x0289, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_20 = Register<0x028A, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_21 = Register<0x028B, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_22 = Register<0x028C, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_23 = Register<0x028D, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_24 = Register<0x028E, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_25 = Register<0x028F, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_26 = Register<0x0290, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_27 = Register<0x0291, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_28 = Register<0x0292, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_29 = Register<0x0293, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_30 = Register<0x0294, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_31 = Register<0x0295, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输入滤波时间
+    using IOInputFilterTime_32 = Register<0x0296, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_0 = Register<0x0297, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_1 = Register<0x0298, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_2 = Register<0x0299, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_3 = Register<0x029A, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_4 = Register<0x029B, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_5 = Register<0x029C, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_6 = Register<0x029D, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_7 = Register<0x029E, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_8 = Register<0x029F, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_9 = Register<0x02A0, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_10 = Register<0x02A1, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_11 = Register<0x02A2, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_12 = Register<0x02A3, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_13 = Register<0x02A4, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_14 = Register<0x02A5, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_15 = Register<0x02A6, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_16 = Register<0x02A7, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_17 = Register<0x02A8, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_18 = Register<0x02A9, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_19 = Register<0x02AA, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_20 = Register<0x02AB, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_21 = Register<0x02AC, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_22 = Register<0x02AD, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_23 = Register<0x02AE, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_24 = Register<0x02AF, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_25 = Register<0x02B0, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_26 = Register<0x02B1, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_27 = Register<0x02B2, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_28 = Register<0x02B3, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_29 = Register<0x02B4, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_30 = Register<0x02B5, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_31 = Register<0x02B6, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出监视事件
+    using IOOutputMonitoringEvent_32 = Register<0x02B7, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_0 = Register<0x02B8, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_1 = Register<0x02B9, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_2 = Register<0x02BA, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_3 = Register<0x02BB, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_4 = Register<0x02BC, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_5 = Register<0x02BD, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_6 = Register<0x02BE, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_7 = Register<0x02BF, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_8 = Register<0x02C0, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_9 = Register<0x02C1, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_10 = Register<0x02C2, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_11 = Register<0x02C3, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_12 = Register<0x02C4, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_13 = Register<0x02C5, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_14 = Register<0x02C6, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_15 = Register<0x02C7, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_16 = Register<0x02C8, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_17 = Register<0x02C9, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_18 = Register<0x02CA, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_19 = Register<0x02CB, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_20 = Register<0x02CC, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_21 = Register<0x02CD, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_22 = Register<0x02CE, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_23 = Register<0x02CF, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_24 = Register<0x02D0, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_25 = Register<0x02D1, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_26 = Register<0x02D2, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_27 = Register<0x02D3, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_28 = Register<0x02D4, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_29 = Register<0x02D5, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_30 = Register<0x02D6, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_31 = Register<0x02D7, uint8_t, READ_WRITE>;
+    ///@brief 数字IO输出极性（上升下降沿）
+    using EventTriggeredIOOutputStatus_32 = Register<0x02D8, uint8_t, READ_WRITE>;
+    using PulseControlSpeed_EnableFlag = Register<0x02D9, uint8_t, READ_WRITE>;
+    ///@brief PWM捕获周期测滤波时间
+    using PulseControlSpeed_FilterTime = Register<0x02DA, uint8_t, READ_WRITE>;
+    ///@brief PWM捕获周期降低分辨率
+    using PulseControlSpeed_Resolution = Register<0x02DB, uint8_t, READ_WRITE>;
+    ///@brief 霍尔状态对应电角度表
+    using HallStateElecAngle_0 = Register<0x02DC, uint8_t, READ_WRITE>;
+    ///@brief 霍尔状态对应电角度表
+    using HallStateElecAngle_1 = Register<0x02DD, uint8_t, READ_WRITE>;
+    ///@brief 霍尔状态对应电角度表
+    using HallStateElecAngle_2 = Register<0x02DE, uint8_t, READ_WRITE>;
+    ///@brief 霍尔状态对应电角度表
+    using HallStateElecAngle_3 = Register<0x02DF, uint8_t, READ_WRITE>;
+    ///@brief 霍尔状态对应电角度表
+    using HallStateElecAngle_4 = Register<0x02E0, uint8_t, READ_WRITE>;
+    ///@brief 霍尔状态对应电角度表
+    using HallStateElecAngle_5 = Register<0x02E1, uint8_t, READ_WRITE>;
+    ///@brief 霍尔状态对应电角度表
+    using HallStateElecAngle_6 = Register<0x02E2, uint8_t, READ_WRITE>;
+    ///@brief 霍尔状态对应电角度表
+    using HallStateElecAngle_7 = Register<0x02E3, uint8_t, READ_WRITE>;
+    ///@brief 霍尔状态对应电角度表
+    using HallStateElecAngle_8 = Register<0x02E4, uint8_t, READ_WRITE>;
+    ///@brief Z相对应电角度
+    using ZPhaseElecAngle = Register<0x02E6, uint32_t, READ_WRITE>;
+    ///@brief 电角度偏移值
+    using ElecAngleOffsetValue = Register<0x02E8, uint32_t, READ_WRITE>;
+    ///@brief 电机热量累计值
+    using MotorCumulativeHeat = Register<0x02EA, uint32_t, READ_ONLY>;
+    ///@brief PWM控制基础频率
+    using PwmCtlSpeedBasicFrq = Register<0x02EC, uint32_t, READ_WRITE>;
+    using AnalogCtlSpeedEnable = Register<0x02ED, uint8_t, READ_WRITE>;
+    ///@brief 模拟量控制信号源
+    using AnalogCtlSpeedADCSource = Register<0x02EE, uint8_t, READ_WRITE>;
+    ///@brief ADC1降低分辨率
+    using ExtADC1ReduceResolution = Register<0x02F0, uint32_t, READ_WRITE>;
+    ///@brief ADC2降低分辨率
+    using ExtADC2ReduceResolution = Register<0x02F2, uint32_t, READ_WRITE>;
+    ///@brief 支持的通讯类型
+    using HardwareCommunicationType = Register<0x02F3, uint8_t, READ_ONLY>;
+    ///@brief 支持的位置反馈类型
+    using HardwareFeedbackType = Register<0x02F4, uint8_t, READ_ONLY>;
+    ///@brief 电机抱闸制动速度阀值
+    using BreakSetting_activation_velocity = Register<0x02F6, uint32_t, READ_WRITE>;
+    ///@brief 电机抱闸机械释放时间
+    using BreakSetting_disengage_time = Register<0x02F8, uint32_t, READ_WRITE>;
+    ///@brief 电机抱闸机械制动时间
+    using BreakSetting_engage_time = Register<0x02FA, uint32_t, READ_WRITE>;
+    ///@brief 电机抱闸控制模式
+    using BreakSetting_enable = Register<0x02FB, uint8_t, READ_WRITE>;
+    ///@brief 电机抱闸释放软件延迟时间
+    using BreakSetting_disengage_software_delay_time = Register<0x02FD, uint32_t, READ_WRITE>;
+    ///@brief 电机抱闸制动软件延迟时间
+    using BreakSetting_engage_software_delay_time = Register<0x02FF, uint32_t, READ_WRITE>;
+    ///@brief 电机抱闸制动时间阈值
+    using BreakSetting_activation_delay_time = Register<0x0301, uint32_t, READ_WRITE>;
+    using HWSnNumber_0 = Register<0x0302, uint8_t, READ_ONLY>;
+    using HWSnNumber_1 = Register<0x0303, uint8_t, READ_ONLY>;
+    using HWSnNumber_2 = Register<0x0304, uint8_t, READ_ONLY>;
+    using HWSnNumber_3 = Register<0x0305, uint8_t, READ_ONLY>;
+    using HWSnNumber_4 = Register<0x0306, uint8_t, READ_ONLY>;
+    using HWSnNumber_5 = Register<0x0307, uint8_t, READ_ONLY>;
+    using HWSnNumber_6 = Register<0x0308, uint8_t, READ_ONLY>;
+    using HWSnNumber_7 = Register<0x0309, uint8_t, READ_ONLY>;
+    using HWSnNumber_8 = Register<0x030A, uint8_t, READ_ONLY>;
+    using CurrentSamplingResistance = Register<0x030C, uint32_t, READ_ONLY>;
+    using BodeDiagram_ScanFrequency = Register<0x030E, uint32_t, READ_WRITE>;
+    using BodeDiagram_ExcitationSignalAmplitude = Register<0x0310, uint32_t, READ_WRITE>;
+    using BodeDiagram_NumberOfScanningPoints = Register<0x0312, uint32_t, READ_WRITE>;
+    using BodeDiagram_ScanStartCommand = Register<0x0313, uint8_t, READ_WRITE>;
+    using BodeDiagram_ScanCompletionFlag = Register<0x0314, uint8_t, READ_WRITE>;
+    ///@brief 系统性能评估模式
+    using BodeDiagram_ScanMode = Register<0x0315, uint8_t, READ_WRITE>;
+    using PulsePositionControl_Enable = Register<0x0316, uint8_t, READ_WRITE>;
+    ///@brief 脉冲捕获信号模式
+    using PulsePositionControl_Mode = Register<0x0317, uint8_t, READ_WRITE>;
+    ///@brief 死区补偿开关
+    using DeadZoneCompensationEnable = Register<0x0318, uint8_t, READ_WRITE>;
+    ///@brief ADC1采样偏移值
+    using ADCSamplingOffset_ADC1 = Register<0x031A, int32_t, READ_WRITE>;
+    ///@brief ADC2采样偏移值
+    using ADCSamplingOffset_ADC2 = Register<0x031C, int32_t, READ_WRITE>;
+    using NooAppParameters_RunningSpeed = Register<0x031E, uint32_t, READ_WRITE>;
+    using NooAppParameters_UpwardPosition = Register<0x0320, int32_t, READ_WRITE>;
+    using NooAppParameters_DownwardPosition = Register<0x0322, int32_t, READ_WRITE>;
+    using NooAppParameters_PressureHoldingTime = Register<0x0324, uint32_t, READ_WRITE>;
+    using NooAppParameters_PressureReachesFlag = Register<0x0325, uint8_t, READ_ONLY>;
+    using NooAppParameters_AutomaticRunEnable = Register<0x0326, uint8_t, READ_WRITE>;
+    using NooAppParameters_TopWaitingTime = Register<0x0328, uint32_t, READ_WRITE>;
+    ///@brief 力控阈值最大值
+    using PressureProtectionValue_Max = Register<0x032A, int32_t, READ_WRITE>;
+    ///@brief 力控阈值最小值
+    using PressureProtectionValue_Min = Register<0x032C, int32_t, READ_WRITE>;
+    using TorqueRippleWeiChuang_OffsetCurrentCompensation = Register<0x032E, int32_t, READ_WRITE>;
+    using TorqueRippleWeiChuang_SpeedJudgmentThreshold = Register<0x0330, int32_t, READ_WRITE>;
+    using TorqueRippleWeiChuang_VelocityAdmittanceCoefficient = Register<0x0332, int32_t, READ_WRITE>;
+    using TorqueRippleWeiChuang_MaximumCompensationCurrent = Register<0x0334, int32_t, READ_WRITE>;
+    ///@brief 驱动器过载电流
+    using DriveOverloadProtection_RatedCurrent = Register<0x0336, uint32_t, READ_WRITE>;
+    using DriveOverloadProtection_PeakCurrent = Register<0x0338, uint32_t, READ_ONLY>;
+    ///@brief 驱动器峰值电流持续时间
+    using DriveOverloadProtection_PeakCurrentDuration = Register<0x033A, uint32_t, READ_WRITE>;
+    ///@brief 驱动器过载电流持续时间
+    using DriveOverloadProtection_OverloadProtectionTime = Register<0x033C, uint32_t, READ_WRITE>;
+    ///@brief 编码器1硬件单圈分辨率（p）
+    using Encoder1HardwareSingleturnResolution = Register<0x033E, uint32_t, READ_WRITE>;
+    ///@brief 编码器1控制字状态
+    using Encoder1AbsCdsState = Register<0x033F, uint8_t, READ_WRITE>;
+    ///@brief 编码器1协议数据总位数（bit）
+    using Encoder1ProtocolTotalBits = Register<0x0340, uint8_t, READ_WRITE>;
+    ///@brief 编码器1位置数据LSB位置（bit）
+    using Encoder1PositionLsbBitNb = Register<0x0341, uint8_t, READ_WRITE>;
+    ///@brief 编码器1数据高位忽略位数（bit）
+    using Encoder1HighMaskBits = Register<0x0342, uint8_t, READ_WRITE>;
+    ///@brief 编码器1错误位位置（bit）
+    using Encoder1ErrorBitNb = Register<0x0343, uint8_t, READ_WRITE>;
+    ///@brief 编码器1数据轮询时间（TS）
+    using Encoder1DataPollingTime = Register<0x0344, uint8_t, READ_WRITE>;
+    ///@brief 编码器1温度
+    using Encoder1Temperature = Register<0x0345, uint8_t, READ_ONLY>;
+    ///@brief 编码器1温度保护阈值
+    using Encoder1TempProtectValue = Register<0x0346, uint8_t, READ_WRITE>;
+    using Encoder1ParameterReserved0 = Register<0x0348, uint32_t, READ_WRITE>;
+    using Encoder1ParameterReserved1 = Register<0x0349, uint8_t, READ_WRITE>;
+    using Encoder1ParameterReserved2 = Register<0x034A, uint8_t, READ_WRITE>;
+    using Encoder1ParameterReserved3 = Register<0x034B, uint8_t, READ_WRITE>;
+    using Encoder1ParameterReserved4 = Register<0x034C, uint8_t, READ_WRITE>;
+    ///@brief 编码器2硬件单圈分辨率（p）
+    using Encoder2HardwareSingleturnResolution = Register<0x034E, uint32_t, READ_WRITE>;
+    ///@brief 编码器2控制字状态
+    using Encoder2AbsCdsState = Register<0x034F, uint8_t, READ_WRITE>;
+    ///@brief 编码器2协议数据总位数（bit）
+    using Encoder2ProtocolTotalBits = Register<0x0350, uint8_t, READ_WRITE>;
+    ///@brief 编码器2位置数据LSB位置（bit）
+    using Encoder2PositionLsbBitNb = Register<0x0351, uint8_t, READ_WRITE>;
+    ///@brief 编码器2数据高位忽略位数（bit）
+    using Encoder2HighMaskBits = Register<0x0352, uint8_t, READ_WRITE>;
+    ///@brief 编码器2错误位位置（bit）
+    using Encoder2ErrorBitNb = Register<0x0353, uint8_t, READ_WRITE>;
+    ///@brief 编码器2数据轮询时间（TS）
+    using Encoder2DataPollingTime = Register<0x0354, uint8_t, READ_WRITE>;
+    ///@brief 编码器2温度
+    using Encoder2Temperature = Register<0x0355, uint8_t, READ_ONLY>;
+    ///@brief 编码器2温度保护阈值
+    using Encoder2TempProtectValue = Register<0x0356, uint8_t, READ_WRITE>;
+    using Encoder2ParameterReserved0 = Register<0x0358, uint32_t, READ_WRITE>;
+    using Encoder2ParameterReserved1 = Register<0x0359, uint8_t, READ_WRITE>;
+    using Encoder2ParameterReserved2 = Register<0x035A, uint8_t, READ_WRITE>;
+    using Encoder2ParameterReserved3 = Register<0x035B, uint8_t, READ_WRITE>;
+    using Encoder2ParameterReserved4 = Register<0x035C, uint8_t, READ_WRITE>;
+    ///@brief 位置反馈映射
+    using SampleCountChannel0 = Register<0x035E, uint32_t, READ_ONLY>;
+    ///@brief 速度反馈映射
+    using SampleCountChannel1 = Register<0x0360, uint32_t, READ_ONLY>;
+    ///@brief 电角度反馈映射
+    using SampleCountChannel2 = Register<0x0362, uint32_t, READ_ONLY>;
+    using SampleCountChannel3 = Register<0x0364, uint32_t, READ_ONLY>;
+    using SampleCountChannel4 = Register<0x0366, uint32_t, READ_ONLY>;
+    using SampleCountChannel5 = Register<0x0368, uint32_t, READ_ONLY>;
+    using SampleCountChannel6 = Register<0x036A, uint32_t, READ_ONLY>;
+    using SampleCountChannel7 = Register<0x036C, uint32_t, READ_ONLY>;
+    using SampleScopeMapChannel0 = Register<0x036E, uint32_t, READ_WRITE>;
+    using SampleScopeMapChannel1 = Register<0x0370, uint32_t, READ_WRITE>;
+    using SampleScopeMapChannel2 = Register<0x0372, uint32_t, READ_WRITE>;
+    using SampleScopeMapChannel3 = Register<0x0374, uint32_t, READ_WRITE>;
+    using SampleScopeMapChannel4 = Register<0x0376, uint32_t, READ_WRITE>;
+    using SampleScopeMapChannel5 = Register<0x0378, uint32_t, READ_WRITE>;
+    using SampleScopeMapChannel6 = Register<0x037A, uint32_t, READ_WRITE>;
+    using SampleScopeMapChannel7 = Register<0x037C, uint32_t, READ_WRITE>;
+    using SampleScopeErrorCode = Register<0x037E, uint32_t, READ_ONLY>;
+    ///@brief 驱动器母线电压上限
+    using DriveBusVoltageUpperLimit = Register<0x0380, uint32_t, READ_ONLY>;
+    ///@brief 驱动器母线电压下限
+    using DriveBusVoltageLowerLimit = Register<0x0382, uint32_t, READ_ONLY>;
+    ///@brief 驱动器峰值电流
+    using DrivePeakCurrent = Register<0x0384, uint32_t, READ_ONLY>;
+    ///@brief 驱动器额定电流
+    using DriveContinuousCurrent = Register<0x0386, uint32_t, READ_ONLY>;
+    ///@brief 电机极对距（直线电机）
+    using MotorPolePairPitch = Register<0x0388, uint32_t, READ_WRITE>;
+    ///@brief 电机力矩常数（直线电机）
+    using MotorForceConstant = Register<0x038A, uint32_t, READ_WRITE>;
+    ///@brief 电机动子质量（直线电机）
+    using MotorMoverMass = Register<0x038C, uint32_t, READ_WRITE>;
+    ///@brief 编码器1单圈有效分辨率脉冲数
+    using Encoder1SingleTurnEffectiveResolution = Register<0x038E, uint32_t, READ_WRITE>;
+    ///@brief 位置环控制算法
+    using PositionLoopControlAlgorithm = Register<0x038F, uint8_t, READ_WRITE>;
+    ///@brief 位置反馈映射
+    using PositionFeedbackMapping = Register<0x0390, uint8_t, READ_WRITE>;
+    ///@brief 速度反馈映射
+    using VelocityFeedbackMapping = Register<0x0391, uint8_t, READ_WRITE>;
+    ///@brief 电角度反馈映射
+    using ElecAngleFeedbackMapping = Register<0x0392, uint8_t, READ_WRITE>;
+    ///@brief 电机端位置反馈分辨率
+    using MotorPositionFeedbackResolution = Register<0x0394, uint32_t, READ_ONLY>;
+    ///@brief 力-力矩控制前馈系数
+    using ForceTorqueFeedforward = Register<0x0396, int32_t, READ_WRITE>;
+    ///@brief 力-力矩控制比例系数
+    using ForceTorqueKp = Register<0x0398, int32_t, READ_WRITE>;
+    ///@brief 力-力矩控制积分系数
+    using ForceTorqueKi = Register<0x039A, int32_t, READ_WRITE>;
+    ///@brief 硬件短路保护检测开关
+    using HardwareShortCircuitDetectEnable = Register<0x039B, uint8_t, READ_WRITE>;
+    ///@brief Flash存储状态检测开关
+    using FlashStatusDetectEnable = Register<0x039C, uint8_t, READ_WRITE>;
+    ///@brief 位置反馈状态检测开关
+    using PositionFeedbackStatusDetectEnable = Register<0x039D, uint8_t, READ_WRITE>;
+    ///@brief 霍尔传感器状态检测开关
+    using HallStatusDetectEnable = Register<0x039E, uint8_t, READ_WRITE>;
+    ///@brief 电压范围检测开关
+    using VoltageRangeDetectEnable = Register<0x039F, uint8_t, READ_WRITE>;
+    ///@brief 驱动器过载检测开关
+    using DriveOverloadDetectEnable = Register<0x03A0, uint8_t, READ_WRITE>;
+    ///@brief 驱动器峰值电流检测开关
+    using DrivePeakCurrentDetectEnable = Register<0x03A1, uint8_t, READ_WRITE>;
+    ///@brief 电机过载检测开关
+    using MotorOverloadDetectEnable = Register<0x03A2, uint8_t, READ_WRITE>;
+    ///@brief 电机过载电流
+    using MotorOverloadCurrent = Register<0x03A4, uint32_t, READ_WRITE>;
+    ///@brief 电机峰值电流检测开关
+    using MotorPeakCurrentDetectEnable = Register<0x03A5, uint8_t, READ_WRITE>;
+    ///@brief 电机峰值电流持续时间
+    using MotorPeakCurrentDuration = Register<0x03A7, uint32_t, READ_WRITE>;
+    ///@brief 过速阈值
+    using OverspeedThreshold = Register<0x03A9, uint32_t, READ_WRITE>;
+    ///@brief 电机堵转保护开关
+    using MotorStuckDetectEnable = Register<0x03AA, uint8_t, READ_WRITE>;
+    ///@brief 位置跟随误差检测开关
+    using PositionFollowingErrorDetectEnable = Register<0x03AB, uint8_t, READ_WRITE>;
+    ///@brief 力控范围检测开关
+    using ForceRangeDetectEnable = Register<0x03AC, uint8_t, READ_WRITE>;
+    ///@brief 驱动器温度检测开关
+    using DriveTemperatureDetectEnable = Register<0x03AD, uint8_t, READ_WRITE>;
+    ///@brief 电机温度检测开关
+    using MotorTemperatureDetectEnable = Register<0x03AE, uint8_t, READ_WRITE>;
+    ///@brief 电机低温报错阈值
+    using MotorLowTemperatureFaultThreshold = Register<0x03B0, int32_t, READ_WRITE>;
+    ///@brief 电机高温警告阈值
+    using MotorHighTemperatureWarningThreshold = Register<0x03B2, int32_t, READ_WRITE>;
+    ///@brief 电机温度保护阈值时间
+    using MotorTemperatureThresholdTime = Register<0x03B4, uint32_t, READ_WRITE>;
+    ///@brief 位置到达检测开关
+    using PositionTargetReachedDetectEnable = Register<0x03B5, uint8_t, READ_WRITE>;
+    ///@brief 速度到达检测开关
+    using VelocityTargetReachedDetectEnable = Register<0x03B6, uint8_t, READ_WRITE>;
+    ///@brief 零速检测开关
+    using VelocityZeroDetectEnable = Register<0x03B7, uint8_t, READ_WRITE>;
+    ///@brief 电机抱闸信号PWM周期
+    using MotorBrakePWMSignalFrequency = Register<0x03B9, uint32_t, READ_WRITE>;
+    ///@brief 电机抱闸信号PWM占空比
+    using MotorBrakePWMSignalDutyCycle = Register<0x03BA, uint8_t, READ_WRITE>;
+    ///@brief 电角度辨识目标电角度
+    using ElectricalAngleIdentificationTargetElectricalAngle = Register<0x03BB, uint8_t, READ_WRITE>;
+    ///@brief 参考信号控制对象
+    using ReferenceSignalControlObject = Register<0x03BC, uint8_t, READ_WRITE>;
+    ///@brief 压力指令值
+    using ForceDemandValue = Register<0x03BE, int32_t, READ_ONLY>;
+    ///@brief 负载端 Z 相检测误差
+    using LoadZeroPulseErrorValue = Register<0x03C0, int32_t, READ_ONLY>;
+    ///@brief 电流环带宽验证值
+    using CurrentControllerBandwidthVerifiedValue = Register<0x03C2, uint32_t, READ_ONLY>;
+    ///@brief 位置环带宽验证值
+    using PositionControllerBandwidthVerifiedValue = Register<0x03C4, uint32_t, READ_ONLY>;
+    ///@brief 驱动器热量累计值
+    using DriveAccumulatedHeat = Register<0x03C6, uint32_t, READ_ONLY>;
+    ///@brief 脉冲输出模式
+    using PulseOutputMode = Register<0x03C7, uint8_t, READ_WRITE>;
+    ///@brief 脉冲输出分频系数
+    using PulseOutputFreqDivision = Register<0x03C8, uint16_t, READ_WRITE>;
+    ///@brief 脉冲捕获计数值
+    using PulseCaptureSignalCounts = Register<0x03CA, uint32_t, READ_ONLY>;
+    ///@brief 生产批次版本号
+    using ProductionBatchVersion = Register<0x03CC, uint32_t, READ_ONLY>;
+    ///@brief D轴电流目标值
+    using AxisDCurrentTargetValue = Register<0x03CE, int32_t, READ_WRITE>;
+    ///@brief D轴电流指令值
+    using AxisDCurrentDemandValue = Register<0x03D0, int32_t, READ_ONLY>;
+    ///@brief Alpha轴电压目标值
+    using AxisAlphaVoltageTargetValue = Register<0x03D2, int32_t, READ_WRITE>;
+    ///@brief Beta轴电压目标值
+    using AxisBetaVoltageTargetValue = Register<0x03D4, int32_t, READ_WRITE>;
+    ///@brief D轴电流当前值
+    using AxisDCurrentActualValue = Register<0x03D6, int32_t, READ_ONLY>;
+    ///@brief Alpha轴电压当前值
+    using AxisAlphaVoltageActualValue = Register<0x03D8, int32_t, READ_ONLY>;
+    ///@brief Beta轴电压当前值
+    using AxisBetaVoltageActualValue = Register<0x03DA, int32_t, READ_ONLY>;
+    ///@brief Alpha轴电压指令值
+    using AxisAlphaVoltageDemandValue = Register<0x03DC, int32_t, READ_ONLY>;
+    ///@brief Beta轴电压指令值
+    using AxisBetaVoltageDemandValue = Register<0x03DE, int32_t, READ_ONLY>;
+    ///@brief 力-力矩控制单位指数
+    using ForceTorqueUnitIndex = Register<0x03DF, int8_t, READ_WRITE>;
+    ///@brief 力-位置导纳控制单位指数
+    using ForcePositionAdmittanceUnitIndex = Register<0x03E0, int8_t, READ_WRITE>;
+    ///@brief 离线数据模块的文件索引
+    using OfflineDataIndex = Register<0x03E2, uint32_t, READ_ONLY>;
+    ///@brief 控制模块的文件索引
+    using ControlDataIndex = Register<0x03E4, uint32_t, READ_ONLY>;
+    ///@brief 再生电压上限阈值
+    using RegenerationVoltageUpperThreshold = Register<0x03E6, uint32_t, READ_WRITE>;
+    ///@brief 再生电压下限阈值
+    using RegenerationVoltageLowerThreshold = Register<0x03E8, uint32_t, READ_WRITE>;
+    ///@brief 再生功能开关
+    using RegenerationFunctionEnable = Register<0x03E9, uint8_t, READ_WRITE>;
+    ///@brief 再生电阻过载保护开关
+    using RegenerationResistorOverloadProtectionEnable = Register<0x03EA, uint8_t, READ_WRITE>;
+    ///@brief 上电自动使能开关
+    using PowerOnAutoEnable = Register<0x03EB, uint8_t, READ_WRITE>;
+    ///@brief 电机端速度观测器当前值
+    using MotorSpeedObserverActualValue = Register<0x03ED, int32_t, READ_ONLY>;
+    ///@brief 负载端速度观测器当前值
+    using LoadSpeedObserverActualValue = Register<0x03EF, int32_t, READ_ONLY>;
+    ///@brief 编码器1毛刺滤波系数
+    using Encoder1GlitchFilterCoef = Register<0x03F1, uint32_t, READ_WRITE>;
+    ///@brief 编码器2毛刺滤波系数
+    using Encoder2GlitchFilterCoef = Register<0x03F3, uint32_t, READ_WRITE>;
+    ///@brief 脉冲捕获毛刺滤波系数
+    using PulseCaptureGlitchFilterCoefficient = Register<0x03F5, uint32_t, READ_WRITE>;
+    ///@brief 多段运行模式段选指令
+    using MultiSegmentSelectionCommand = Register<0x03F6, uint8_t, READ_WRITE>;
+    ///@brief 多段运行模式触发指令
+    using MultiSegmentTriggerCommand = Register<0x03F7, uint8_t, READ_WRITE>;
+    ///@brief 电机堵转电流阈值相对值
+    using MotorStuckCurrentThresholdRelative = Register<0x03F8, uint8_t, READ_WRITE>;
+    ///@brief 电机堵转速度阈值
+    using MotorStuckVelocityThreshold = Register<0x03FA, uint32_t, READ_WRITE>;
+    ///@brief 力传感器当前值
+    using ForceSensorActualValue = Register<0x03FC, int32_t, READ_ONLY>;
+    ///@brief 力控到达检测开关
+    using ForceTargetReachedDetectEnable = Register<0x03FD, uint8_t, READ_WRITE>;
+    ///@brief 力控到达检测窗口
+    using ForceTargetReachedWindow = Register<0x03FE, uint16_t, READ_WRITE>;
+    ///@brief 力控到达检测窗口时间
+    using ForceTargetReachedWindowTime = Register<0x0400, uint32_t, READ_WRITE>;
+    ///@brief 速度控制模式
+    using VelocityControlMode = Register<0x0401, uint8_t, READ_WRITE>;
+    ///@brief 力控误差值
+    using ForceErrorValue = Register<0x0403, int32_t, READ_ONLY>;
+    ///@brief 多段运行模式运行段
+    using MultiSegmentRunningSegment = Register<0x0404, uint8_t, READ_ONLY>;
+    ///@brief 多段运行模式运行状态
+    using MultiSegmentRunningState = Register<0x0405, uint8_t, READ_ONLY>;
+    ///@brief 指令电流滤波器1类型
+    using CurrentTargetFilter1Type = Register<0x0406, uint8_t, READ_WRITE>;
+    ///@brief 指令电流滤波器1频率
+    using CurrentTargetFilter1Frequency = Register<0x0408, uint32_t, READ_WRITE>;
+    ///@brief 指令电流滤波器1带宽
+    using CurrentTargetFilter1Bandwidth = Register<0x040A, uint32_t, READ_WRITE>;
+    ///@brief 指令电流滤波器2类型
+    using CurrentTargetFilter2Type = Register<0x040B, uint8_t, READ_WRITE>;
+    ///@brief 指令电流滤波器2频率
+    using CurrentTargetFilter2Frequency = Register<0x040D, uint32_t, READ_WRITE>;
+    ///@brief 指令电流滤波器2带宽
+    using CurrentTargetFilter2Bandwidth = Register<0x040F, uint32_t, READ_WRITE>;
+    ///@brief 指令电流滤波器3类型
+    using CurrentTargetFilter3Type = Register<0x0410, uint8_t, READ_WRITE>;
+    ///@brief 指令电流滤波器3频率
+    using CurrentTargetFilter3Frequency = Register<0x0412, uint32_t, READ_WRITE>;
+    ///@brief 指令电流滤波器3带宽
+    using CurrentTargetFilter3Bandwidth = Register<0x0414, uint32_t, READ_WRITE>;
+    ///@brief 指令电流滤波器4类型
+    using CurrentTargetFilter4Type = Register<0x0415, uint8_t, READ_WRITE>;
+    ///@brief 指令电流滤波器4频率
+    using CurrentTargetFilter4Frequency = Register<0x0417, uint32_t, READ_WRITE>;
+    ///@brief 指令电流滤波器4带宽
+    using CurrentTargetFilter4Bandwidth = Register<0x0419, uint32_t, READ_WRITE>;
+    ///@brief 脉冲输出分辨率
+    using PulseOutputResolution = Register<0x041B, int32_t, READ_WRITE>;
+    ///@brief 自动寻相开关
+    using AutoElecAngleAlignEnable = Register<0x041C, uint8_t, READ_WRITE>;
+    ///@brief 点位编程停留时间
+    using PointProgramDwellTime = Register<0x041E, uint32_t, READ_WRITE>;
+    ///@brief 脉冲捕获通道
+    using PulseCaptureChannel = Register<0x041F, uint8_t, READ_WRITE>;
+    ///@brief 位置误差补偿功能开关
+    using PositionErrorCorrectionEnable = Register<0x0420, uint8_t, READ_WRITE>;
+    ///@brief 位置误差补偿起始位置
+    using PositionErrorCorrectionStartPosition = Register<0x0422, int32_t, READ_WRITE>;
+    ///@brief 位置误差补偿插值点间隔
+    using PositionErrorCorrectionInterval = Register<0x0424, uint32_t, READ_WRITE>;
+    ///@brief 位置误差补偿起始索引偏移
+    using PositionErrorCorrectionStartIndexOffset = Register<0x0426, uint32_t, READ_WRITE>;
+    ///@brief 位置误差补偿有效点数
+    using PositionErrorCorrectionActiveNumber = Register<0x0428, uint32_t, READ_WRITE>;
+    ///@brief 脉冲输入分辨率
+    using PulseInputResolution = Register<0x042A, uint32_t, READ_WRITE>;
+    ///@brief 脉冲输入倍率分子
+    using PulseInputRatioNumerator = Register<0x042C, int32_t, READ_WRITE>;
+    ///@brief 脉冲输入倍率分母
+    using PulseInputRatioDenominator = Register<0x042E, int32_t, READ_WRITE>;
+    ///@brief 多段运行模式设置段索引
+    using MultiSegmentSetSegmentIndex = Register<0x042F, uint8_t, READ_WRITE>;
+    ///@brief 多段运行模式设置参数索引
+    using MultiSegmentSetParamIndex = Register<0x0430, uint8_t, READ_WRITE>;
+    ///@brief 多段运行模式设置值
+    using MultiSegmentSetValue = Register<0x0432, uint32_t, READ_WRITE>;
+    ///@brief 位置误差补偿表设置索引
+    using PositionErrorCorrectionSetIndex = Register<0x0434, uint32_t, READ_WRITE>;
+    ///@brief 位置误差补偿表设置值
+    using PositionErrorCorrectionSetValue = Register<0x0436, int32_t, READ_WRITE>;
+    ///@brief 位置误差补偿参数复位指令
+    using PositionErrorCorrectionParametersResetCommand = Register<0x0437, uint8_t, READ_WRITE>;
+    ///@brief 位置误差补偿状态
+    using PositionErrorCorrectionStatus = Register<0x0438, int8_t, READ_ONLY>;
+    ///@brief 回零后目标位置
+    using TargetPositionAfterHoming = Register<0x043A, int32_t, READ_WRITE>;
+    ///@brief 力单位转换系数分子
+    using ForceFactorNumerator = Register<0x043C, uint32_t, READ_WRITE>;
+    ///@brief 力单位转换系数分母
+    using ForceFactorDenominator = Register<0x043E, uint32_t, READ_WRITE>;
+    ///@brief 回零堵转电流相对值
+    using HomingStallCurrentRelative = Register<0x043F, uint8_t, READ_WRITE>;
+    ///@brief 电角度辨识模式
+    using ElectricalAngleIdentificationMode = Register<0x0440, uint8_t, READ_WRITE>;
+    ///@brief 电角度辨识超时时间
+    using ElectricalAngleIdentificationTimeoutTime = Register<0x0442, uint32_t, READ_WRITE>;
+    ///@brief 数据库读写错误码
+    using DatabaseReadWriteErrorCode = Register<0x0444, uint32_t, READ_ONLY>;
+    ///@brief 负载端位置当前原始值
+    using LoadPositionActualRawValue = Register<0x0446, int32_t, READ_ONLY>;
+    ///@brief 位置反馈属性
+    using PositionFeedbackAttribute = Register<0x0448, uint32_t, READ_WRITE>;
+    ///@brief 警告位掩码段1
+    using WarningBitmaskSegment1 = Register<0x044A, uint32_t, READ_WRITE>;
+    ///@brief 警告位掩码段2
+    using WarningBitmaskSegment2 = Register<0x044C, uint32_t, READ_WRITE>;
+    ///@brief 超程动作模式
+    using OvertravelActionMode = Register<0x044D, int16_t, READ_WRITE>;
+    ///@brief 脚本运行状态
+    using ScriptRunningStatus = Register<0x044E, int8_t, READ_ONLY>;
+    ///@brief 警告码段1
+    using WarningCodeSegment1 = Register<0x0450, uint32_t, READ_ONLY>;
+    ///@brief 警告码段2
+    using WarningCodeSegment2 = Register<0x0452, uint32_t, READ_ONLY>;
+    ///@brief 回零超时时间
+    using HomingTimeoutTime = Register<0x0454, uint32_t, READ_WRITE>;
+    ///@brief 自动增益调整开关
+    using AutoGainTuningEnable = Register<0x0455, uint8_t, READ_WRITE>;
+    ///@brief 自动增益调整方法
+    using AutoGainTuningMethod = Register<0x0456, uint8_t, READ_WRITE>;
+    ///@brief 自动增益估计速度
+    using AutoGainEstimationSpeed = Register<0x0457, uint8_t, READ_WRITE>;
+    ///@brief Alpha轴电流当前值
+    using AxisAlphaCurrentActualValue = Register<0x0459, int32_t, READ_ONLY>;
+    ///@brief Beta轴电流当前值
+    using AxisBetaCurrentActualValue = Register<0x045B, int32_t, READ_ONLY>;
+    ///@brief 通信功能选项码1
+    using CommunicationFunctionOptionCode1 = Register<0x045D, uint32_t, READ_WRITE>;
+    ///@brief 通信功能选项码2
+    using CommunicationFunctionOptionCode2 = Register<0x045F, uint32_t, READ_WRITE>;
+    ///@brief 平滑系数指数
+    using SmoothingFactorIndex = Register<0x0460, int8_t, READ_WRITE>;
+    ///@brief 应用电流限制
+    using ApplicationCurrentLimit = Register<0x0462, uint32_t, READ_WRITE>;
+    ///@brief 数字IO输入自动触发开关
+    using DigitalIOInputAutoTriggerEnable = Register<0x0464, uint32_t, READ_WRITE>;
+    ///@brief 编码器1信号类型
+    using Encoder1SignalType = Register<0x0465, uint8_t, READ_WRITE>;
+    ///@brief 编码器2信号类型
+    using Encoder2SignalType = Register<0x0466, uint8_t, READ_WRITE>;
+    ///@brief ADC硬件电压下限
+    using ADCHardwareVoltageLowerLimit = Register<0x0468, int32_t, READ_ONLY>;
+    ///@brief ADC硬件电压上限
+    using ADCHardwareVoltageUpperLimit = Register<0x046A, int32_t, READ_ONLY>;
+    ///@brief ADC用户电压下限
+    using ADCUserVoltageLowerLimit = Register<0x046C, int32_t, READ_WRITE>;
+    ///@brief ADC用户电压上限
+    using ADCUserVoltageUpperLimit = Register<0x046E, int32_t, READ_WRITE>;
+    ///@brief 电角度辨识参数?1
+    using ElectricalAngleIdentificationParameter1 = Register<0x0470, uint32_t, READ_WRITE>;
+    ///@brief 电角度辨识参数?2
+    using ElectricalAngleIdentificationParameter2 = Register<0x0472, uint32_t, READ_WRITE>;
+    ///@brief 电角度辨识参数?3
+    using ElectricalAngleIdentificationParameter3 = Register<0x0474, uint32_t, READ_WRITE>;
+    ///@brief 寻相后自动返回开关
+    using ElectricalAngleAlignAutoReturnEnable = Register<0x0475, uint8_t, READ_WRITE>;
+    ///@brief 力控搜索速度
+    using ForceControlSearchSpeed = Register<0x0477, uint32_t, READ_WRITE>;
+    ///@brief Modbus通讯波特率
+    using ModbusBaudrate = Register<0x0479, uint32_t, READ_WRITE>;
+    ///@brief Modbus节点ID
+    using ModbusNodeID = Register<0x047A, uint8_t, READ_WRITE>;
+    ///@brief 位置显示单位
+    using PositionDisplayUnit = Register<0x047B, uint8_t, READ_WRITE>;
+    ///@brief 速度显示单位
+    using VelocityDisplayUnit = Register<0x047C, uint8_t, READ_WRITE>;
+    ///@brief 加速度显示单位
+    using AccelerationDisplayUnit = Register<0x047D, uint8_t, READ_WRITE>;
+    ///@brief 力显示单位
+    using ForceDisplayUnit = Register<0x047E, uint8_t, READ_WRITE>;
+    ///@brief Z?相输出持续时间
+    using ZeroPulseOutputDuration = Register<0x0480, uint32_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_0 = Register<0x0481, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_1 = Register<0x0482, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_2 = Register<0x0483, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_3 = Register<0x0484, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_4 = Register<0x0485, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_5 = Register<0x0486, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_6 = Register<0x0487, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_7 = Register<0x0488, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_8 = Register<0x0489, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_9 = Register<0x048A, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_10 = Register<0x048B, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_11 = Register<0x048C, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_12 = Register<0x048D, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_13 = Register<0x048E, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_14 = Register<0x048F, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_15 = Register<0x0490, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_16 = Register<0x0491, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_17 = Register<0x0492, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_18 = Register<0x0493, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_19 = Register<0x0494, uint8_t, READ_WRITE>;
+    ///@brief 驱动器名称
+    using DriveName_20 = Register<0x0495, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_0 = Register<0x0496, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_1 = Register<0x0497, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_2 = Register<0x0498, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_3 = Register<0x0499, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_4 = Register<0x049A, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_5 = Register<0x049B, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_6 = Register<0x049C, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_7 = Register<0x049D, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_8 = Register<0x049E, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_9 = Register<0x049F, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_10 = Register<0x04A0, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_11 = Register<0x04A1, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_12 = Register<0x04A2, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_13 = Register<0x04A3, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_14 = Register<0x04A4, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_15 = Register<0x04A5, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_16 = Register<0x04A6, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_17 = Register<0x04A7, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_18 = Register<0x04A8, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_19 = Register<0x04A9, uint8_t, READ_WRITE>;
+    ///@brief 电机名称
+    using MotorName_20 = Register<0x04AA, uint8_t, READ_WRITE>;
+    ///@brief 编码器分频脉冲输出Z 相持续时间
+    using EncoderDividedPulseOutputZeroDuration = Register<0x04AC, uint32_t, READ_WRITE>;
+    ///@brief 力矩最大记录值
+    using TorqueMaxRecordValue = Register<0x04AE, int32_t, READ_WRITE>;
+    ///@brief 增量编码器省线式类型
+    using IncrementalEncoderWireSavingType = Register<0x04AF, uint8_t, READ_WRITE>;
+    ///@brief 低频振动滤波器1类型
+    using LowFrequencyVibrationFilter1Type = Register<0x04B0, uint8_t, READ_WRITE>;
+    ///@brief 低频振动滤波器1频率
+    using LowFrequencyVibrationFilter1Frequency = Register<0x04B2, uint32_t, READ_WRITE>;
+    ///@brief 低频振动滤波器1带宽
+    using LowFrequencyVibrationFilter1Bandwidth = Register<0x04B4, uint32_t, READ_WRITE>;
+    ///@brief 低频振动滤波器2类型
+    using LowFrequencyVibrationFilter2Type = Register<0x04B5, uint8_t, READ_WRITE>;
+    ///@brief 低频振动滤波器2频率
+    using LowFrequencyVibrationFilter2Frequency = Register<0x04B7, uint32_t, READ_WRITE>;
+    ///@brief 低频振动滤波器2带宽
+    using LowFrequencyVibrationFilter2Bandwidth = Register<0x04B9, uint32_t, READ_WRITE>;
+    ///@brief 低频振动滤波器3类型
+    using LowFrequencyVibrationFilter3Type = Register<0x04BA, uint8_t, READ_WRITE>;
+    ///@brief 低频振动滤波器3频率
+    using LowFrequencyVibrationFilter3Frequency = Register<0x04BC, uint32_t, READ_WRITE>;
+    ///@brief 低频振动滤波器3带宽
+    using LowFrequencyVibrationFilter3Bandwidth = Register<0x04BE, uint32_t, READ_WRITE>;
+    ///@brief 低频振动滤波器4类型
+    using LowFrequencyVibrationFilter4Type = Register<0x04BF, uint8_t, READ_WRITE>;
+    ///@brief 低频振动滤波器4频率
+    using LowFrequencyVibrationFilter4Frequency = Register<0x04C1, uint32_t, READ_WRITE>;
+    ///@brief 低频振动滤波器4带宽
+    using LowFrequencyVibrationFilter4Bandwidth = Register<0x04C3, uint32_t, READ_WRITE>;
+    ///@brief 旋转变压器1通道1极对数
+    using Resolver1Channel1PolePairs = Register<0x04C4, uint8_t, READ_WRITE>;
+    ///@brief 旋转变压器1通道1乘法因子
+    using Resolver1Channel1MultiplicationFactor = Register<0x04C5, uint8_t, READ_WRITE>;
+    ///@brief 旋转变压器1通道1激励信号频率
+    using Resolver1Channel1ExcitationSignalFrequency = Register<0x04C7, uint32_t, READ_WRITE>;
+    ///@brief 旋转变压器1通道2极对数
+    using Resolver1Channel2PolePairs = Register<0x04C8, uint8_t, READ_WRITE>;
+    ///@brief 旋转变压器1通道2乘法因子
+    using Resolver1Channel2MultiplicationFactor = Register<0x04C9, uint8_t, READ_WRITE>;
+    ///@brief 旋转变压器1通道2激励信号频率
+    using Resolver1Channel2ExcitationSignalFrequency = Register<0x04CB, uint32_t, READ_WRITE>;
+    ///@brief 旋转变压器2通道1极对数
+    using Resolver2Channel1PolePairs = Register<0x04CC, uint8_t, READ_WRITE>;
+    ///@brief 旋转变压器2通道1乘法因子
+    using Resolver2Channel1MultiplicationFactor = Register<0x04CD, uint8_t, READ_WRITE>;
+    ///@brief 旋转变压器2通道1激励信号频率
+    using Resolver2Channel1ExcitationSignalFrequency = Register<0x04CF, uint32_t, READ_WRITE>;
+    ///@brief 旋转变压器2通道2极对数
+    using Resolver2Channel2PolePairs = Register<0x04D0, uint8_t, READ_WRITE>;
+    ///@brief 旋转变压器2通道2乘法因子
+    using Resolver2Channel2MultiplicationFactor = Register<0x04D1, uint8_t, READ_WRITE>;
+    ///@brief 旋转变压器2通道2激励信号频率
+    using Resolver2Channel2ExcitationSignalFrequency = Register<0x04D3, uint32_t, READ_WRITE>;
+    ///@brief 输入整形功能开关
+    using InputShapingEnable = Register<0x04D4, uint8_t, READ_WRITE>;
+    ///@brief 系统振动频率
+    using SystemVibrationFrequency = Register<0x04D6, uint32_t, READ_WRITE>;
+    ///@brief 系统振动阻尼比
+    using SystemVibrationDampingRatio = Register<0x04D8, uint32_t, READ_WRITE>;
+    ///@brief 残余振动比
+    using ResidualVibrationRatio = Register<0x04DA, uint32_t, READ_WRITE>;
+    ///@brief 系统控制指令
+    using ControlCmd = Register<0x6000, uint8_t, READ_WRITE>;
+    ///@brief 连接中断动作模式
+    using Abort_connection_option_code = Register<0xF000, int16_t, READ_WRITE>;
+    ///@brief 错误码
+    using Error_code = Register<0xF001, uint16_t, READ_ONLY>;
+    ///@brief 402控制字
+    using Controlword = Register<0xF002, uint16_t, READ_WRITE>;
+    ///@brief 402状态字
+    using Statusword = Register<0xF003, uint16_t, READ_ONLY>;
+    ///@brief 快速停止操作代码
+    using Quick_stop_option_code = Register<0xF004, int16_t, READ_WRITE>;
+    ///@brief 刹车操作代码
+    using Shutdown_option_code = Register<0xF005, int16_t, READ_WRITE>;
+    using Disable_operation_option_code = Register<0xF006, int16_t, READ_WRITE>;
+    using Halt_option_code = Register<0xF007, int16_t, READ_WRITE>;
+    ///@brief 故障动作执行代码
+    using Fault_reaction_option_code = Register<0xF008, int16_t, READ_WRITE>;
+    ///@brief 运行模式
+    using Modes_of_operation = Register<0xF009, int8_t, READ_WRITE>;
+    using Modes_of_operation_display = Register<0xF00A, int8_t, READ_ONLY>;
+    ///@brief 位置指令值
+    using Position_demannd_value = Register<0xF00C, int32_t, READ_ONLY>;
+    ///@brief 负载端位置当前值
+    using Position_actual_value_inc = Register<0xF00E, int32_t, READ_ONLY>;
+    using Position_actual_value = Register<0xF010, int32_t, READ_ONLY>;
+    ///@brief 位置跟随误差阈值
+    using Following_error_window = Register<0xF012, uint32_t, READ_WRITE>;
+    ///@brief 位置跟随误差阈值时间
+    using Following_error_time_Out = Register<0xF013, uint16_t, READ_WRITE>;
+    ///@brief 位置到达检测窗口
+    using Position_window = Register<0xF015, uint32_t, READ_WRITE>;
+    ///@brief 位置到达检测窗口时间
+    using Position_window_time = Register<0xF016, uint16_t, READ_WRITE>;
+    using Velocity_sensor_actual_value = Register<0xF018, int32_t, READ_ONLY>;
+    using Sensor_selection_code = Register<0xF019, int16_t, READ_ONLY>;
+    ///@brief 速度指令值
+    using Velocity_demand_value = Register<0xF01B, int32_t, READ_ONLY>;
+    ///@brief 负载端速度当前值
+    using Velocity_actual_value = Register<0xF01D, int32_t, READ_ONLY>;
+    ///@brief 速度到达检测窗口
+    using Velocity_window = Register<0xF01E, uint16_t, READ_WRITE>;
+    ///@brief 速度到达检测窗口时间
+    using Velocity_window_time = Register<0xF01F, uint16_t, READ_WRITE>;
+    ///@brief 零速检测窗口(RPM)
+    using Velocity_threshold = Register<0xF020, uint16_t, READ_WRITE>;
+    ///@brief 零速检测窗口时间
+    using Velocity_threshold_time = Register<0xF021, uint16_t, READ_WRITE>;
+    ///@brief 力矩目标值
+    using Target_torque = Register<0xF022, int16_t, READ_WRITE>;
+    ///@brief 应用力矩限制相对值
+    using Max_torque = Register<0xF023, uint16_t, READ_WRITE>;
+    ///@brief 应用电流限制相对值
+    using Max_current = Register<0xF024, uint16_t, READ_WRITE>;
+    ///@brief 力矩指令值
+    using Torque_demand_value = Register<0xF025, int16_t, READ_ONLY>;
+    ///@brief 电机额定电流
+    using Motor_rated_current = Register<0xF027, uint32_t, READ_WRITE>;
+    ///@brief 电机额定力矩/推力
+    using Motor_rated_torque = Register<0xF029, uint32_t, READ_WRITE>;
+    ///@brief 力矩当前值
+    using Torque_actual_value = Register<0xF02A, int16_t, READ_ONLY>;
+    ///@brief 电流当前值
+    using Current_actual_value = Register<0xF02B, int16_t, READ_ONLY>;
+    ///@brief 母线电压当前值
+    using DC_link_circuit_voltage = Register<0xF02D, uint32_t, READ_ONLY>;
+    ///@brief 位置目标值
+    using Target_position = Register<0xF02F, int32_t, READ_WRITE>;
+    ///@brief 位置溢出最小值
+    using Position_range_limit_Minimal_position_limit = Register<0xF031, int32_t, READ_WRITE>;
+    ///@brief 位置溢出最大值
+    using Position_range_limit_Maximal_position_limit = Register<0xF033, int32_t, READ_WRITE>;
+    ///@brief 回零偏移
+    using Home_offset = Register<0xF035, int32_t, READ_WRITE>;
+    ///@brief 应用位置下限
+    using Software_position_limit_Minimal_position_limit = Register<0xF037, int32_t, READ_WRITE>;
+    ///@brief 应用位置上限
+    using Software_position_limit_Maximal_position_limit = Register<0xF039, int32_t, READ_WRITE>;
+    ///@brief 运动极性
+    using Polarity = Register<0xF03A, uint8_t, READ_WRITE>;
+    ///@brief 应用速度限制
+    using Max_Profile_velocity = Register<0xF03C, uint32_t, READ_WRITE>;
+    ///@brief 电机最大转速/速度(RPM)
+    using Max_motor_speed = Register<0xF03E, uint32_t, READ_WRITE>;
+    ///@brief 轮廓速度
+    using Profile_velocity = Register<0xF040, uint32_t, READ_WRITE>;
+    using End_velocity = Register<0xF042, uint32_t, READ_WRITE>;
+    ///@brief 轮廓加速度
+    using Profile_acceleration = Register<0xF044, uint32_t, READ_WRITE>;
+    ///@brief 轮廓减速度
+    using Profile_deceleration = Register<0xF046, uint32_t, READ_WRITE>;
+    ///@brief 快速停止减速度
+    using Quick_stop_deceleration = Register<0xF048, uint32_t, READ_WRITE>;
+    ///@brief 运动轮廓模式
+    using Motion_profile_type = Register<0xF049, int16_t, READ_WRITE>;
+    ///@brief 力矩上升斜率
+    using Torque_slope = Register<0xF04B, uint32_t, READ_WRITE>;
+    using Torque_profile_type = Register<0xF04C, int16_t, READ_WRITE>;
+    using Position_notation_index = Register<0xF04D, uint8_t, READ_ONLY>;
+    using Position_dimension_index = Register<0xF04E, uint8_t, READ_ONLY>;
+    using Velocity_notation_index = Register<0xF04F, uint8_t, READ_ONLY>;
+    using Velocity_dimension_index = Register<0xF050, uint8_t, READ_ONLY>;
+    using Acceleration_notation_index = Register<0xF051, uint8_t, READ_ONLY>;
+    using Acceleration_dimension_index = Register<0xF052, uint8_t, READ_ONLY>;
+    ///@brief 负载端位置反馈分辨率
+    using Position_encoder_resolution_Encoder_increments = Register<0xF054, uint32_t, READ_WRITE>;
+    using Position_encoder_resolution_Motor_revolutions = Register<0xF056, uint32_t, READ_WRITE>;
+    using Motor_revolutions = Register<0xF058, uint32_t, READ_WRITE>;
+    using Shaft_revolutions = Register<0xF05A, uint32_t, READ_WRITE>;
+    using Feed_constant_Feed = Register<0xF05C, uint32_t, READ_WRITE>;
+    using Feed_constant_Shaft_revolutions = Register<0xF05E, uint32_t, READ_WRITE>;
+    ///@brief 位置单位转换系数分子
+    using Position_factor_Numerator = Register<0xF060, uint32_t, READ_WRITE>;
+    ///@brief 位置单位转换系数分母
+    using Position_factor_Feed_constant = Register<0xF062, uint32_t, READ_WRITE>;
+    ///@brief 速度单位转换系数分子
+    using Velocity_factor_1_Numerator = Register<0xF064, uint32_t, READ_WRITE>;
+    ///@brief 速度单位转换系数分母
+    using Velocity_factor_1_Divisor = Register<0xF066, uint32_t, READ_WRITE>;
+    using Velocity_factor_Numerator = Register<0xF068, uint32_t, READ_WRITE>;
+    using Velocity_factor_Divisor = Register<0xF06A, uint32_t, READ_WRITE>;
+    ///@brief 加速度单位转换系数分子
+    using Acceleration_factor_Numerator = Register<0xF06C, uint32_t, READ_WRITE>;
+    ///@brief 加速度单位转换系数分母
+    using Acceleration_factor_Divisor = Register<0xF06E, uint32_t, READ_WRITE>;
+    ///@brief 回零方法
+    using Homing_method = Register<0xF06F, int8_t, READ_WRITE>;
+    ///@brief 回零搜索开关速度
+    using Homing_speeds_Speed_for_switch_search = Register<0xF071, uint32_t, READ_WRITE>;
+    ///@brief 回零搜索零点速度
+    using Homing_speeds_Speed_for_zero_search = Register<0xF073, uint32_t, READ_WRITE>;
+    ///@brief 回零加速度
+    using Homing_acceleration = Register<0xF075, uint32_t, READ_WRITE>;
+    using Profile_jerk_use = Register<0xF076, uint8_t, READ_WRITE>;
+    using Profile_jerk1 = Register<0xF078, uint32_t, READ_WRITE>;
+    using Profile_jerk2 = Register<0xF07A, uint32_t, READ_WRITE>;
+    using Position_offset = Register<0xF07C, int32_t, READ_WRITE>;
+    using Velocity_offset = Register<0xF07E, int32_t, READ_WRITE>;
+    using Torque_offset = Register<0xF07F, int16_t, READ_WRITE>;
+    using Touch_probe_function = Register<0xF080, uint16_t, READ_WRITE>;
+    using Touch_probe_status = Register<0xF081, uint16_t, READ_ONLY>;
+    using Touch_probe_pos1_pos_value = Register<0xF083, int32_t, READ_ONLY>;
+    using Touch_probe_pos1_neg_value = Register<0xF085, int32_t, READ_ONLY>;
+    using Touch_probe_pos2_pos_value = Register<0xF087, int32_t, READ_ONLY>;
+    using Touch_probe_pos2_neg_value = Register<0xF089, int32_t, READ_ONLY>;
+    ///@brief 插值方法
+    using Interpolation_sub_mode_select = Register<0xF08A, int16_t, READ_WRITE>;
+    ///@brief 插值算法参数 1
+    using Interpolation_data_record_Data1 = Register<0xF08C, int32_t, READ_WRITE>;
+    ///@brief 插值算法参数 2
+    using Interpolation_data_record_Data2 = Register<0xF08E, int32_t, READ_WRITE>;
+    ///@brief 插值模式时间单位
+    using Interpolation_time_period_ip_time_units = Register<0xF08F, uint8_t, READ_WRITE>;
+    ///@brief 插值模式时间指数
+    using Interpolation_time_period_ip_time_index = Register<0xF090, int8_t, READ_WRITE>;
+    using Interpolation_sync_definition_Synchronize_on_group = Register<0xF091, uint8_t, READ_WRITE>;
+    using Interpolation_sync_definition_ip_sync_every_n_event = Register<0xF092, uint8_t, READ_WRITE>;
+    using Interpolation_data_configuration_Maxinmum_buffer_size = Register<0xF094, uint32_t, READ_ONLY>;
+    using Interpolation_data_configuration_Actual_buffer_size = Register<0xF096, uint32_t, READ_WRITE>;
+    using Interpolation_data_configuration_Buffer_organization = Register<0xF097, uint8_t, READ_WRITE>;
+    using Interpolation_data_configuration_Buffer_position = Register<0xF098, uint16_t, READ_WRITE>;
+    using Interpolation_data_configuration_Size_of_data_record = Register<0xF099, uint8_t, READ_WRITE>;
+    using Interpolation_data_configuration_Buffer_clear = Register<0xF09A, uint8_t, READ_WRITE>;
+    ///@brief 应用加速度限制
+    using Max_acceleration = Register<0xF09C, uint32_t, READ_WRITE>;
+    ///@brief 应用减速度限制
+    using Max_deceleration = Register<0xF09E, uint32_t, READ_WRITE>;
+    using Touch_Probe_1_Source = Register<0xF09F, uint16_t, READ_WRITE>;
+    using Touch_Probe_2_Source = Register<0xF0A0, uint16_t, READ_WRITE>;
+    using Touch_probe_1_positive_edge_counter = Register<0xF0A1, uint16_t, READ_ONLY>;
+    using Touch_probe_1_negative_edge_counter = Register<0xF0A2, uint16_t, READ_ONLY>;
+    using Touch_probe_2_positive_edge_counter = Register<0xF0A3, uint16_t, READ_ONLY>;
+    using Touch_probe_2_negative_edge_counter = Register<0xF0A4, uint16_t, READ_ONLY>;
+    using Positive_torque_limit_value = Register<0xF0A5, uint16_t, READ_WRITE>;
+    using Negative_torque_limit_value = Register<0xF0A6, uint16_t, READ_WRITE>;
+    using Supported_homing_method_0 = Register<0xF0A7, uint16_t, READ_ONLY>;
+    using Supported_homing_method_1 = Register<0xF0A8, uint16_t, READ_ONLY>;
+    using Supported_homing_method_2 = Register<0xF0A9, uint16_t, READ_ONLY>;
+    using Supported_homing_method_3 = Register<0xF0AA, uint16_t, READ_ONLY>;
+    using Supported_homing_method_4 = Register<0xF0AB, uint16_t, READ_ONLY>;
+    using Supported_homing_method_5 = Register<0xF0AC, uint16_t, READ_ONLY>;
+    using Supported_homing_method_6 = Register<0xF0AD, uint16_t, READ_ONLY>;
+    using Supported_homing_method_7 = Register<0xF0AE, uint16_t, READ_ONLY>;
+    using Supported_homing_method_8 = Register<0xF0AF, uint16_t, READ_ONLY>;
+    using Supported_homing_method_9 = Register<0xF0B0, uint16_t, READ_ONLY>;
+    using Supported_homing_method_10 = Register<0xF0B1, uint16_t, READ_ONLY>;
+    using Supported_homing_method_11 = Register<0xF0B2, uint16_t, READ_ONLY>;
+    using Supported_homing_method_12 = Register<0xF0B3, uint16_t, READ_ONLY>;
+    using Supported_homing_method_13 = Register<0xF0B4, uint16_t, READ_ONLY>;
+    using Supported_homing_method_14 = Register<0xF0B5, uint16_t, READ_ONLY>;
+    using Supported_homing_method_15 = Register<0xF0B6, uint16_t, READ_ONLY>;
+    using Supported_homing_method_16 = Register<0xF0B7, uint16_t, READ_ONLY>;
+    using Supported_homing_method_17 = Register<0xF0B8, uint16_t, READ_ONLY>;
+    using Supported_homing_method_18 = Register<0xF0B9, uint16_t, READ_ONLY>;
+    using Supported_homing_method_19 = Register<0xF0BA, uint16_t, READ_ONLY>;
+    using Supported_homing_method_20 = Register<0xF0BB, uint16_t, READ_ONLY>;
+    using Supported_homing_method_21 = Register<0xF0BC, uint16_t, READ_ONLY>;
+    using Supported_homing_method_22 = Register<0xF0BD, uint16_t, READ_ONLY>;
+    using Supported_homing_method_23 = Register<0xF0BE, uint16_t, READ_ONLY>;
+    using Supported_homing_method_24 = Register<0xF0BF, uint16_t, READ_ONLY>;
+    using Supported_homing_method_25 = Register<0xF0C0, uint16_t, READ_ONLY>;
+    using Supported_homing_method_26 = Register<0xF0C1, uint16_t, READ_ONLY>;
+    using Supported_homing_method_27 = Register<0xF0C2, uint16_t, READ_ONLY>;
+    using Supported_homing_method_28 = Register<0xF0C3, uint16_t, READ_ONLY>;
+    using Supported_homing_method_29 = Register<0xF0C4, uint16_t, READ_ONLY>;
+    using Supported_homing_method_30 = Register<0xF0C5, uint16_t, READ_ONLY>;
+    using Supported_homing_method_31 = Register<0xF0C6, uint16_t, READ_ONLY>;
+    using Supported_homing_method_32 = Register<0xF0C7, uint16_t, READ_ONLY>;
+    using Additional_Position_Actual_Value = Register<0xF0C9, int32_t, READ_ONLY>;
+    using Additional_Velocity_Actual_Value = Register<0xF0CB, int32_t, READ_ONLY>;
+    using Positioning_option_code = Register<0xF0CC, uint16_t, READ_WRITE>;
+    ///@brief 负载端位置误差值
+    using Following_error_actual_value = Register<0xF0CE, int32_t, READ_ONLY>;
+    using Control_effort = Register<0xF0D0, int32_t, READ_ONLY>;
+    using Position_demand_internal_value = Register<0xF0D2, int32_t, READ_ONLY>;
+    ///@brief 数字IO输入值
+    using Digital_inputs = Register<0xF0D4, uint32_t, READ_ONLY>;
+    ///@brief 数字IO输出值
+    using Digital_outputs_Physical_outputs = Register<0xF0D6, uint32_t, READ_WRITE>;
+    ///@brief 数字IO输出掩码开关
+    using Digital_outputs_Bit_mask = Register<0xF0D8, uint32_t, READ_WRITE>;
+    ///@brief 速度目标值
+    using Target_velocity = Register<0xF0DA, int32_t, READ_WRITE>;
+    ///@brief 电机类型
+    using Motor_type = Register<0xF0DB, uint16_t, READ_WRITE>;
+    ///@brief 支持的运行模式
+    using Supported_drive_modes = Register<0xF0DD, uint32_t, READ_ONLY>;
+
+    ///@brief Every register, sorted by address.  Anything missing is not known to exist.
+    constexpr std::array<RegisterSpan, 980> LAYOUT = {{
+        {0x0001, 1},
+        {0x0002, 1},
+        {0x0003, 1},
+        {0x0004, 1},
+        {0x0005, 1},
+        {0x0006, 1},
+        {0x0008, 2},
+        {0x000A, 2},
+        {0x000C, 2},
+        {0x000E, 2},
+        {0x0010, 2},
+        {0x0012, 2},
+        {0x0014, 2},
+        {0x0016, 2},
+        {0x0018, 2},
+        {0x001A, 2},
+        {0x001C, 2},
+        {0x001E, 2},
+        {0x0020, 2},
+        {0x0022, 2},
+        {0x0024, 2},
+        {0x0026, 2},
+        {0x0028, 2},
+        {0x002A, 2},
+        {0x002C, 2},
+        {0x002E, 2},
+        {0x002F, 1},
+        {0x0031, 2},
+        {0x0033, 2},
+        {0x0035, 2},
+        {0x0037, 2},
+        {0x0039, 2},
+        {0x003B, 2},
+        {0x003D, 2},
+        {0x003F, 2},
+        {0x0041, 2},
+        {0x0043, 2},
+        {0x0045, 2},
+        {0x0046, 1},
+        {0x0048, 2},
+        {0x004A, 2},
+        {0x004B, 1},
+        {0x004C, 1},
+        {0x004D, 1},
+        {0x004F, 2},
+        {0x0050, 1},
+        {0x0052, 2},
+        {0x0054, 2},
+        {0x0056, 2},
+        {0x0058, 2},
+        {0x005A, 2},
+        {0x005C, 2},
+        {0x005E, 2},
+        {0x0060, 2},
+        {0x0061, 1},
+        {0x0062, 1},
+        {0x0063, 1},
+        {0x0064, 1},
+        {0x0065, 1},
+        {0x0067, 2},
+        {0x0069, 2},
+        {0x006B, 2},
+        {0x006D, 2},
+        {0x006F, 2},
+        {0x0071, 2},
+        {0x0073, 2},
+        {0x0075, 2},
+        {0x0077, 2},
+        {0x0079, 2},
+        {0x007B, 2},
+        {0x007D, 2},
+        {0x007F, 2},
+        {0x0081, 2},
+        {0x0083, 2},
+        {0x0085, 2},
+        {0x0087, 2},
+        {0x0089, 2},
+        {0x008B, 2},
+        {0x008D, 2},
+        {0x008F, 2},
+        {0x0091, 2},
+        {0x0093, 2},
+        {0x0095, 2},
+        {0x0097, 2},
+        {0x0099, 2},
+        {0x009B, 2},
+        {0x009D, 2},
+        {0x009F, 2},
+        {0x00A1, 2},
+        {0x00A3, 2},
+        {0x00A5, 2},
+        {0x00A7, 2},
+        {0x00A9, 2},
+        {0x00AB, 2},
+        {0x00AD, 2},
+        {0x00AF, 2},
+        {0x00B1, 2},
+        {0x00B3, 2},
+        {0x00B5, 2},
+        {0x00B7, 2},
+        {0x00B9, 2},
+        {0x00BB, 2},
+        {0x00BD, 2},
+        {0x00BF, 2},
+        {0x00C1, 2},
+        {0x00C3, 2},
+        {0x00C5, 2},
+        {0x00C7, 2},
+        {0x00C9, 2},
+        {0x00CB, 2},
+        {0x00CD, 2},
+        {0x00CF, 2},
+        {0x00D1, 2},
+        {0x00D3, 2},
+        {0x00D5, 2},
+        {0x00D7, 2},
+        {0x00D9, 2},
+        {0x00DB, 2},
+        {0x00DD, 2},
+        {0x00DF, 2},
+        {0x00E1, 2},
+        {0x00E3, 2},
+        {0x00E5, 2},
+        {0x00E7, 2},
+        {0x00E9, 2},
+        {0x00EB, 2},
+        {0x00ED, 2},
+        {0x00EF, 2},
+        {0x00F1, 2},
+        {0x00F3, 2},
+        {0x00F5, 2},
+        {0x00F7, 2},
+        {0x00F9, 2},
+        {0x00FB, 2},
+        {0x00FD, 2},
+        {0x00FF, 2},
+        {0x0101, 2},
+        {0x0103, 2},
+        {0x0105, 2},
+        {0x0107, 2},
+        {0x0109, 2},
+        {0x010B, 2},
+        {0x010D, 2},
+        {0x010F, 2},
+        {0x0111, 2},
+        {0x0113, 2},
+        {0x0115, 2},
+        {0x0117, 2},
+        {0x0119, 2},
+        {0x011B, 2},
+        {0x011D, 2},
+        {0x011F, 2},
+        {0x0121, 2},
+        {0x0123, 2},
+        {0x0125, 2},
+        {0x0127, 2},
+        {0x0129, 2},
+        {0x012B, 2},
+        {0x012D, 2},
+        {0x012F, 2},
+        {0x0131, 2},
+        {0x0133, 2},
+        {0x0135, 2},
+        {0x0137, 2},
+        {0x0139, 2},
+        {0x013B, 2},
+        {0x013D, 2},
+        {0x013F, 2},
+        {0x0141, 2},
+        {0x0143, 2},
+        {0x0145, 2},
+        {0x0147, 2},
+        {0x0149, 2},
+        {0x014B, 2},
+        {0x014D, 2},
+        {0x014F, 2},
+        {0x0151, 2},
+        {0x0153, 2},
+        {0x0155, 2},
+        {0x0157, 2},
+        {0x0159, 2},
+        {0x015B, 2},
+        {0x015D, 2},
+        {0x015F, 2},
+        {0x0161, 2},
+        {0x0163, 2},
+        {0x0165, 2},
+        {0x0167, 2},
+        {0x0169, 2},
+        {0x016B, 2},
+        {0x016D, 2},
+        {0x016F, 2},
+        {0x0171, 2},
+        {0x0172, 1},
+        {0x0173, 1},
+        {0x0174, 1},
+        {0x0176, 2},
+        {0x0177, 1},
+        {0x0178, 1},
+        {0x0179, 1},
+        {0x017A, 1},
+        {0x017B, 1},
+        {0x017D, 2},
+        {0x017E, 1},
+        {0x017F, 1},
+        {0x0181, 2},
+        {0x0182, 1},
+        {0x0183, 1},
+        {0x0185, 2},
+        {0x0187, 2},
+        {0x0189, 2},
+        {0x018A, 1},
+        {0x018C, 2},
+        {0x018E, 2},
+        {0x0190, 2},
+        {0x0192, 2},
+        {0x0194, 2},
+        {0x0196, 2},
+        {0x0198, 2},
+        {0x019A, 2},
+        {0x019C, 2},
+        {0x019E, 2},
+        {0x019F, 1},
+        {0x01A1, 2},
+        {0x01A3, 2},
+        {0x01A5, 2},
+        {0x01A6, 1},
+        {0x01A8, 2},
+        {0x01AA, 2},
+        {0x01AC, 2},
+        {0x01AE, 2},
+        {0x01B0, 2},
+        {0x01B2, 2},
+        {0x01B4, 2},
+        {0x01B6, 2},
+        {0x01B8, 2},
+        {0x01BA, 2},
+        {0x01BB, 1},
+        {0x01BC, 1},
+        {0x01BE, 2},
+        {0x01C0, 2},
+        {0x01C2, 2},
+        {0x01C4, 2},
+        {0x01C6, 2},
+        {0x01C8, 2},
+        {0x01C9, 1},
+        {0x01CA, 1},
+        {0x01CC, 2},
+        {0x01CE, 2},
+        {0x01D0, 2},
+        {0x01D2, 2},
+        {0x01D4, 2},
+        {0x01D6, 2},
+        {0x01D8, 2},
+        {0x01DA, 2},
+        {0x01DB, 1},
+        {0x01DD, 2},
+        {0x01DE, 1},
+        {0x01DF, 1},
+        {0x01E0, 1},
+        {0x01E1, 1},
+        {0x01E2, 1},
+        {0x01E3, 1},
+        {0x01E4, 1},
+        {0x01E5, 1},
+        {0x01E6, 1},
+        {0x01E7, 1},
+        {0x01E9, 2},
+        {0x01EB, 2},
+        {0x01ED, 2},
+        {0x01EF, 2},
+        {0x01F1, 2},
+        {0x01F3, 2},
+        {0x01F5, 2},
+        {0x01F7, 2},
+        {0x01F8, 1},
+        {0x01F9, 1},
+        {0x01FA, 1},
+        {0x01FB, 1},
+        {0x01FD, 2},
+        {0x01FF, 2},
+        {0x0201, 2},
+        {0x0203, 2},
+        {0x0204, 1},
+        {0x0205, 1},
+        {0x0207, 2},
+        {0x0209, 2},
+        {0x020B, 2},
+        {0x020D, 2},
+        {0x020F, 2},
+        {0x0211, 2},
+        {0x0212, 1},
+        {0x0214, 2},
+        {0x0216, 2},
+        {0x0218, 2},
+        {0x021A, 2},
+        {0x021B, 1},
+        {0x021C, 1},
+        {0x021E, 2},
+        {0x0220, 2},
+        {0x0222, 2},
+        {0x0224, 2},
+        {0x0226, 2},
+        {0x0228, 2},
+        {0x0229, 1},
+        {0x022B, 2},
+        {0x022D, 2},
+        {0x022F, 2},
+        {0x0230, 1},
+        {0x0231, 1},
+        {0x0232, 1},
+        {0x0233, 1},
+        {0x0234, 1},
+        {0x0235, 1},
+        {0x0236, 1},
+        {0x0237, 1},
+        {0x0238, 1},
+        {0x0239, 1},
+        {0x023A, 1},
+        {0x023B, 1},
+        {0x023C, 1},
+        {0x023D, 1},
+        {0x023E, 1},
+        {0x023F, 1},
+        {0x0240, 1},
+        {0x0241, 1},
+        {0x0242, 1},
+        {0x0243, 1},
+        {0x0244, 1},
+        {0x0245, 1},
+        {0x0246, 1},
+        {0x0247, 1},
+        {0x0248, 1},
+        {0x0249, 1},
+        {0x024A, 1},
+        {0x024B, 1},
+        {0x024C, 1},
+        {0x024D, 1},
+        {0x024E, 1},
+        {0x024F, 1},
+        {0x0250, 1},
+        {0x0251, 1},
+        {0x0252, 1},
+        {0x0253, 1},
+        {0x0254, 1},
+        {0x0255, 1},
+        {0x0256, 1},
+        {0x0257, 1},
+        {0x0258, 1},
+        {0x0259, 1},
+        {0x025B, 1},
+        {0x025C, 1},
+        {0x025D, 1},
+        {0x025E, 1},
+        {0x025F, 1},
+        {0x0260, 1},
+        {0x0261, 1},
+        {0x0262, 1},
+        {0x0263, 1},
+        {0x0264, 1},
+        {0x0265, 1},
+        {0x0266, 1},
+        {0x0267, 1},
+        {0x0268, 1},
+        {0x0269, 1},
+        {0x026A, 1},
+        {0x026B, 1},
+        {0x026C, 1},
+        {0x026D, 1},
+        {0x026E, 1},
+        {0x026F, 1},
+        {0x0270, 1},
+        {0x0271, 1},
+        {0x0272, 1},
+        {0x0273, 1},
+        {0x0274, 1},
+        {0x0275, 1},
+        {0x0276, 1},
+        {0x0277, 1},
+        {0x0278, 1},
+        {0x0279, 1},
+        {0x027A, 1},
+        {0x027B, 1},
+        {0x027C, 1},
+        {0x027D, 1},
+        {0x027E, 1},
+        {0x027F, 1},
+        {0x0280, 1},
+        {0x0281, 1},
+        {0x0282, 1},
+        {0x0283, 1},
+        {0x0284, 1},
+        {0x0285, 1},
+        {0x0286, 1},
+        {0x0287, 1},
+        {0x0288, 1},
+        {0x0289, 1},
+        {0x028A, 1},
+        {0x028B, 1},
+        {0x028C, 1},
+        {0x028D, 1},
+        {0x028E, 1},
+        {0x028F, 1},
+        {0x0290, 1},
+        {0x0291, 1},
+        {0x0292, 1},
+        {0x0293, 1},
+        {0x0294, 1},
+        {0x0295, 1},
+        {0x0296, 1},
+        {0x0297, 1},
+        {0x0298, 1},
+        {0x0299, 1},
+        {0x029A, 1},
+        {0x029B, 1},
+        {0x029C, 1},
+        {0x029D, 1},
+        {0x029E, 1},
+        {0x029F, 1},
+        {0x02A0, 1},
+        {0x02A1, 1},
+        {0x02A2, 1},
+        {0x02A3, 1},
+        {0x02A4, 1},
+        {0x02A5, 1},
+        {0x02A6, 1},
+        {0x02A7, 1},
+        {0x02A8, 1},
+        {0x02A9, 1},
+        {0x02AA, 1},
+        {0x02AB, 1},
+        {0x02AC, 1},
+        {0x02AD, 1},
+        {0x02AE, 1},
+        {0x02AF, 1},
+        {0x02B0, 1},
+        {0x02B1, 1},
+        {0x02B2, 1},
+        {0x02B3, 1},
+        {0x02B4, 1},
+        {0x02B5, 1},
+        {0x02B6, 1},
+        {0x02B7, 1},
+        {0x02B8, 1},
+        {0x02B9, 1},
+        {0x02BA, 1},
+        {0x02BB, 1},
+        {0x02BC, 1},
+        {0x02BD, 1},
+        {0x02BE, 1},
+        {0x02BF, 1},
+        {0x02C0, 1},
+        {0x02C1, 1},
+        {0x02C2, 1},
+        {0x02C3, 1},
+        {0x02C4, 1},
+        {0x02C5, 1},
+        {0x02C6, 1},
+        {0x02C7, 1},
+        {0x02C8, 1},
+        {0x02C9, 1},
+        {0x02CA, 1},
+        {0x02CB, 1},
+        {0x02CC, 1},
+        {0x02CD, 1},
+        {0x02CE, 1},
+        {0x02CF, 1},
+        {0x02D0, 1},
+        {0x02D1, 1},
+        {0x02D2, 1},
+        {0x02D3, 1},
+        {0x02D4, 1},
+        {0x02D5, 1},
+        {0x02D6, 1},
+        {0x02D7, 1},
+        {0x02D8, 1},
+        {0x02D9, 1},
+        {0x02DA, 1},
+        {0x02DB, 1},
+        {0x02DC, 1},
+        {0x02DD, 1},
+        {0x02DE, 1},
+        {0x02DF, 1},
+        {0x02E0, 1},
+        {0x02E1, 1},
+        {0x02E2, 1},
+        {0x02E3, 1},
+        {0x02E4, 1},
+        {0x02E6, 2},
+        {0x02E8, 2},
+        {0x02EA, 2},
+        {0x02EC, 2},
+        {0x02ED, 1},
+        {0x02EE, 1},
+        {0x02F0, 2},
+        {0x02F2, 2},
+        {0x02F3, 1},
+        {0x02F4, 1},
+        {0x02F6, 2},
+        {0x02F8, 2},
+        {0x02FA, 2},
+        {0x02FB, 1},
+        {0x02FD, 2},
+        {0x02FF, 2},
+        {0x0301, 2},
+        {0x0302, 1},
+        {0x0303, 1},
+        {0x0304, 1},
+        {0x0305, 1},
+        {0x0306, 1},
+        {0x0307, 1},
+        {0x0308, 1},
+        {0x0309, 1},
+        {0x030A, 1},
+        {0x030C, 2},
+        {0x030E, 2},
+        {0x0310, 2},
+        {0x0312, 2},
+        {0x0313, 1},
+        {0x0314, 1},
+        {0x0315, 1},
+        {0x0316, 1},
+        {0x0317, 1},
+        {0x0318, 1},
+        {0x031A, 2},
+        {0x031C, 2},
+        {0x031E, 2},
+        {0x0320, 2},
+        {0x0322, 2},
+        {0x0324, 2},
+        {0x0325, 1},
+        {0x0326, 1},
+        {0x0328, 2},
+        {0x032A, 2},
+        {0x032C, 2},
+        {0x032E, 2},
+        {0x0330, 2},
+        {0x0332, 2},
+        {0x0334, 2},
+        {0x0336, 2},
+        {0x0338, 2},
+        {0x033A, 2},
+        {0x033C, 2},
+        {0x033E, 2},
+        {0x033F, 1},
+        {0x0340, 1},
+        {0x0341, 1},
+        {0x0342, 1},
+        {0x0343, 1},
+        {0x0344, 1},
+        {0x0345, 1},
+        {0x0346, 1},
+        {0x0348, 2},
+        {0x0349, 1},
+        {0x034A, 1},
+        {0x034B, 1},
+        {0x034C, 1},
+        {0x034E, 2},
+        {0x034F, 1},
+        {0x0350, 1},
+        {0x0351, 1},
+        {0x0352, 1},
+        {0x0353, 1},
+        {0x0354, 1},
+        {0x0355, 1},
+        {0x0356, 1},
+        {0x0358, 2},
+        {0x0359, 1},
+        {0x035A, 1},
+        {0x035B, 1},
+        {0x035C, 1},
+        {0x035E, 2},
+        {0x0360, 2},
+        {0x0362, 2},
+        {0x0364, 2},
+        {0x0366, 2},
+        {0x0368, 2},
+        {0x036A, 2},
+        {0x036C, 2},
+        {0x036E, 2},
+        {0x0370, 2},
+        {0x0372, 2},
+        {0x0374, 2},
+        {0x0376, 2},
+        {0x0378, 2},
+        {0x037A, 2},
+        {0x037C, 2},
+        {0x037E, 2},
+        {0x0380, 2},
+        {0x0382, 2},
+        {0x0384, 2},
+        {0x0386, 2},
+        {0x0388, 2},
+        {0x038A, 2},
+        {0x038C, 2},
+        {0x038E, 2},
+        {0x038F, 1},
+        {0x0390, 1},
+        {0x0391, 1},
+        {0x0392, 1},
+        {0x0394, 2},
+        {0x0396, 2},
+        {0x0398, 2},
+        {0x039A, 2},
+        {0x039B, 1},
+        {0x039C, 1},
+        {0x039D, 1},
+        {0x039E, 1},
+        {0x039F, 1},
+        {0x03A0, 1},
+        {0x03A1, 1},
+        {0x03A2, 1},
+        {0x03A4, 2},
+        {0x03A5, 1},
+        {0x03A7, 2},
+        {0x03A9, 2},
+        {0x03AA, 1},
+        {0x03AB, 1},
+        {0x03AC, 1},
+        {0x03AD, 1},
+        {0x03AE, 1},
+        {0x03B0, 2},
+        {0x03B2, 2},
+        {0x03B4, 2},
+        {0x03B5, 1},
+        {0x03B6, 1},
+        {0x03B7, 1},
+        {0x03B9, 2},
+        {0x03BA, 1},
+        {0x03BB, 1},
+        {0x03BC, 1},
+        {0x03BE, 2},
+        {0x03C0, 2},
+        {0x03C2, 2},
+        {0x03C4, 2},
+        {0x03C6, 2},
+        {0x03C7, 1},
+        {0x03C8, 1},
+        {0x03CA, 2},
+        {0x03CC, 2},
+        {0x03CE, 2},
+        {0x03D0, 2},
+        {0x03D2, 2},
+        {0x03D4, 2},
+        {0x03D6, 2},
+        {0x03D8, 2},
+        {0x03DA, 2},
+        {0x03DC, 2},
+        {0x03DE, 2},
+        {0x03DF, 1},
+        {0x03E0, 1},
+        {0x03E2, 2},
+        {0x03E4, 2},
+        {0x03E6, 2},
+        {0x03E8, 2},
+        {0x03E9, 1},
+        {0x03EA, 1},
+        {0x03EB, 1},
+        {0x03ED, 2},
+        {0x03EF, 2},
+        {0x03F1, 2},
+        {0x03F3, 2},
+        {0x03F5, 2},
+        {0x03F6, 1},
+        {0x03F7, 1},
+        {0x03F8, 1},
+        {0x03FA, 2},
+        {0x03FC, 2},
+        {0x03FD, 1},
+        {0x03FE, 1},
+        {0x0400, 2},
+        {0x0401, 1},
+        {0x0403, 2},
+        {0x0404, 1},
+        {0x0405, 1},
+        {0x0406, 1},
+        {0x0408, 2},
+        {0x040A, 2},
+        {0x040B, 1},
+        {0x040D, 2},
+        {0x040F, 2},
+        {0x0410, 1},
+        {0x0412, 2},
+        {0x0414, 2},
+        {0x0415, 1},
+        {0x0417, 2},
+        {0x0419, 2},
+        {0x041B, 2},
+        {0x041C, 1},
+        {0x041E, 2},
+        {0x041F, 1},
+        {0x0420, 1},
+        {0x0422, 2},
+        {0x0424, 2},
+        {0x0426, 2},
+        {0x0428, 2},
+        {0x042A, 2},
+        {0x042C, 2},
+        {0x042E, 2},
+        {0x042F, 1},
+        {0x0430, 1},
+        {0x0432, 2},
+        {0x0434, 2},
+        {0x0436, 2},
+        {0x0437, 1},
+        {0x0438, 1},
+        {0x043A, 2},
+        {0x043C, 2},
+        {0x043E, 2},
+        {0x043F, 1},
+        {0x0440, 1},
+        {0x0442, 2},
+        {0x0444, 2},
+        {0x0446, 2},
+        {0x0448, 2},
+        {0x044A, 2},
+        {0x044C, 2},
+        {0x044D, 1},
+        {0x044E, 1},
+        {0x0450, 2},
+        {0x0452, 2},
+        {0x0454, 2},
+        {0x0455, 1},
+        {0x0456, 1},
+        {0x0457, 1},
+        {0x0459, 2},
+        {0x045B, 2},
+        {0x045D, 2},
+        {0x045F, 2},
+        {0x0460, 1},
+        {0x0462, 2},
+        {0x0464, 2},
+        {0x0465, 1},
+        {0x0466, 1},
+        {0x0468, 2},
+        {0x046A, 2},
+        {0x046C, 2},
+        {0x046E, 2},
+        {0x0470, 2},
+        {0x0472, 2},
+        {0x0474, 2},
+        {0x0475, 1},
+        {0x0477, 2},
+        {0x0479, 2},
+        {0x047A, 1},
+        {0x047B, 1},
+        {0x047C, 1},
+        {0x047D, 1},
+        {0x047E, 1},
+        {0x0480, 2},
+        {0x0481, 1},
+        {0x0482, 1},
+        {0x0483, 1},
+        {0x0484, 1},
+        {0x0485, 1},
+        {0x0486, 1},
+        {0x0487, 1},
+        {0x0488, 1},
+        {0x0489, 1},
+        {0x048A, 1},
+        {0x048B, 1},
+        {0x048C, 1},
+        {0x048D, 1},
+        {0x048E, 1},
+        {0x048F, 1},
+        {0x0490, 1},
+        {0x0491, 1},
+        {0x0492, 1},
+        {0x0493, 1},
+        {0x0494, 1},
+        {0x0495, 1},
+        {0x0496, 1},
+        {0x0497, 1},
+        {0x0498, 1},
+        {0x0499, 1},
+        {0x049A, 1},
+        {0x049B, 1},
+        {0x049C, 1},
+        {0x049D, 1},
+        {0x049E, 1},
+        {0x049F, 1},
+        {0x04A0, 1},
+        {0x04A1, 1},
+        {0x04A2, 1},
+        {0x04A3, 1},
+        {0x04A4, 1},
+        {0x04A5, 1},
+        {0x04A6, 1},
+        {0x04A7, 1},
+        {0x04A8, 1},
+        {0x04A9, 1},
+        {0x04AA, 1},
+        {0x04AC, 2},
+        {0x04AE, 2},
+        {0x04AF, 1},
+        {0x04B0, 1},
+        {0x04B2, 2},
+        {0x04B4, 2},
+        {0x04B5, 1},
+        {0x04B7, 2},
+        {0x04B9, 2},
+        {0x04BA, 1},
+        {0x04BC, 2},
+        {0x04BE, 2},
+        {0x04BF, 1},
+        {0x04C1, 2},
+        {0x04C3, 2},
+        {0x04C4, 1},
+        {0x04C5, 1},
+        {0x04C7, 2},
+        {0x04C8, 1},
+        {0x04C9, 1},
+        {0x04CB, 2},
+        {0x04CC, 1},
+        {0x04CD, 1},
+        {0x04CF, 2},
+        {0x04D0, 1},
+        {0x04D1, 1},
+        {0x04D3, 2},
+        {0x04D4, 1},
+        {0x04D6, 2},
+        {0x04D8, 2},
+        {0x04DA, 2},
+        {0x6000, 1},
+        {0xF000, 1},
+        {0xF001, 1},
+        {0xF002, 1},
+        {0xF003, 1},
+        {0xF004, 1},
+        {0xF005, 1},
+        {0xF006, 1},
+        {0xF007, 1},
+        {0xF008, 1},
+        {0xF009, 1},
+        {0xF00A, 1},
+        {0xF00C, 2},
+        {0xF00E, 2},
+        {0xF010, 2},
+        {0xF012, 2},
+        {0xF013, 1},
+        {0xF015, 2},
+        {0xF016, 1},
+        {0xF018, 2},
+        {0xF019, 1},
+        {0xF01B, 2},
+        {0xF01D, 2},
+        {0xF01E, 1},
+        {0xF01F, 1},
+        {0xF020, 1},
+        {0xF021, 1},
+        {0xF022, 1},
+        {0xF023, 1},
+        {0xF024, 1},
+        {0xF025, 1},
+        {0xF027, 2},
+        {0xF029, 2},
+        {0xF02A, 1},
+        {0xF02B, 1},
+        {0xF02D, 2},
+        {0xF02F, 2},
+        {0xF031, 2},
+        {0xF033, 2},
+        {0xF035, 2},
+        {0xF037, 2},
+        {0xF039, 2},
+        {0xF03A, 1},
+        {0xF03C, 2},
+        {0xF03E, 2},
+        {0xF040, 2},
+        {0xF042, 2},
+        {0xF044, 2},
+        {0xF046, 2},
+        {0xF048, 2},
+        {0xF049, 1},
+        {0xF04B, 2},
+        {0xF04C, 1},
+        {0xF04D, 1},
+        {0xF04E, 1},
+        {0xF04F, 1},
+        {0xF050, 1},
+        {0xF051, 1},
+        {0xF052, 1},
+        {0xF054, 2},
+        {0xF056, 2},
+        {0xF058, 2},
+        {0xF05A, 2},
+        {0xF05C, 2},
+        {0xF05E, 2},
+        {0xF060, 2},
+        {0xF062, 2},
+        {0xF064, 2},
+        {0xF066, 2},
+        {0xF068, 2},
+        {0xF06A, 2},
+        {0xF06C, 2},
+        {0xF06E, 2},
+        {0xF06F, 1},
+        {0xF071, 2},
+        {0xF073, 2},
+        {0xF075, 2},
+        {0xF076, 1},
+        {0xF078, 2},
+        {0xF07A, 2},
+        {0xF07C, 2},
+        {0xF07E, 2},
+        {0xF07F, 1},
+        {0xF080, 1},
+        {0xF081, 1},
+        {0xF083, 2},
+        {0xF085, 2},
+        {0xF087, 2},
+        {0xF089, 2},
+        {0xF08A, 1},
+        {0xF08C, 2},
+        {0xF08E, 2},
+        {0xF08F, 1},
+        {0xF090, 1},
+        {0xF091, 1},
+        {0xF092, 1},
+        {0xF094, 2},
+        {0xF096, 2},
+        {0xF097, 1},
+        {0xF098, 1},
+        {0xF099, 1},
+        {0xF09A, 1},
+        {0xF09C, 2},
+        {0xF09E, 2},
+        {0xF09F, 1},
+        {0xF0A0, 1},
+        {0xF0A1, 1},
+        {0xF0A2, 1},
+        {0xF0A3, 1},
+        {0xF0A4, 1},
+        {0xF0A5, 1},
+        {0xF0A6, 1},
+        {0xF0A7, 1},
+        {0xF0A8, 1},
+        {0xF0A9, 1},
+        {0xF0AA, 1},
+        {0xF0AB, 1},
+        {0xF0AC, 1},
+        {0xF0AD, 1},
+        {0xF0AE, 1},
+        {0xF0AF, 1},
+        {0xF0B0, 1},
+        {0xF0B1, 1},
+        {0xF0B2, 1},
+        {0xF0B3, 1},
+        {0xF0B4, 1},
+        {0xF0B5, 1},
+        {0xF0B6, 1},
+        {0xF0B7, 1},
+        {0xF0B8, 1},
+        {0xF0B9, 1},
+        {0xF0BA, 1},
+        {0xF0BB, 1},
+        {0xF0BC, 1},
+        {0xF0BD, 1},
+        {0xF0BE, 1},
+        {0xF0BF, 1},
+        {0xF0C0, 1},
+        {0xF0C1, 1},
+        {0xF0C2, 1},
+        {0xF0C3, 1},
+        {0xF0C4, 1},
+        {0xF0C5, 1},
+        {0xF0C6, 1},
+        {0xF0C7, 1},
+        {0xF0C9, 2},
+        {0xF0CB, 2},
+        {0xF0CC, 1},
+        {0xF0CE, 2},
+        {0xF0D0, 2},
+        {0xF0D2, 2},
+        {0xF0D4, 2},
+        {0xF0D6, 2},
+        {0xF0D8, 2},
+        {0xF0DA, 2},
+        {0xF0DB, 1},
+        {0xF0DD, 2},
+    }};
+
+    ///@brief Every configuration register, sorted by address.  Read write, but not commands or set points.
+    constexpr std::array<RegisterSpan, 778> CONFIGURATION = {{
+        {0x0001, 1},
+        {0x0002, 1},
+        {0x0008, 2},
+        {0x000A, 2},
+        {0x000C, 2},
+        {0x000E, 2},
+        {0x0010, 2},
+        {0x0012, 2},
+        {0x0014, 2},
+        {0x0016, 2},
+        {0x0018, 2},
+        {0x001A, 2},
+        {0x001C, 2},
+        {0x001E, 2},
+        {0x0020, 2},
+        {0x0022, 2},
+        {0x0024, 2},
+        {0x0026, 2},
+        {0x0028, 2},
+        {0x002A, 2},
+        {0x002C, 2},
+        {0x002E, 2},
+        {0x002F, 1},
+        {0x0037, 2},
+        {0x0039, 2},
+        {0x003B, 2},
+        {0x003D, 2},
+        {0x003F, 2},
+        {0x0043, 2},
+        {0x0045, 2},
+        {0x0046, 1},
+        {0x0048, 2},
+        {0x004A, 2},
+        {0x004B, 1},
+        {0x004C, 1},
+        {0x004D, 1},
+        {0x004F, 2},
+        {0x0050, 1},
+        {0x0052, 2},
+        {0x0054, 2},
+        {0x0056, 2},
+        {0x0058, 2},
+        {0x005A, 2},
+        {0x005C, 2},
+        {0x005E, 2},
+        {0x0060, 2},
+        {0x0061, 1},
+        {0x0062, 1},
+        {0x0063, 1},
+        {0x0064, 1},
+        {0x0065, 1},
+        {0x0067, 2},
+        {0x0069, 2},
+        {0x006B, 2},
+        {0x006D, 2},
+        {0x006F, 2},
+        {0x0071, 2},
+        {0x0073, 2},
+        {0x0075, 2},
+        {0x0077, 2},
+        {0x0079, 2},
+        {0x007B, 2},
+        {0x007D, 2},
+        {0x007F, 2},
+        {0x0081, 2},
+        {0x0083, 2},
+        {0x0085, 2},
+        {0x0087, 2},
+        {0x0089, 2},
+        {0x008B, 2},
+        {0x008D, 2},
+        {0x008F, 2},
+        {0x0091, 2},
+        {0x0093, 2},
+        {0x0095, 2},
+        {0x0097, 2},
+        {0x0099, 2},
+        {0x009B, 2},
+        {0x009D, 2},
+        {0x009F, 2},
+        {0x00A1, 2},
+        {0x00A3, 2},
+        {0x00A5, 2},
+        {0x00A7, 2},
+        {0x00A9, 2},
+        {0x00AB, 2},
+        {0x00AD, 2},
+        {0x00AF, 2},
+        {0x00B1, 2},
+        {0x00B3, 2},
+        {0x00B5, 2},
+        {0x00B7, 2},
+        {0x00B9, 2},
+        {0x00BB, 2},
+        {0x00BD, 2},
+        {0x00BF, 2},
+        {0x00C1, 2},
+        {0x00C3, 2},
+        {0x00C5, 2},
+        {0x00C7, 2},
+        {0x00C9, 2},
+        {0x00CB, 2},
+        {0x00CD, 2},
+        {0x00CF, 2},
+        {0x00D1, 2},
+        {0x00D3, 2},
+        {0x00D5, 2},
+        {0x00D7, 2},
+        {0x00D9, 2},
+        {0x00DB, 2},
+        {0x00DD, 2},
+        {0x00DF, 2},
+        {0x00E1, 2},
+        {0x00E3, 2},
+        {0x00E5, 2},
+        {0x00E7, 2},
+        {0x00E9, 2},
+        {0x00EB, 2},
+        {0x00ED, 2},
+        {0x00EF, 2},
+        {0x00F1, 2},
+        {0x00F3, 2},
+        {0x00F5, 2},
+        {0x00F7, 2},
+        {0x00F9, 2},
+        {0x00FB, 2},
+        {0x00FD, 2},
+        {0x00FF, 2},
+        {0x0101, 2},
+        {0x0103, 2},
+        {0x0105, 2},
+        {0x0107, 2},
+        {0x0109, 2},
+        {0x010B, 2},
+        {0x010D, 2},
+        {0x010F, 2},
+        {0x0111, 2},
+        {0x0113, 2},
+        {0x0115, 2},
+        {0x0117, 2},
+        {0x0119, 2},
+        {0x011B, 2},
+        {0x011D, 2},
+        {0x011F, 2},
+        {0x0121, 2},
+        {0x0123, 2},
+        {0x0125, 2},
+        {0x0127, 2},
+        {0x0129, 2},
+        {0x012B, 2},
+        {0x012D, 2},
+        {0x012F, 2},
+        {0x0131, 2},
+        {0x0133, 2},
+        {0x0135, 2},
+        {0x0137, 2},
+        {0x0139, 2},
+        {0x013B, 2},
+        {0x013D, 2},
+        {0x013F, 2},
+        {0x0141, 2},
+        {0x0143, 2},
+        {0x0145, 2},
+        {0x0147, 2},
+        {0x0149, 2},
+        {0x014B, 2},
+        {0x014D, 2},
+        {0x014F, 2},
+        {0x0151, 2},
+        {0x0153, 2},
+        {0x0155, 2},
+        {0x0157, 2},
+        {0x0159, 2},
+        {0x015B, 2},
+        {0x015D, 2},
+        {0x015F, 2},
+        {0x0161, 2},
+        {0x0163, 2},
+        {0x0165, 2},
+        {0x0167, 2},
+        {0x0169, 2},
+        {0x016B, 2},
+        {0x016D, 2},
+        {0x016F, 2},
+        {0x0171, 2},
+        {0x0172, 1},
+        {0x0173, 1},
+        {0x0174, 1},
+        {0x0176, 2},
+        {0x0177, 1},
+        {0x0178, 1},
+        {0x0179, 1},
+        {0x017A, 1},
+        {0x017B, 1},
+        {0x017D, 2},
+        {0x017E, 1},
+        {0x017F, 1},
+        {0x0181, 2},
+        {0x0182, 1},
+        {0x0183, 1},
+        {0x0185, 2},
+        {0x0187, 2},
+        {0x0189, 2},
+        {0x018C, 2},
+        {0x018E, 2},
+        {0x0198, 2},
+        {0x019A, 2},
+        {0x019C, 2},
+        {0x019F, 1},
+        {0x01A1, 2},
+        {0x01A3, 2},
+        {0x01A5, 2},
+        {0x01A6, 1},
+        {0x01A8, 2},
+        {0x01AA, 2},
+        {0x01AC, 2},
+        {0x01AE, 2},
+        {0x01B8, 2},
+        {0x01BA, 2},
+        {0x01BB, 1},
+        {0x01BC, 1},
+        {0x01C9, 1},
+        {0x01CC, 2},
+        {0x01CE, 2},
+        {0x01D0, 2},
+        {0x01D2, 2},
+        {0x01D4, 2},
+        {0x01D6, 2},
+        {0x01D8, 2},
+        {0x01DA, 2},
+        {0x01DB, 1},
+        {0x01DD, 2},
+        {0x01DE, 1},
+        {0x01DF, 1},
+        {0x01E0, 1},
+        {0x01E1, 1},
+        {0x01E2, 1},
+        {0x01E3, 1},
+        {0x01E4, 1},
+        {0x01E5, 1},
+        {0x01E6, 1},
+        {0x01E7, 1},
+        {0x01F8, 1},
+        {0x01F9, 1},
+        {0x01FA, 1},
+        {0x01FB, 1},
+        {0x01FD, 2},
+        {0x01FF, 2},
+        {0x0201, 2},
+        {0x0203, 2},
+        {0x0207, 2},
+        {0x0209, 2},
+        {0x020B, 2},
+        {0x020D, 2},
+        {0x020F, 2},
+        {0x021B, 1},
+        {0x021C, 1},
+        {0x021E, 2},
+        {0x0220, 2},
+        {0x0222, 2},
+        {0x0224, 2},
+        {0x0226, 2},
+        {0x0228, 2},
+        {0x0229, 1},
+        {0x022B, 2},
+        {0x0230, 1},
+        {0x0231, 1},
+        {0x0232, 1},
+        {0x0233, 1},
+        {0x0234, 1},
+        {0x0235, 1},
+        {0x0236, 1},
+        {0x0237, 1},
+        {0x0238, 1},
+        {0x0239, 1},
+        {0x023A, 1},
+        {0x023B, 1},
+        {0x023C, 1},
+        {0x023D, 1},
+        {0x023E, 1},
+        {0x023F, 1},
+        {0x0240, 1},
+        {0x0241, 1},
+        {0x0242, 1},
+        {0x0243, 1},
+        {0x0244, 1},
+        {0x0245, 1},
+        {0x0246, 1},
+        {0x0247, 1},
+        {0x0248, 1},
+        {0x0249, 1},
+        {0x024A, 1},
+        {0x024B, 1},
+        {0x024C, 1},
+        {0x024D, 1},
+        {0x024E, 1},
+        {0x024F, 1},
+        {0x0250, 1},
+        {0x0251, 1},
+        {0x0252, 1},
+        {0x0253, 1},
+        {0x0254, 1},
+        {0x0255, 1},
+        {0x0256, 1},
+        {0x0257, 1},
+        {0x0258, 1},
+        {0x0259, 1},
+        {0x025B, 1},
+        {0x025C, 1},
+        {0x025D, 1},
+        {0x025E, 1},
+        {0x025F, 1},
+        {0x0260, 1},
+        {0x0261, 1},
+        {0x0262, 1},
+        {0x0263, 1},
+        {0x0264, 1},
+        {0x0265, 1},
+        {0x0266, 1},
+        {0x0267, 1},
+        {0x0268, 1},
+        {0x0269, 1},
+        {0x026A, 1},
+        {0x026B, 1},
+        {0x026C, 1},
+        {0x026D, 1},
+        {0x026E, 1},
+        {0x026F, 1},
+        {0x0270, 1},
+        {0x0271, 1},
+        {0x0272, 1},
+        {0x0273, 1},
+        {0x0274, 1},
+        {0x0275, 1},
+        {0x0276, 1},
+        {0x0277, 1},
+        {0x0278, 1},
+        {0x0279, 1},
+        {0x027A, 1},
+        {0x027B, 1},
+        {0x027C, 1},
+        {0x027D, 1},
+        {0x027E, 1},
+        {0x027F, 1},
+        {0x0280, 1},
+        {0x0281, 1},
+        {0x0282, 1},
+        {0x0283, 1},
+        {0x0284, 1},
+        {0x0285, 1},
+        {0x0286, 1},
+        {0x0287, 1},
+        {0x0288, 1},
+        {0x0289, 1},
+        {0x028A, 1},
+        {0x028B, 1},
+        {0x028C, 1},
+        {0x028D, 1},
+        {0x028E, 1},
+        {0x028F, 1},
+        {0x0290, 1},
+        {0x0291, 1},
+        {0x0292, 1},
+        {0x0293, 1},
+        {0x0294, 1},
+        {0x0295, 1},
+        {0x0296, 1},
+        {0x0297, 1},
+        {0x0298, 1},
+        {0x0299, 1},
+        {0x029A, 1},
+        {0x029B, 1},
+        {0x029C, 1},
+        {0x029D, 1},
+        {0x029E, 1},
+        {0x029F, 1},
+        {0x02A0, 1},
+        {0x02A1, 1},
+        {0x02A2, 1},
+        {0x02A3, 1},
+        {0x02A4, 1},
+        {0x02A5, 1},
+        {0x02A6, 1},
+        {0x02A7, 1},
+        {0x02A8, 1},
+        {0x02A9, 1},
+        {0x02AA, 1},
+        {0x02AB, 1},
+        {0x02AC, 1},
+        {0x02AD, 1},
+        {0x02AE, 1},
+        {0x02AF, 1},
+        {0x02B0, 1},
+        {0x02B1, 1},
+        {0x02B2, 1},
+        {0x02B3, 1},
+        {0x02B4, 1},
+        {0x02B5, 1},
+        {0x02B6, 1},
+        {0x02B7, 1},
+        {0x02B8, 1},
+        {0x02B9, 1},
+        {0x02BA, 1},
+        {0x02BB, 1},
+        {0x02BC, 1},
+        {0x02BD, 1},
+        {0x02BE, 1},
+        {0x02BF, 1},
+        {0x02C0, 1},
+        {0x02C1, 1},
+        {0x02C2, 1},
+        {0x02C3, 1},
+        {0x02C4, 1},
+        {0x02C5, 1},
+        {0x02C6, 1},
+        {0x02C7, 1},
+        {0x02C8, 1},
+        {0x02C9, 1},
+        {0x02CA, 1},
+        {0x02CB, 1},
+        {0x02CC, 1},
+        {0x02CD, 1},
+        {0x02CE, 1},
+        {0x02CF, 1},
+        {0x02D0, 1},
+        {0x02D1, 1},
+        {0x02D2, 1},
+        {0x02D3, 1},
+        {0x02D4, 1},
+        {0x02D5, 1},
+        {0x02D6, 1},
+        {0x02D7, 1},
+        {0x02D8, 1},
+        {0x02D9, 1},
+        {0x02DA, 1},
+        {0x02DB, 1},
+        {0x02DC, 1},
+        {0x02DD, 1},
+        {0x02DE, 1},
+        {0x02DF, 1},
+        {0x02E0, 1},
+        {0x02E1, 1},
+        {0x02E2, 1},
+        {0x02E3, 1},
+        {0x02E4, 1},
+        {0x02E6, 2},
+        {0x02E8, 2},
+        {0x02EC, 2},
+        {0x02ED, 1},
+        {0x02EE, 1},
+        {0x02F0, 2},
+        {0x02F2, 2},
+        {0x02F6, 2},
+        {0x02F8, 2},
+        {0x02FA, 2},
+        {0x02FB, 1},
+        {0x02FD, 2},
+        {0x02FF, 2},
+        {0x0301, 2},
+        {0x030E, 2},
+        {0x0310, 2},
+        {0x0312, 2},
+        {0x0315, 1},
+        {0x0316, 1},
+        {0x0317, 1},
+        {0x0318, 1},
+        {0x031A, 2},
+        {0x031C, 2},
+        {0x031E, 2},
+        {0x0320, 2},
+        {0x0322, 2},
+        {0x0324, 2},
+        {0x0326, 1},
+        {0x0328, 2},
+        {0x032A, 2},
+        {0x032C, 2},
+        {0x032E, 2},
+        {0x0330, 2},
+        {0x0332, 2},
+        {0x0334, 2},
+        {0x0336, 2},
+        {0x033A, 2},
+        {0x033C, 2},
+        {0x033E, 2},
+        {0x033F, 1},
+        {0x0340, 1},
+        {0x0341, 1},
+        {0x0342, 1},
+        {0x0343, 1},
+        {0x0344, 1},
+        {0x0346, 1},
+        {0x0348, 2},
+        {0x0349, 1},
+        {0x034A, 1},
+        {0x034B, 1},
+        {0x034C, 1},
+        {0x034E, 2},
+        {0x034F, 1},
+        {0x0350, 1},
+        {0x0351, 1},
+        {0x0352, 1},
+        {0x0353, 1},
+        {0x0354, 1},
+        {0x0356, 1},
+        {0x0358, 2},
+        {0x0359, 1},
+        {0x035A, 1},
+        {0x035B, 1},
+        {0x035C, 1},
+        {0x036E, 2},
+        {0x0370, 2},
+        {0x0372, 2},
+        {0x0374, 2},
+        {0x0376, 2},
+        {0x0378, 2},
+        {0x037A, 2},
+        {0x037C, 2},
+        {0x0388, 2},
+        {0x038A, 2},
+        {0x038C, 2},
+        {0x038E, 2},
+        {0x038F, 1},
+        {0x0390, 1},
+        {0x0391, 1},
+        {0x0392, 1},
+        {0x0396, 2},
+        {0x0398, 2},
+        {0x039A, 2},
+        {0x039B, 1},
+        {0x039C, 1},
+        {0x039D, 1},
+        {0x039E, 1},
+        {0x039F, 1},
+        {0x03A0, 1},
+        {0x03A1, 1},
+        {0x03A2, 1},
+        {0x03A4, 2},
+        {0x03A5, 1},
+        {0x03A7, 2},
+        {0x03A9, 2},
+        {0x03AA, 1},
+        {0x03AB, 1},
+        {0x03AC, 1},
+        {0x03AD, 1},
+        {0x03AE, 1},
+        {0x03B0, 2},
+        {0x03B2, 2},
+        {0x03B4, 2},
+        {0x03B5, 1},
+        {0x03B6, 1},
+        {0x03B7, 1},
+        {0x03B9, 2},
+        {0x03BA, 1},
+        {0x03BB, 1},
+        {0x03BC, 1},
+        {0x03C7, 1},
+        {0x03C8, 1},
+        {0x03DF, 1},
+        {0x03E0, 1},
+        {0x03E6, 2},
+        {0x03E8, 2},
+        {0x03E9, 1},
+        {0x03EA, 1},
+        {0x03EB, 1},
+        {0x03F1, 2},
+        {0x03F3, 2},
+        {0x03F5, 2},
+        {0x03F8, 1},
+        {0x03FA, 2},
+        {0x03FD, 1},
+        {0x03FE, 1},
+        {0x0400, 2},
+        {0x0401, 1},
+        {0x0406, 1},
+        {0x0408, 2},
+        {0x040A, 2},
+        {0x040B, 1},
+        {0x040D, 2},
+        {0x040F, 2},
+        {0x0410, 1},
+        {0x0412, 2},
+        {0x0414, 2},
+        {0x0415, 1},
+        {0x0417, 2},
+        {0x0419, 2},
+        {0x041B, 2},
+        {0x041C, 1},
+        {0x041E, 2},
+        {0x041F, 1},
+        {0x0420, 1},
+        {0x0422, 2},
+        {0x0424, 2},
+        {0x0426, 2},
+        {0x0428, 2},
+        {0x042A, 2},
+        {0x042C, 2},
+        {0x042E, 2},
+        {0x043A, 2},
+        {0x043C, 2},
+        {0x043E, 2},
+        {0x043F, 1},
+        {0x0440, 1},
+        {0x0442, 2},
+        {0x0448, 2},
+        {0x044A, 2},
+        {0x044C, 2},
+        {0x044D, 1},
+        {0x0454, 2},
+        {0x0455, 1},
+        {0x0456, 1},
+        {0x0457, 1},
+        {0x045D, 2},
+        {0x045F, 2},
+        {0x0460, 1},
+        {0x0462, 2},
+        {0x0464, 2},
+        {0x0465, 1},
+        {0x0466, 1},
+        {0x046C, 2},
+        {0x046E, 2},
+        {0x0470, 2},
+        {0x0472, 2},
+        {0x0474, 2},
+        {0x0475, 1},
+        {0x0477, 2},
+        {0x047B, 1},
+        {0x047C, 1},
+        {0x047D, 1},
+        {0x047E, 1},
+        {0x0480, 2},
+        {0x0481, 1},
+        {0x0482, 1},
+        {0x0483, 1},
+        {0x0484, 1},
+        {0x0485, 1},
+        {0x0486, 1},
+        {0x0487, 1},
+        {0x0488, 1},
+        {0x0489, 1},
+        {0x048A, 1},
+        {0x048B, 1},
+        {0x048C, 1},
+        {0x048D, 1},
+        {0x048E, 1},
+        {0x048F, 1},
+        {0x0490, 1},
+        {0x0491, 1},
+        {0x0492, 1},
+        {0x0493, 1},
+        {0x0494, 1},
+        {0x0495, 1},
+        {0x0496, 1},
+        {0x0497, 1},
+        {0x0498, 1},
+        {0x0499, 1},
+        {0x049A, 1},
+        {0x049B, 1},
+        {0x049C, 1},
+        {0x049D, 1},
+        {0x049E, 1},
+        {0x049F, 1},
+        {0x04A0, 1},
+        {0x04A1, 1},
+        {0x04A2, 1},
+        {0x04A3, 1},
+        {0x04A4, 1},
+        {0x04A5, 1},
+        {0x04A6, 1},
+        {0x04A7, 1},
+        {0x04A8, 1},
+        {0x04A9, 1},
+        {0x04AA, 1},
+        {0x04AC, 2},
+        {0x04AF, 1},
+        {0x04B0, 1},
+        {0x04B2, 2},
+        {0x04B4, 2},
+        {0x04B5, 1},
+        {0x04B7, 2},
+        {0x04B9, 2},
+        {0x04BA, 1},
+        {0x04BC, 2},
+        {0x04BE, 2},
+        {0x04BF, 1},
+        {0x04C1, 2},
+        {0x04C3, 2},
+        {0x04C4, 1},
+        {0x04C5, 1},
+        {0x04C7, 2},
+        {0x04C8, 1},
+        {0x04C9, 1},
+        {0x04CB, 2},
+        {0x04CC, 1},
+        {0x04CD, 1},
+        {0x04CF, 2},
+        {0x04D0, 1},
+        {0x04D1, 1},
+        {0x04D3, 2},
+        {0x04D4, 1},
+        {0x04D6, 2},
+        {0x04D8, 2},
+        {0x04DA, 2},
+        {0xF000, 1},
+        {0xF004, 1},
+        {0xF005, 1},
+        {0xF006, 1},
+        {0xF007, 1},
+        {0xF008, 1},
+        {0xF012, 2},
+        {0xF013, 1},
+        {0xF015, 2},
+        {0xF016, 1},
+        {0xF01E, 1},
+        {0xF01F, 1},
+        {0xF020, 1},
+        {0xF021, 1},
+        {0xF023, 1},
+        {0xF024, 1},
+        {0xF027, 2},
+        {0xF029, 2},
+        {0xF031, 2},
+        {0xF033, 2},
+        {0xF035, 2},
+        {0xF037, 2},
+        {0xF039, 2},
+        {0xF03A, 1},
+        {0xF03C, 2},
+        {0xF03E, 2},
+        {0xF040, 2},
+        {0xF042, 2},
+        {0xF044, 2},
+        {0xF046, 2},
+        {0xF048, 2},
+        {0xF049, 1},
+        {0xF04B, 2},
+        {0xF04C, 1},
+        {0xF054, 2},
+        {0xF056, 2},
+        {0xF058, 2},
+        {0xF05A, 2},
+        {0xF05C, 2},
+        {0xF05E, 2},
+        {0xF060, 2},
+        {0xF062, 2},
+        {0xF064, 2},
+        {0xF066, 2},
+        {0xF068, 2},
+        {0xF06A, 2},
+        {0xF06C, 2},
+        {0xF06E, 2},
+        {0xF06F, 1},
+        {0xF071, 2},
+        {0xF073, 2},
+        {0xF075, 2},
+        {0xF076, 1},
+        {0xF078, 2},
+        {0xF07A, 2},
+        {0xF07C, 2},
+        {0xF07E, 2},
+        {0xF07F, 1},
+        {0xF08A, 1},
+        {0xF08F, 1},
+        {0xF090, 1},
+        {0xF091, 1},
+        {0xF092, 1},
+        {0xF096, 2},
+        {0xF097, 1},
+        {0xF098, 1},
+        {0xF099, 1},
+        {0xF09C, 2},
+        {0xF09E, 2},
+        {0xF09F, 1},
+        {0xF0A0, 1},
+        {0xF0A5, 1},
+        {0xF0A6, 1},
+        {0xF0CC, 1},
+        {0xF0D8, 2},
+        {0xF0DB, 1},
+    }};
+
+    ///@brief Check if a register starts an entry in `CONFIGURATION`.
+    constexpr bool isConfiguration(const uint16_t address)
+    {
+        for (const auto& span : CONFIGURATION)
+        {
+            if (span.address == address)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
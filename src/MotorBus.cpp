@@ -0,0 +1,399 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "MotorBus.hpp"
+#include "ModbusDefinitions.hpp"
+#include "MotionGRegisters.hpp"
+
+#include <algorithm>
+
+MotorBus::MotorBus(HardwareSerial& serial):
+    serial{serial},
+    transport(serial),
+    async(transport)
+{
+}
+
+void MotorBus::begin(const uint32_t baud, const uint32_t config, const int8_t rxPin, const int8_t txPin)
+{
+    this->baud = baud;
+    this->config = config;
+    serial.setRxBufferSize(sizeof(ModbusADU));
+    serial.setTxBufferSize(sizeof(ModbusADU));
+    serial.begin(baud, config, rxPin, txPin);
+    transport.begin(baud, config);
+}
+
+bool MotorBus::attach(const uint8_t id)
+{
+    const auto end = drives.begin() + driveCount;
+    if (driveCount == drives.size() || std::find(drives.begin(), end, id) != end)
+    {
+        return false;
+    }
+    drives[driveCount++] = id;
+    return true;
+}
+
+void MotorBus::setBaud(const uint32_t baud)
+{
+    serial.flush();
+    this->baud = baud;
+    serial.updateBaudRate(baud);
+    transport.begin(baud, config);
+    // Round trip times at the old rate no longer apply.
+    async.getRttEstimator().reset();
+}
+
+ModbusRTUMasterError MotorBus::writeBaud(const uint8_t id, const uint32_t baud, const uint32_t timeout)
+{
+    // Skip the shadow cache, so changing rates never counts as an unsaved change.
+    std::array<uint16_t, MotionG::ModbusBaudrate::length> raw = {};
+    MotionG::ModbusBaudrate::encode(baud, raw.data());
+    return writeRegisters(id, MotionG::ModbusBaudrate::address, raw.data(), raw.size(), timeout);
+}
+
+bool MotorBus::verifyBaud(const uint8_t id, const uint32_t expected, bool& matches)
+{
+    // The drive may need a moment to switch, so allow a few tries.
+    for (auto attempt = 0; attempt < 3; attempt++)
+    {
+        std::array<uint16_t, MotionG::ModbusBaudrate::length> raw = {};
+        if (readRegisters(id, MotionG::ModbusBaudrate::address, raw.data(), raw.size()) == MODBUS_RTU_MASTER_SUCCESS)
+        {
+            matches = MotionG::ModbusBaudrate::decode(raw.data()) == expected;
+            return true;
+        }
+    }
+    matches = false;
+    return false;
+}
+
+bool MotorBus::switchBaud(const uint8_t* ids, const size_t count, const uint32_t from, const uint32_t to)
+{
+    // Every drive switches right after acknowledging, so tell them all before following.
+    size_t told = 0;
+    auto rejected = false;
+    for (; told < count; told++)
+    {
+        if (writeBaud(ids[told], to) == MODBUS_RTU_MASTER_EXCEPTION_RESPONSE)
+        {
+            // Rate not supported.
+            rejected = true;
+            break;
+        }
+    }
+    if (told == 0)
+    {
+        return false;
+    }
+
+    // The acknowledgement may be lost in the switch, so only trust a read at the new rate.
+    setBaud(to);
+    if (not rejected)
+    {
+        auto answered = true;
+        for (size_t i = 0; i < count && answered; i++)
+        {
+            auto matches = false;
+            answered = verifyBaud(ids[i], to, matches);
+        }
+        if (answered)
+        {
+            return true;
+        }
+    }
+
+    // Drives are never left split across rates.  Anything which switched is sent back.
+    for (size_t i = 0; i < told; i++)
+    {
+        writeBaud(ids[i], from);
+    }
+    setBaud(from);
+    for (size_t i = 0; i < told; i++)
+    {
+        auto matches = false;
+        if (verifyBaud(ids[i], from, matches) && not matches)
+        {
+            // Write landed, but only takes effect on restart.  Undo it, so the drive does not vanish later.
+            writeBaud(ids[i], from);
+        }
+    }
+    return false;
+}
+
+uint32_t MotorBus::negotiateBaud(const uint32_t maxBaud)
+{
+    const auto original = baud;
+
+    // A drive which is missing now would make every rate look unsupported.
+    std::array<uint8_t, MAX_DRIVES> present = {};
+    size_t count = 0;
+    for (size_t i = 0; i < driveCount; i++)
+    {
+        auto matches = false;
+        if (verifyBaud(drives[i], original, matches))
+        {
+            present[count++] = drives[i];
+        }
+    }
+    if (count == 0)
+    {
+        return baud;
+    }
+
+    for (const auto candidate : BAUD_RATES)
+    {
+        // Only slow down if the current rate is too fast.
+        if (candidate > maxBaud || candidate == original || (original <= maxBaud && candidate < original))
+        {
+            continue;
+        }
+        if (switchBaud(present.data(), count, original, candidate))
+        {
+            return candidate;
+        }
+    }
+    return baud;
+}
+
+bool MotorBus::recoverDrive(const uint8_t id)
+{
+    const auto current = baud;
+    if (current == DEFAULT_BAUD)
+    {
+        return false;
+    }
+
+    // Switching resets the adaptive timeout, so take it from the current rate.
+    const auto timeout = async.getRttEstimator().getTimeout();
+
+    // Every other drive ignores requests for another id, so only this one moves.
+    setBaud(DEFAULT_BAUD);
+    const auto result = writeBaud(id, current, std::min(timeout * (current / DEFAULT_BAUD), async.getRttEstimator().getCeiling()));
+    setBaud(current);
+    if (result == MODBUS_RTU_MASTER_EXCEPTION_RESPONSE)
+    {
+        return false;
+    }
+    std::array<uint16_t, MotionG::ModbusBaudrate::length> raw = {};
+    return readRegisters(id, MotionG::ModbusBaudrate::address, raw.data(), raw.size(), timeout) == MODBUS_RTU_MASTER_SUCCESS;
+}
+
+ModbusRTUMasterError MotorBus::saveToFlash(const uint8_t id, const uint32_t timeout)
+{
+    const auto current = baud;
+    if (current != DEFAULT_BAUD)
+    {
+        const auto result = writeBaud(id, DEFAULT_BAUD);
+        if (result == MODBUS_RTU_MASTER_EXCEPTION_RESPONSE)
+        {
+            return result;
+        }
+        // The acknowledgement may be lost in the switch, so only trust a read at the new rate.
+        setBaud(DEFAULT_BAUD);
+        auto matches = false;
+        if (not verifyBaud(id, DEFAULT_BAUD, matches))
+        {
+            setBaud(current);
+            return MODBUS_RTU_MASTER_RESPONSE_TIMEOUT;
+        }
+        if (not matches)
+        {
+            writeBaud(id, current);
+            setBaud(current);
+            return MODBUS_RTU_MASTER_UNEXPECTED_VALUE;
+        }
+    }
+
+    std::array<uint16_t, MotionG::ControlCmd::length> raw = {};
+    MotionG::ControlCmd::encode(0x01, raw.data());
+    // Some drives do not answer until the save is done, so allow the worst case.
+    auto result = writeRegisters(id, MotionG::ControlCmd::address, raw.data(), raw.size(), async.getRttEstimator().getCeiling());
+    // Switching back before the save is done could be what gets saved.
+    const auto start = millis();
+    while (result == MODBUS_RTU_MASTER_SUCCESS)
+    {
+        std::array<uint16_t, MotionG::FlashStorageStatus::length> status = {};
+        const auto read = readRegisters(id, MotionG::FlashStorageStatus::address, status.data(), status.size());
+        // Anything else means it is still busy.
+        if (read == MODBUS_RTU_MASTER_SUCCESS && MotionG::FlashStorageStatus::decode(status.data()) == 0)
+        {
+            break;
+        }
+        if (millis() - start >= timeout)
+        {
+            result = read != MODBUS_RTU_MASTER_SUCCESS ? read : MODBUS_RTU_MASTER_RESPONSE_TIMEOUT;
+        }
+    }
+
+    if (current != DEFAULT_BAUD)
+    {
+        writeBaud(id, current);
+        setBaud(current);
+    }
+    return result;
+}
+
+uint32_t MotorBus::getTimeout(const uint32_t bytes) const
+{
+    // 1 start, 8 data, and 1 stop bit.  Rounded up.
+    const auto rate = std::max<uint32_t>(baud, 1);
+    const auto wireTime = (bytes * 10 * 1000 + rate - 1) / rate;
+    return async.getRttEstimator().getTimeout() + wireTime;
+}
+
+void MotorBus::watchBaud(const bool reachedDrive)
+{
+    if (reachedDrive)
+    {
+        failedPolls = 0;
+        huntingBaud = false;
+        return;
+    }
+    // Every drive gets its share of polls before the whole bus is given up on.
+    if (++failedPolls < BAUD_WATCHDOG_FAILURES * std::max<size_t>(driveCount, 1))
+    {
+        return;
+    }
+    failedPolls = 0;
+
+    // Default first, since that is where a power cycled drive comes back.  Then every other rate, in turn.
+    auto next = DEFAULT_BAUD;
+    if (huntingBaud)
+    {
+        const auto current = std::find(BAUD_RATES.begin(), BAUD_RATES.end(), baud);
+        next = current == BAUD_RATES.end() || current + 1 == BAUD_RATES.end() ? BAUD_RATES.front() : *(current + 1);
+    }
+    huntingBaud = true;
+    if (next != baud)
+    {
+        setBaud(next);
+    }
+}
+
+void MotorBus::setTimeoutLimits(const uint32_t floor, const uint32_t ceiling)
+{
+    async.getRttEstimator().setLimits(floor, ceiling);
+}
+
+ModbusRTUMasterError MotorBus::transact(ModbusADU& adu, const uint32_t timeout)
+{
+    if (yieldHook != nullptr)
+    {
+        yieldHook();
+    }
+    auto done = false;
+    auto result = MODBUS_RTU_MASTER_UNKNOWN_COMM_ERROR;
+    const auto handle = async.submit(adu, [&](ModbusADU& response, const ModbusRTUMasterError error)
+    {
+        copyAdu(adu, response);
+        result = error;
+        done = true;
+    }, timeout);
+    if (handle == INVALID_TRANSACTION)
+    {
+        return MODBUS_RTU_MASTER_UNKNOWN_COMM_ERROR;
+    }
+    while (true)
+    {
+        async.update();
+        if (done)
+        {
+            return result;
+        }
+        // Woken as soon as the response lands.  The tick limit is for timeouts.
+        transport.wait(1);
+    }
+}
+
+ModbusRTUMasterError MotorBus::readRegisters(const uint8_t id, const uint16_t address, uint16_t* registers, const uint16_t quantity, const uint32_t timeout)
+{
+    auto adu = ModbusADU();
+    prepareReadHoldingRegisters(adu, id, address, quantity);
+    const auto result = transact(adu, timeout);
+    if (result != MODBUS_RTU_MASTER_SUCCESS)
+    {
+        return result;
+    }
+    if (adu.getDataLen() != 1 + quantity * 2)
+    {
+        return MODBUS_RTU_MASTER_UNEXPECTED_LENGTH;
+    }
+    if (adu.data[0] != quantity * 2)
+    {
+        return MODBUS_RTU_MASTER_UNEXPECTED_BYTE_COUNT;
+    }
+    for (uint16_t i = 0; i < quantity; i++)
+    {
+        registers[i] = getResponseRegister(adu, i);
+    }
+    return result;
+}
+
+ModbusRTUMasterError MotorBus::writeRegisters(const uint8_t id, const uint16_t address, const uint16_t* registers, const uint16_t quantity, const uint32_t timeout)
+{
+    auto adu = ModbusADU();
+    if (quantity == 1)
+    {
+        prepareWriteSingleRegister(adu, id, address, registers[0]);
+    }
+    else
+    {
+        prepareWriteMultipleRegisters(adu, id, address, registers, quantity);
+    }
+    const auto result = transact(adu, timeout);
+    if (result != MODBUS_RTU_MASTER_SUCCESS)
+    {
+        return result;
+    }
+    // Both echo the address, then either the value or the quantity.
+    if (adu.getDataLen() != 4)
+    {
+        return MODBUS_RTU_MASTER_UNEXPECTED_LENGTH;
+    }
+    if (adu.getDataRegister(0) != address)
+    {
+        return MODBUS_RTU_MASTER_UNEXPECTED_ADDRESS;
+    }
+    if (adu.getDataRegister(1) != (quantity == 1 ? registers[0] : quantity))
+    {
+        return quantity == 1 ? MODBUS_RTU_MASTER_UNEXPECTED_VALUE : MODBUS_RTU_MASTER_UNEXPECTED_QUANTITY;
+    }
+    return result;
+}
+
+ModbusRTUMasterError MotorBus::writeReadRegisters(const uint8_t id, const uint16_t writeAddress, const uint16_t* registers, const uint16_t writeQuantity,
+                                              const uint16_t readAddress, uint16_t* readback, const uint16_t readQuantity, uint8_t& exception,
+                                              const uint32_t timeout)
+{
+    exception = 0;
+    auto adu = ModbusADU();
+    prepareReadWriteMultipleRegisters(adu, id, readAddress, readQuantity, writeAddress, registers, writeQuantity);
+    const auto result = transact(adu, timeout);
+    if (result == MODBUS_RTU_MASTER_EXCEPTION_RESPONSE)
+    {
+        exception = adu.data[0];
+    }
+    if (result != MODBUS_RTU_MASTER_SUCCESS)
+    {
+        return result;
+    }
+    if (adu.getDataLen() != 1 + readQuantity * 2)
+    {
+        return MODBUS_RTU_MASTER_UNEXPECTED_LENGTH;
+    }
+    if (adu.data[0] != readQuantity * 2)
+    {
+        return MODBUS_RTU_MASTER_UNEXPECTED_BYTE_COUNT;
+    }
+    for (uint16_t i = 0; i < readQuantity; i++)
+    {
+        readback[i] = getResponseRegister(adu, i);
+    }
+    return result;
+}
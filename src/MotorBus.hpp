@@ -0,0 +1,291 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <ModbusADU.h>
+#include <ModbusRTUMaster.h>
+#include <array>
+#include <functional>
+
+#include "AsyncModbusMaster.hpp"
+#include "RtuTransport.hpp"
+
+/**
+ * @brief One RS485 bus, shared by any number of drives.
+ * @details Owns the UART, framing, and transaction queue, so drives on the same wire never talk over each other.
+ *          Every drive must run at the same baud rate, so rate changes apply to the whole bus.
+ *          <br/>
+ *          Blocking methods sleep until their response arrives, and must only be called while `isIdle()`.
+ * @warning Not thread safe.
+ */
+class MotorBus
+{
+public:
+    ///@brief Drives always start at this rate.  `saveToFlash()` keeps it that way.
+    static constexpr uint32_t DEFAULT_BAUD = 115200;
+
+    ///@brief Every rate tried, fastest first.
+    static constexpr std::array<uint32_t, 4> BAUD_RATES = {921600, 460800, 230400, DEFAULT_BAUD};
+
+    ///@brief Consecutive failed status polls per drive, before trying another baud rate.
+    static constexpr uint8_t BAUD_WATCHDOG_FAILURES = 5;
+
+    ///@brief Most drives one bus can hold.
+    static constexpr size_t MAX_DRIVES = 4;
+
+    explicit MotorBus(HardwareSerial& serial);
+    MotorBus(const MotorBus&) = delete;
+    MotorBus(const MotorBus&&) = delete;
+
+    /**
+     * @copydoc HardwareSerial::begin
+     */
+    void begin(uint32_t baud, uint32_t config, int8_t rxPin, int8_t txPin);
+
+    /**
+     * @brief Add a drive, so baud rate changes include it.
+     * @return false if the bus is full, or the node id is taken.
+     */
+    bool attach(uint8_t id);
+
+    /**
+     * @brief Switch every drive and this end to the fastest baud rate they all support.
+     * @details Each rate in `BAUD_RATES` up to `maxBaud` is tried in turn, fastest first.
+     *          Slower rates are only tried if the current one is faster than `maxBaud`.
+     *          Only drives which answer at the current rate take part.
+     *          They are all told to switch, then this end follows and checks each one with a read.
+     *          If any fails, every drive is switched back.
+     *          <br/>
+     *          The new rate is only ever in the drive's RAM.  `saveToFlash()` keeps it out of flash,
+     *          so a power cycled drive comes back at `DEFAULT_BAUD`, where stock firmware and vendor tools expect it.
+     *          See `recoverDrive()`.
+     * @param maxBaud Fastest rate to try.
+     * @return The rate now in use.
+     */
+    uint32_t negotiateBaud(uint32_t maxBaud);
+
+    /**
+     * @brief Bring a drive which was power cycled back up to the bus rate.
+     * @details Briefly drops to `DEFAULT_BAUD` to tell it the current rate, without disturbing the other drives.
+     *          Uses short, fixed timeouts, so a drive which is really gone only holds up the bus briefly.
+     * @return true if the drive answers at the current rate.
+     */
+    bool recoverDrive(uint8_t id);
+
+    /**
+     * @brief Save a drive's active settings to flash, and wait for the save to finish.
+     * @details Drives save every active setting, the baud rate included, and power up at whatever was saved.
+     *          So at any faster rate, the drive is dropped to `DEFAULT_BAUD` for the save, then told the bus rate again.
+     *          The other drives ignore all this, as it is addressed to another id, but are not polled until it is done.
+     *          If the drive does not come back up, `recoverDrive()` can fetch it.
+     * @param timeout Longest the save may take, in milliseconds.
+     * @return Error saving.  Nothing is saved if the drive could not be moved to `DEFAULT_BAUD`.
+     */
+    ModbusRTUMasterError saveToFlash(uint8_t id, uint32_t timeout);
+
+    [[nodiscard]] uint32_t getBaud() const
+    {
+        return baud;
+    }
+
+    /**
+     * @brief Response timeout for a transaction with large frames.
+     * @details The adaptive timeout is measured with short frames, so add the time to send and receive these.
+     * @param bytes Request and response, together.
+     * @return Timeout, in milliseconds.
+     */
+    [[nodiscard]] uint32_t getTimeout(uint32_t bytes) const;
+
+    /**
+     * @brief Recover from losing every drive, in case they are at another baud rate.
+     * @details After `BAUD_WATCHDOG_FAILURES` failed polls per drive in a row, with none succeeding, moves on to the next rate.
+     *          The default rate is always tried first.
+     * @param reachedDrive Whether a status poll got an answer.
+     */
+    void watchBaud(bool reachedDrive);
+
+    /**
+     * @brief Called before every blocking transaction is queued.
+     * @details The oldest queued transaction goes first, so anything submitted here goes ahead of it.
+     *          Lets the bus' owner fit urgent traffic between the steps of a long sequence.
+     * @param hook May submit non-blocking transactions, but must not block.  nullptr to remove.
+     */
+    void setYieldHook(const std::function<void()>& hook)
+    {
+        yieldHook = hook;
+    }
+
+    /**
+     * @copydoc RtuTransport::setRecorder
+     */
+    void setRecorder(FlightRecorder* recorder, const uint8_t channel)
+    {
+        transport.setRecorder(recorder, channel);
+    }
+
+    /**
+     * @brief Run a transaction to completion, sleeping until the response arrives.
+     * @param adu Request.  Changed to the response, if there is one.
+     * @param timeout Response timeout, in milliseconds.  0 uses the adaptive timeout.
+     */
+    ModbusRTUMasterError transact(ModbusADU& adu, uint32_t timeout = 0);
+
+    ///@brief Blocking "Read Holding Registers".  Checks the response matches the request.
+    ModbusRTUMasterError readRegisters(uint8_t id, uint16_t address, uint16_t* registers, uint16_t quantity, uint32_t timeout = 0);
+
+    /**
+     * @brief Blocking "Write Single Register", or "Write Multiple Registers" if there are several.
+     * @details Checks the response matches the request.
+     */
+    ModbusRTUMasterError writeRegisters(uint8_t id, uint16_t address, const uint16_t* registers, uint16_t quantity, uint32_t timeout = 0);
+
+    /**
+     * @brief Blocking "Read/Write Multiple Registers".
+     * @details The drive writes first, so reading what was written gives the values it actually kept.
+     *          Checks the response matches the request.
+     * @param readback Receives `readQuantity` values.
+     * @param exception Set to the drive's exception code, if it answered with one.  Otherwise 0.
+     */
+    ModbusRTUMasterError writeReadRegisters(uint8_t id, uint16_t writeAddress, const uint16_t* registers, uint16_t writeQuantity,
+                                            uint16_t readAddress, uint16_t* readback, uint16_t readQuantity, uint8_t& exception,
+                                            uint32_t timeout = 0);
+
+    /**
+     * @see AsyncModbusMaster::submit
+     */
+    ModbusTransactionHandle submit(ModbusADU& request, const ModbusTransactionCallback& callback = nullptr, const uint32_t timeout = 0)
+    {
+        return async.submit(request, callback, timeout);
+    }
+
+    /**
+     * @brief Move queued transactions on and off the wire.  Never blocks.
+     * @details Must be called regularly while any transaction is outstanding.
+     */
+    void update()
+    {
+        async.update();
+    }
+
+    /**
+     * @see AsyncModbusMaster::poll
+     */
+    ModbusTransactionState poll(const ModbusTransactionHandle handle)
+    {
+        return async.poll(handle);
+    }
+
+    /**
+     * @see AsyncModbusMaster::getResponse
+     */
+    ModbusADU* getResponse(const ModbusTransactionHandle handle)
+    {
+        return async.getResponse(handle);
+    }
+
+    /**
+     * @see AsyncModbusMaster::getError
+     */
+    [[nodiscard]] ModbusRTUMasterError getError(const ModbusTransactionHandle handle) const
+    {
+        return async.getError(handle);
+    }
+
+    /**
+     * @see AsyncModbusMaster::release
+     */
+    void release(const ModbusTransactionHandle handle)
+    {
+        async.release(handle);
+    }
+
+    /**
+     * @brief Check if any non-blocking transactions are outstanding.
+     * @warning Blocking methods must only be called when this is true.
+     */
+    [[nodiscard]] bool isIdle() const
+    {
+        return async.isIdle();
+    }
+
+    /**
+     * @brief Limit the adaptive response timeout.
+     * @param floor Minimum timeout, in milliseconds.
+     * @param ceiling Maximum timeout, in milliseconds.  Used until a drive has responded at least once.
+     */
+    void setTimeoutLimits(uint32_t floor, uint32_t ceiling);
+
+    /**
+     * @brief Round trip time statistics for this bus.
+     * @details Safe to read from any task.
+     */
+    [[nodiscard]] const RttEstimator& getRttEstimator() const
+    {
+        return async.getRttEstimator();
+    }
+
+    /**
+     * @brief Transaction counters and latency for this bus, blocking and non-blocking.
+     * @details Safe to read from any task.
+     */
+    [[nodiscard]] const BusStatistics& getStatistics() const
+    {
+        return async.getStatistics();
+    }
+
+private:
+    /**
+     * @brief Underlying connection.
+     */
+    HardwareSerial& serial;
+
+    /**
+     * @brief Frames on and off the wire.
+     */
+    RtuTransport transport;
+
+    /**
+     * @brief Every transaction goes through here.  Blocking ones just wait for it.
+     */
+    AsyncModbusMaster async;
+
+    ///@brief Node ids of every attached drive.
+    std::array<uint8_t, MAX_DRIVES> drives = {};
+    size_t driveCount = 0;
+
+    uint32_t baud = 0;
+    uint32_t config = SERIAL_8N1;
+
+    ///@brief Status polls which failed in a row.
+    uint8_t failedPolls = 0;
+    ///@brief The baud watchdog has given up on the last known rate.
+    bool huntingBaud = false;
+
+    std::function<void()> yieldHook = nullptr;
+
+    /**
+     * @brief Change this end's baud rate.  Does not touch the drives.
+     */
+    void setBaud(uint32_t baud);
+
+    ///@brief Tell a drive to switch rates.  It does so right after responding.
+    ModbusRTUMasterError writeBaud(uint8_t id, uint32_t baud, uint32_t timeout = 0);
+
+    /**
+     * @brief Check that a drive answers at the current rate.
+     * @param expected What the drive's "ModbusBaudrate" register should hold.
+     * @return true if the register could be read, whatever it holds.  `matches` says if it was `expected`.
+     */
+    bool verifyBaud(uint8_t id, uint32_t expected, bool& matches);
+
+    /**
+     * @brief Move a set of drives from one rate to another.  Puts back any which switched if one fails.
+     * @return true if every drive answers at the new rate.
+     */
+    bool switchBaud(const uint8_t* ids, size_t count, uint32_t from, uint32_t to);
+};
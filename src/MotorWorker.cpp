@@ -0,0 +1,512 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "MotorWorker.hpp"
+#include "ModbusDefinitions.hpp"
+
+MotorWorker::MotorWorker(MotorBus& bus):
+    bus{bus}
+{
+}
+
+uint8_t MotorWorker::addMotor(LinearMotor& motor)
+{
+    if (motorCount == motors.size())
+    {
+        return motors.size();
+    }
+    motors[motorCount].motor = &motor;
+    return motorCount++;
+}
+
+void MotorWorker::begin(const char* name, const BaseType_t core, const UBaseType_t priority)
+{
+    bus.setYieldHook([this]()
+    {
+        yieldToPoll();
+    });
+    xTaskCreatePinnedToCore(_task, name, 4096, this, priority, &task, core);
+}
+
+void MotorWorker::setPolling(const bool enabled)
+{
+    if (enabled && not polling.load())
+    {
+        pollingSince = micros();
+    }
+    if (polling.exchange(enabled) != enabled && task != nullptr)
+    {
+        xTaskNotifyGive(task);
+    }
+}
+
+void MotorWorker::triggerPoll(const uint8_t motor)
+{
+    if (pollsTriggered.load() == 0)
+    {
+        triggeredAt = micros();
+    }
+    pollsTriggered.fetch_or(1 << motor);
+    if (task != nullptr)
+    {
+        xTaskNotifyGive(task);
+    }
+}
+
+void MotorWorker::submitRequest()
+{
+    requests.prepare()->submittedAt = micros();
+    client = xTaskGetCurrentTaskHandle();
+    requests.publish();
+    xTaskNotifyGive(task);
+}
+
+MotorResponse& MotorWorker::waitForResponse()
+{
+    auto response = responses.front();
+    while (response == nullptr)
+    {
+        // Notifications from other workers may wake this early, so always re-check the queue.
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        response = responses.front();
+    }
+    return *response;
+}
+
+MotorResponse& MotorWorker::execute(const uint8_t motor, const MotorCommand command, const uint32_t value)
+{
+    auto request = prepareRequest();
+    while (request == nullptr)
+    {
+        // Worker is still busy with earlier requests.
+        vTaskDelay(1);
+        request = prepareRequest();
+    }
+    request->motor = motor;
+    request->command = command;
+    request->value = value;
+    submitRequest();
+    return waitForResponse();
+}
+
+void MotorWorker::_task(void* workerPtr)
+{
+    static_cast<MotorWorker*>(workerPtr)->run();
+}
+
+void MotorWorker::run()
+{
+    while (true)
+    {
+        bus.update();
+
+        // One transaction on the bus at a time.  Blocking commands also need the bus to themselves.
+        if (not requestActive && not pollActive && bus.isIdle())
+        {
+            restoreBaud();
+            // A paused poll has to finish before the next one starts.
+            TickType_t untilPoll = 0;
+            const auto continuing = pausedPoll < motorCount;
+            const auto poll = continuing ? pausedPoll : nextPoll(untilPoll);
+            if (continuing)
+            {
+                arbiter.setReady(SAFETY_TRAFFIC, pausedAt);
+            }
+            else
+            {
+                readyPoll(poll);
+            }
+            auto request = requests.front();
+            auto response = request == nullptr ? nullptr : responses.prepare();
+
+            // A request waits in place until the client frees up a response.
+            arbiter.clearReady(HOST_TRAFFIC);
+            arbiter.clearReady(CONFIG_TRAFFIC);
+            if (response != nullptr)
+            {
+                arbiter.setReady(classify(request->command), request->submittedAt);
+            }
+
+            const auto next = arbiter.choose();
+            if (next == SAFETY_TRAFFIC)
+            {
+                arbiter.start(SAFETY_TRAFFIC, micros());
+                if (continuing)
+                {
+                    resumePoll(pausedPoll);
+                }
+                else
+                {
+                    startPoll(poll);
+                }
+            }
+            else if (next != TRAFFIC_CLASSES)
+            {
+                arbiter.start(static_cast<TrafficClass>(next), micros());
+                process(*request, *response);
+            }
+            else if (pausedSample < motorCount)
+            {
+                resumePoll(pausedSample);
+            }
+            else
+            {
+                // Only when nothing else wants the bus.
+                startSample();
+            }
+        }
+
+        // Responses wake this as soon as they land, so frames in flight only need a tick for timeouts.
+        // Otherwise, sleep until there is something to do.
+        auto wait = portMAX_DELAY;
+        if (not bus.isIdle() || requestActive || pollActive)
+        {
+            wait = 1;
+        }
+        else if (not requests.empty())
+        {
+            // Only have to wait if the client has not released its responses yet.
+            wait = responses.prepare() == nullptr ? 1 : 0;
+        }
+        else
+        {
+            nextPoll(wait);
+        }
+        if (wait != 0)
+        {
+            ulTaskNotifyTake(pdTRUE, wait);
+        }
+    }
+}
+
+uint8_t MotorWorker::nextPoll(TickType_t& wait) const
+{
+    const auto now = xTaskGetTickCount();
+    const auto triggered = pollsTriggered.load();
+    const auto scheduled = polling.load();
+
+    auto next = motorCount;
+    auto nextTriggered = false;
+    TickType_t nextAge = 0;
+    wait = portMAX_DELAY;
+    for (uint8_t i = 0; i < motorCount; i++)
+    {
+        const auto age = now - motors[i].lastPoll;
+        const auto isTriggered = (triggered & 1 << i) != 0;
+        if (not isTriggered && not (scheduled && age >= pollInterval))
+        {
+            if (scheduled)
+            {
+                wait = std::min(wait, pollInterval - age);
+            }
+            continue;
+        }
+        if (next == motorCount || (isTriggered && not nextTriggered) || (isTriggered == nextTriggered && age > nextAge))
+        {
+            next = i;
+            nextTriggered = isTriggered;
+            nextAge = age;
+        }
+    }
+    if (next < motorCount)
+    {
+        wait = 0;
+    }
+    return next;
+}
+
+void MotorWorker::readyPoll(const uint8_t motor)
+{
+    if (motor >= motorCount)
+    {
+        arbiter.clearReady(SAFETY_TRAFFIC);
+        return;
+    }
+    if ((pollsTriggered.load() & 1 << motor) != 0)
+    {
+        arbiter.setReady(SAFETY_TRAFFIC, triggeredAt.load());
+        return;
+    }
+    // Polling may have been off when the interval ran out.  Signed, so it survives the clock wrapping.
+    const auto due = motors[motor].polledAt + pollIntervalMicros;
+    const auto enabled = pollingSince.load();
+    arbiter.setReady(SAFETY_TRAFFIC, static_cast<int32_t>(due - enabled) > 0 ? due : enabled);
+}
+
+void MotorWorker::startPoll(const uint8_t motor)
+{
+    pollsTriggered.fetch_and(~(1 << motor));
+    // Starting over abandons a paused sample poll of the same motor.
+    if (pausedSample == motor)
+    {
+        pausedSample = MotorBus::MAX_DRIVES;
+    }
+    auto& slot = motors[motor];
+    slot.lastPoll = xTaskGetTickCount();
+    slot.polledAt = micros();
+    slot.motor->setStatusFields(statusFields.load());
+    const auto handle = slot.motor->submitGetStatus([this, &slot](const LinearMotorStatus& status)
+    {
+        if (slot.listener != nullptr)
+        {
+            slot.listener(status);
+        }
+        slot.latestStatus.write(status);
+        slot.sampleDue = sampleFields.load() != 0;
+        pollActive = false;
+    }, slot.errorListener, [this, motor]()
+    {
+        // Due again straight away, but host frames which were already waiting go first.
+        pausedPoll = motor;
+        pausedAt = micros();
+        pollActive = false;
+    });
+    pollActive = handle != INVALID_TRANSACTION;
+}
+
+void MotorWorker::resumePoll(uint8_t& paused)
+{
+    const auto motor = paused;
+    paused = MotorBus::MAX_DRIVES;
+    // On failure, the poll has already finished.
+    pollActive = motors[motor].motor->resumeGetStatus() != INVALID_TRANSACTION;
+}
+
+bool MotorWorker::startSample()
+{
+    const auto fields = sampleFields.load();
+    for (uint8_t i = 0; i < motorCount; i++)
+    {
+        auto& slot = motors[i];
+        if (not slot.sampleDue)
+        {
+            continue;
+        }
+        slot.sampleDue = false;
+        if (fields == 0)
+        {
+            continue;
+        }
+        slot.motor->setStatusFields(fields);
+        const auto handle = slot.motor->submitGetStatus([this, &slot](const LinearMotorStatus& status)
+        {
+            if (slot.sampleListener != nullptr)
+            {
+                slot.sampleListener(status);
+            }
+            pollActive = false;
+        }, nullptr, [this, i]()
+        {
+            pausedSample = i;
+            pollActive = false;
+        });
+        pollActive = handle != INVALID_TRANSACTION;
+        return pollActive;
+    }
+    return false;
+}
+
+void MotorWorker::yieldToPoll()
+{
+    if (not yielding || pollActive)
+    {
+        return;
+    }
+    if (pausedPoll < motorCount)
+    {
+        arbiter.start(SAFETY_TRAFFIC, micros());
+        resumePoll(pausedPoll);
+        return;
+    }
+    // Configuration is never in a hurry, so any due poll goes first.
+    TickType_t wait = 0;
+    const auto poll = nextPoll(wait);
+    if (poll < motorCount)
+    {
+        readyPoll(poll);
+        arbiter.start(SAFETY_TRAFFIC, micros());
+        startPoll(poll);
+    }
+}
+
+void MotorWorker::restoreBaud()
+{
+    const auto now = xTaskGetTickCount();
+    if (negotiatedBaud == 0 || now - lastNegotiation < BAUD_RETRY_INTERVAL)
+    {
+        return;
+    }
+    auto anyReachable = false;
+    for (uint8_t i = 0; i < motorCount; i++)
+    {
+        anyReachable |= motors[i].motor->isReachable();
+    }
+    // With every drive gone, the baud watchdog is already hunting.
+    if (not anyReachable)
+    {
+        return;
+    }
+    lastNegotiation = now;
+
+    if (negotiatedBaud > bus.getBaud())
+    {
+        bus.negotiateBaud(negotiatedBaud);
+        return;
+    }
+    // The rest of the bus carried on, so a drive which was power cycled is stranded at its old rate.
+    for (uint8_t i = 0; i < motorCount; i++)
+    {
+        if (not motors[i].motor->isReachable())
+        {
+            bus.recoverDrive(motors[i].motor->getId());
+        }
+    }
+}
+
+void MotorWorker::finishRequest()
+{
+    requestActive = false;
+    requests.pop();
+    responses.publish();
+    xTaskNotifyGive(client.load());
+}
+
+TrafficClass MotorWorker::classify(const MotorCommand command)
+{
+    return command == RAW_ADU || command == FORWARD_ADU ? HOST_TRAFFIC : CONFIG_TRAFFIC;
+}
+
+void MotorWorker::process(MotorRequest& request, MotorResponse& response)
+{
+    response.command = request.command;
+    response.error = MODBUS_RTU_MASTER_SUCCESS;
+    response.value = 0;
+
+    // Bus wide commands work even with no motors added.
+    const auto busWide = request.command == SET_TIMEOUT_LIMITS || request.command == NEGOTIATE_BAUD || request.command == ENABLE_ALL_MOTORS;
+    if (request.motor >= motorCount && not busWide)
+    {
+        response.error = MODBUS_RTU_MASTER_INVALID_ID;
+        copyAdu(response.adu, request.adu);
+        response.adu.prepareExceptionResponse(GATEWAY_PATH_UNAVAILABLE);
+        finishRequest();
+        return;
+    }
+    const auto motor = motors[request.motor % motors.size()].motor;
+
+    // Changing baud rates or node ids leaves nothing for a poll to talk to in between.
+    yielding = classify(request.command) == CONFIG_TRAFFIC && request.command != NEGOTIATE_BAUD && request.command != ADOPT_DRIVE;
+    switch (request.command)
+    {
+    case DISABLE_MOTOR:
+        response.error = motor->disable();
+        break;
+    case ENABLE_MOTOR:
+        response.error = motor->enable();
+        break;
+    case ENABLE_ALL_MOTORS:
+    {
+        std::array<LinearMotor*, MotorBus::MAX_DRIVES> all = {};
+        for (uint8_t i = 0; i < motorCount; i++)
+        {
+            all[i] = motors[i].motor;
+        }
+        response.value = LinearMotor::enableAll(all.data(), motorCount, response.error);
+        break;
+    }
+    case SET_INERTIA:
+        motor->setInertia(request.value);
+        break;
+    case SET_CURRENT_GAIN:
+        motor->setCurrentGain(request.value);
+        break;
+    case SET_AUTO_GAIN:
+        motor->setAutoGain(request.value);
+        break;
+    case SET_FILTERS_OFF:
+        motor->setFiltersOff();
+        break;
+    case APPLY_CONFIG:
+        response.error = motor->commit(request.config);
+        break;
+    case GET_FLASH_STATE:
+        response.value = motor->getFlashState();
+        break;
+    case SET_TIMEOUT_LIMITS:
+        bus.setTimeoutLimits(request.value >> 16, request.value & 0xFFFF);
+        break;
+    case NEGOTIATE_BAUD:
+        response.value = bus.negotiateBaud(request.value);
+        negotiatedBaud = response.value;
+        lastNegotiation = xTaskGetTickCount();
+        break;
+    case ADOPT_DRIVE:
+        response.error = motor->adopt(request.value);
+        break;
+    case CAPTURE_PARAMETERS:
+        response.error = motor->capture(*request.snapshot);
+        break;
+    case RESTORE_PARAMETERS:
+    {
+        uint16_t changed = 0;
+        response.error = motor->restore(*request.snapshot, request.value != 0, changed);
+        response.value = changed;
+        break;
+    }
+    case GET_INERTIA:
+        response.error = motor->readCached<MotionG::Inertia>(response.value);
+        break;
+    case GET_CURRENT_GAIN:
+        response.error = motor->readCached<MotionG::CurrentBandwidth>(response.value);
+        break;
+    case READ_REGISTERS:
+    case READ_CACHED_REGISTERS:
+    {
+        const uint16_t address = request.value >> 16;
+        const auto length = std::min<uint16_t>(request.value & 0xFFFF, 2);
+        std::array<uint16_t, 2> registers = {};
+        response.error = request.command == READ_CACHED_REGISTERS ? motor->readCached(address, length, registers.data())
+                                                                   : motor->read(address, length, registers.data());
+        response.value = length == 2 ? static_cast<uint32_t>(registers[0]) << 16 | registers[1] : registers[0];
+        break;
+    }
+    case RAW_ADU:
+        requestActive = INVALID_TRANSACTION != motor->submitAdu(request.adu, [this, &response](ModbusADU& adu, const ModbusRTUMasterError error)
+        {
+            copyAdu(response.adu, adu);
+            if (error && error != MODBUS_RTU_MASTER_EXCEPTION_RESPONSE)
+            {
+                response.adu.prepareExceptionResponse(GATEWAY_TARGET_DEVICE_FAILED_TO_RESPOND);
+            }
+            response.error = error;
+            finishRequest();
+        });
+        if (requestActive)
+        {
+            return;
+        }
+        response.error = MODBUS_RTU_MASTER_UNKNOWN_COMM_ERROR;
+        break;
+    case FORWARD_ADU:
+        requestActive = INVALID_TRANSACTION != motor->submitForward(request.adu, [this, &response](ModbusADU& adu, const bool success)
+        {
+            copyAdu(response.adu, adu);
+            response.error = success ? MODBUS_RTU_MASTER_SUCCESS : MODBUS_RTU_MASTER_RESPONSE_TIMEOUT;
+            finishRequest();
+        });
+        if (requestActive)
+        {
+            return;
+        }
+        copyAdu(response.adu, request.adu);
+        response.adu.prepareExceptionResponse(GATEWAY_PATH_UNAVAILABLE);
+        response.error = MODBUS_RTU_MASTER_UNKNOWN_COMM_ERROR;
+        break;
+    }
+    yielding = false;
+    finishRequest();
+}
@@ -0,0 +1,408 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <ModbusADU.h>
+#include <functional>
+
+#include "BusArbiter.hpp"
+#include "LinearMotor.hpp"
+#include "SpscQueue.hpp"
+
+enum MotorCommand : uint8_t
+{
+    DISABLE_MOTOR,
+
+    ///@brief Bring the motor to Operation Enabled.  Responds with an error if it did not get there.
+    ENABLE_MOTOR,
+
+    /**
+     * @brief Bring every motor on the bus to Operation Enabled, all at once.
+     * @details Applies to the whole bus.  Responds with bit `i` set if motor `i` got there.
+     * @see LinearMotor::enableAll
+     */
+    ENABLE_ALL_MOTORS,
+
+    SET_INERTIA,
+    GET_INERTIA,
+    SET_CURRENT_GAIN,
+    GET_CURRENT_GAIN,
+    SET_AUTO_GAIN,
+    SET_FILTERS_OFF,
+
+    /**
+     * @brief Apply `config` with a single disable, persist, and enable.
+     * @details Responds with `MODBUS_RTU_MASTER_UNEXPECTED_VALUE` if the drive did not keep a value as written.
+     * @see LinearMotor::commit
+     */
+    APPLY_CONFIG,
+
+    ///@brief Responds with the `FlashState` of the latest save.
+    GET_FLASH_STATE,
+
+    /**
+     * @brief `value` is the floor in the upper 16 bits, and the ceiling in the lower 16 bits.
+     * @details Applies to the whole bus.
+     */
+    SET_TIMEOUT_LIMITS,
+
+    /**
+     * @brief `value` is the fastest baud rate to try.  Responds with the rate in use.
+     * @details Applies to the whole bus.
+     *          If the watchdog later falls back to a slower rate, the worker periodically tries to restore this one.
+     *          A single drive which was power cycled is brought back up to the bus rate on its own.
+     * @see MotorBus::negotiateBaud
+     */
+    NEGOTIATE_BAUD,
+
+    /**
+     * @brief `value` is the node id the drive answers to now.  It is moved to the motor's own id.
+     * @see LinearMotor::adopt
+     */
+    ADOPT_DRIVE,
+
+    /**
+     * @brief Read every configuration register into `snapshot`.
+     * @see LinearMotor::capture
+     */
+    CAPTURE_PARAMETERS,
+
+    /**
+     * @brief Write back whatever differs from `snapshot`.  `value` is 0 to only compare.
+     *        Responds with the number of values which differ.
+     * @see LinearMotor::restore
+     */
+    RESTORE_PARAMETERS,
+
+    /**
+     * @brief `value` is the address in the upper 16 bits, and the number of registers (1 or 2) in the lower 16 bits.
+     *        Responds with the raw registers, high word first.
+     */
+    READ_REGISTERS,
+
+    ///@brief As `READ_REGISTERS`, but from the shadow cache if possible.  Only for registers in `MotionG::CONFIGURATION`.
+    READ_CACHED_REGISTERS,
+
+    ///@brief Send `adu` as-is, and return whatever comes back.
+    RAW_ADU,
+
+    ///@see LinearMotor::forwardAdu
+    FORWARD_ADU
+};
+
+struct MotorRequest
+{
+    ///@brief Which of the worker's motors, as returned by `MotorWorker::addMotor()`.
+    uint8_t motor = 0;
+    MotorCommand command = DISABLE_MOTOR;
+    uint32_t value = 0;
+    ModbusADU adu;
+    ConfigTransaction config;
+    ///@brief For `CAPTURE_PARAMETERS` and `RESTORE_PARAMETERS`.  Too big to copy, so the client owns it.
+    ParameterSnapshot* snapshot = nullptr;
+    ///@brief `micros()` when submitted.  Set by `MotorWorker::submitRequest()`.
+    uint32_t submittedAt = 0;
+};
+
+struct MotorResponse
+{
+    MotorCommand command = DISABLE_MOTOR;
+    ModbusRTUMasterError error = MODBUS_RTU_MASTER_SUCCESS;
+    uint32_t value = 0;
+    ModbusADU adu;
+};
+
+/**
+ * @brief FreeRTOS task which owns all traffic on one motor bus.
+ * @details Each bus sits on its own UART, so giving every bus its own task lets transactions overlap.
+ *          Drives sharing a bus take turns, one transaction at a time.
+ *          <br/>
+ *          The worker polls every motor's status in the background, and executes requests from a single client task.
+ *          Polls go to whichever motor has waited longest, so no drive on a busy bus is starved.
+ *          Polls, forwarded host frames, and everything else are scheduled by deadline, through a `BusArbiter`.
+ *          Polls pause between their reads, and go back to the arbiter, so a waiting host frame never sits behind a whole poll.
+ *          Long blocking commands let due polls in between their steps, so configuration never holds up fault detection.
+ *          Status polls and forwarded frames are non-blocking, so the task sleeps instead of spinning while they are in flight.
+ *          <br/>
+ *          Requests and responses pass through lock-free SPSC queues.
+ *          Only one task may act as the client.
+ * @warning Once `begin()` is called, the bus and its motors must only be accessed through the worker.
+ */
+class MotorWorker
+{
+public:
+    explicit MotorWorker(MotorBus& bus);
+    MotorWorker(const MotorWorker&) = delete;
+    MotorWorker(const MotorWorker&&) = delete;
+
+    /**
+     * @brief Add a motor on this worker's bus.  Call before `begin()`.
+     * @return The motor's index, for requests and status.  `MotorBus::MAX_DRIVES` if there is no room.
+     */
+    uint8_t addMotor(LinearMotor& motor);
+
+    [[nodiscard]] uint8_t getMotorCount() const
+    {
+        return motorCount;
+    }
+
+    [[nodiscard]] MotorBus& getBus() const
+    {
+        return bus;
+    }
+
+    /**
+     * @brief How long each class of traffic waits for the bus.
+     * @details Safe to read from any task.
+     */
+    [[nodiscard]] const BusArbiter& getArbiter() const
+    {
+        return arbiter;
+    }
+
+    /**
+     * @brief Start the worker task.
+     * @param name Task name.  Shows up in FreeRTOS debugging output.
+     * @param core Core to pin the task to.
+     * @param priority FreeRTOS task priority.
+     */
+    void begin(const char* name, BaseType_t core, UBaseType_t priority = 1);
+
+    /**
+     * @brief Enable or disable background status polling.
+     */
+    void setPolling(bool enabled);
+
+    /**
+     * @brief Set the minimum time between background status polls of each motor.
+     * @details Requests are still handled immediately.
+     */
+    void setPollInterval(uint32_t milliseconds)
+    {
+        pollInterval = pdMS_TO_TICKS(milliseconds);
+        pollIntervalMicros = milliseconds * 1000;
+    }
+
+    /**
+     * @brief Choose which fields status polls read, for every motor.
+     * @param fields `LinearMotorStatusField` flags.
+     * @see LinearMotor::setStatusFields
+     */
+    void setStatusFields(const uint16_t fields)
+    {
+        statusFields = fields;
+    }
+
+    /**
+     * @brief Choose which fields sample polls read, for every motor.  0 for no sample polls.
+     * @details After each status poll, the motor gets one sample poll, but only once the bus has nothing else to do.
+     *          So diagnostics which want more fields never slow the polls feeding the emergency stop.
+     * @param fields `LinearMotorStatusField` flags.
+     */
+    void setSampleFields(const uint16_t fields)
+    {
+        sampleFields = fields;
+    }
+
+    /**
+     * @brief Poll a motor's status as soon as the bus is free, even if polling is disabled.
+     * @details For sampling several motors at the same moment.  Triggered polls go ahead of scheduled ones.
+     */
+    void triggerPoll(uint8_t motor);
+
+    /**
+     * @brief Called from the worker task with every polled status of a motor, before it is available to `getStatus()`.
+     * @details For anything which has to react faster than the client checks.  Must not block.
+     *          Set before calling `begin()`.
+     */
+    void setStatusListener(const uint8_t motor, const std::function<void(const LinearMotorStatus&)>& listener)
+    {
+        motors[motor].listener = listener;
+    }
+
+    /**
+     * @brief Called from the worker task with every sample poll of a motor.
+     * @details Must not block.  Set before calling `begin()`.
+     * @see setSampleFields
+     */
+    void setSampleListener(const uint8_t motor, const std::function<void(const LinearMotorStatus&)>& listener)
+    {
+        motors[motor].sampleListener = listener;
+    }
+
+    /**
+     * @brief Called from the worker task as soon as each poll has read a motor's "Error_code", or failed to.
+     * @details Comes before the rest of the poll's reads, so faults are acted on after one round trip.
+     *          Only "Error_code" and "Statusword" are filled in.  Must not block.
+     *          Set before calling `begin()`.
+     */
+    void setErrorListener(const uint8_t motor, const std::function<void(const LinearMotorStatus&)>& listener)
+    {
+        motors[motor].errorListener = listener;
+    }
+
+    /**
+     * @brief Get the result of a motor's latest background status poll.
+     * @param status Set to the latest status.  Unchanged if no new poll has completed.
+     * @return true if `status` was updated.
+     */
+    bool getStatus(const uint8_t motor, LinearMotorStatus& status)
+    {
+        return motors[motor].latestStatus.read(status);
+    }
+
+    /**
+     * @brief Get a request slot to fill in.  Client only.
+     * @return The request, or nullptr if too many requests are outstanding.
+     */
+    MotorRequest* prepareRequest()
+    {
+        return requests.prepare();
+    }
+
+    /**
+     * @brief Send the request returned by `prepareRequest()` to the worker.  Client only.
+     */
+    void submitRequest();
+
+    /**
+     * @brief Block until the oldest outstanding request has completed.  Client only.
+     * @details Must be followed by `releaseResponse()`.
+     * @return The response.
+     */
+    MotorResponse& waitForResponse();
+
+    /**
+     * @brief Release the response returned by `waitForResponse()`.  Client only.
+     */
+    void releaseResponse()
+    {
+        responses.pop();
+    }
+
+    /**
+     * @brief Submit a request, and block until it completes.  Client only.
+     * @details Must be followed by `releaseResponse()`.
+     * @param motor Index from `addMotor()`.  Ignored by commands which apply to the whole bus.
+     */
+    MotorResponse& execute(uint8_t motor, MotorCommand command, uint32_t value = 0);
+
+private:
+    MotorBus& bus;
+
+    ///@brief A motor on the bus, and its polling state.
+    struct Motor
+    {
+        LinearMotor* motor = nullptr;
+        SpscLatest<LinearMotorStatus> latestStatus;
+        std::function<void(const LinearMotorStatus&)> listener = nullptr;
+        std::function<void(const LinearMotorStatus&)> errorListener = nullptr;
+        std::function<void(const LinearMotorStatus&)> sampleListener = nullptr;
+        ///@brief Polled since the last sample poll.
+        bool sampleDue = false;
+        TickType_t lastPoll = 0;
+        ///@brief `micros()` of the last poll, for wait times.
+        uint32_t polledAt = 0;
+    };
+    std::array<Motor, MotorBus::MAX_DRIVES> motors;
+    uint8_t motorCount = 0;
+
+    TaskHandle_t task = nullptr;
+    std::atomic<TaskHandle_t> client{nullptr};
+    std::atomic<bool> polling{false};
+    ///@brief `micros()` when polling was last enabled.  Scheduled polls are never due before this.
+    std::atomic<uint32_t> pollingSince{0};
+    ///@brief Motors with a triggered poll pending.  One bit per motor.
+    std::atomic<uint8_t> pollsTriggered{0};
+    ///@brief `micros()` of the oldest pending trigger.
+    std::atomic<uint32_t> triggeredAt{0};
+    std::atomic<uint16_t> statusFields{STATUS_DEFAULT};
+    std::atomic<uint16_t> sampleFields{0};
+    TickType_t pollInterval = pdMS_TO_TICKS(1);
+    uint32_t pollIntervalMicros = 1000;
+
+    BusArbiter arbiter;
+
+    ///@brief A non-blocking request is on the bus.
+    bool requestActive = false;
+    ///@brief A status or sample poll is on the bus.
+    bool pollActive = false;
+    ///@brief Motor whose status poll is paused between reads.  `MotorBus::MAX_DRIVES` if none.
+    uint8_t pausedPoll = MotorBus::MAX_DRIVES;
+    ///@brief `micros()` when `pausedPoll` paused.
+    uint32_t pausedAt = 0;
+    ///@brief Motor whose sample poll is paused between reads.  `MotorBus::MAX_DRIVES` if none.
+    uint8_t pausedSample = MotorBus::MAX_DRIVES;
+    ///@brief The blocking command being processed may let due polls in between its transactions.
+    bool yielding = false;
+
+    ///@brief How often to try getting back to `negotiatedBaud`.
+    static constexpr TickType_t BAUD_RETRY_INTERVAL = pdMS_TO_TICKS(30000);
+    ///@brief Result of the last `NEGOTIATE_BAUD`.
+    uint32_t negotiatedBaud = 0;
+    TickType_t lastNegotiation = 0;
+
+    SpscQueue<MotorRequest, 4> requests;
+    SpscQueue<MotorResponse, 4> responses;
+
+    static void _task(void* workerPtr);
+    [[noreturn]] void run();
+
+    /**
+     * @brief Choose the motor to poll next.
+     * @details Triggered polls come first, then whichever motor has waited longest, so drives take turns.
+     * @param wait Set to the ticks until a poll is due.  0 if one is due now.
+     * @return The motor's index, or `motorCount` if none are due.
+     */
+    uint8_t nextPoll(TickType_t& wait) const;
+
+    /**
+     * @brief Tell the arbiter whether a poll is due, and since when.
+     * @param motor From `nextPoll()`.
+     */
+    void readyPoll(uint8_t motor);
+
+    void startPoll(uint8_t motor);
+
+    /**
+     * @brief Carry on with a paused status or sample poll.
+     * @param paused `pausedPoll` or `pausedSample`.  Cleared.
+     */
+    void resumePoll(uint8_t& paused);
+
+    /**
+     * @brief Start a sample poll for the first motor which is due one.
+     * @return false if none are due.
+     */
+    bool startSample();
+
+    /**
+     * @brief Start a due poll ahead of the next blocking transaction.
+     * @details Bus yield hook.  Only does anything while `yielding`.
+     */
+    void yieldToPoll();
+
+    ///@brief Which arbiter class a command belongs to.
+    static TrafficClass classify(MotorCommand command);
+
+    /**
+     * @brief Renegotiate if the baud watchdog fell back to a slower rate.
+     * @details Otherwise bring back any single drive which stopped answering, in case it was power cycled.
+     */
+    void restoreBaud();
+
+    /**
+     * @brief Start a request.
+     * @details Blocking commands finish immediately.
+     *          Raw and forwarded ADUs use the motor's non-blocking interface, and finish from a callback.
+     */
+    void process(MotorRequest& request, MotorResponse& response);
+
+    ///@brief Hand the current response to the client.
+    void finishRequest();
+};
@@ -0,0 +1,154 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "Parameter.hpp"
+#include "MotionGParameters.hpp"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+    constexpr bool isSorted()
+    {
+        for (size_t i = 1; i < MotionG::PARAMETERS.size(); i++)
+        {
+            if (not (MotionG::PARAMETERS[i - 1].name < MotionG::PARAMETERS[i].name))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    static_assert(isSorted(), "Parameters must be sorted by name, with no duplicates");
+
+    ///@return Number of decimal places a scale allows.
+    uint8_t decimals(uint32_t scale)
+    {
+        uint8_t count = 0;
+        while (scale >= 10)
+        {
+            scale /= 10;
+            count++;
+        }
+        return count;
+    }
+}
+
+int64_t ParameterInfo::decode(const uint16_t* registers) const
+{
+    switch (type)
+    {
+    case PARAMETER_UNS8:
+        return static_cast<uint8_t>(registers[0]);
+    case PARAMETER_INT8:
+        return static_cast<int8_t>(registers[0]);
+    case PARAMETER_UNS16:
+        return registers[0];
+    case PARAMETER_INT16:
+        return static_cast<int16_t>(registers[0]);
+    case PARAMETER_UNS32:
+        return static_cast<uint32_t>(registers[0]) << 16 | registers[1];
+    case PARAMETER_INT32:
+        return static_cast<int32_t>(static_cast<uint32_t>(registers[0]) << 16 | registers[1]);
+    }
+    return 0;
+}
+
+void ParameterInfo::encode(const int64_t value, uint16_t* registers) const
+{
+    const auto raw = static_cast<uint32_t>(value);
+    switch (type)
+    {
+    case PARAMETER_UNS8:
+    case PARAMETER_INT8:
+        // 8 bit values are sent as their low byte, without sign extension.
+        registers[0] = raw & 0xFF;
+        break;
+    case PARAMETER_UNS16:
+    case PARAMETER_INT16:
+        registers[0] = raw & 0xFFFF;
+        break;
+    case PARAMETER_UNS32:
+    case PARAMETER_INT32:
+        registers[0] = raw >> 16;
+        registers[1] = raw & 0xFFFF;
+        break;
+    }
+}
+
+bool ParameterInfo::parse(const std::string_view text, int64_t& value) const
+{
+    size_t i = 0;
+    const auto negative = not text.empty() && text[0] == '-';
+    if (negative || (not text.empty() && text[0] == '+'))
+    {
+        i++;
+    }
+
+    int64_t result = 0;
+    auto digits = 0;
+    auto places = -1;
+    for (; i < text.size(); i++)
+    {
+        const auto c = text[i];
+        if (c == '.' && places < 0)
+        {
+            places = 0;
+            continue;
+        }
+        if (c < '0' || c > '9')
+        {
+            return false;
+        }
+        // Anything this long is out of range anyway.
+        if (++digits > 12)
+        {
+            return false;
+        }
+        result = result * 10 + (c - '0');
+        if (places >= 0)
+        {
+            places++;
+        }
+    }
+
+    const auto allowed = decimals(scale);
+    if (digits == 0 || places > allowed)
+    {
+        return false;
+    }
+    for (auto place = std::max(places, 0); place < allowed; place++)
+    {
+        result *= 10;
+    }
+    value = negative ? -result : result;
+    return true;
+}
+
+void ParameterInfo::format(const int64_t value, char* buffer, const size_t size) const
+{
+    const auto places = decimals(scale);
+    if (places == 0)
+    {
+        snprintf(buffer, size, "%" PRId64, value);
+        return;
+    }
+    const auto magnitude = static_cast<uint64_t>(value < 0 ? -value : value);
+    snprintf(buffer, size, "%s%" PRIu64 ".%0*" PRIu64, value < 0 ? "-" : "", magnitude / scale, places, magnitude % scale);
+}
+
+const ParameterInfo* findParameter(const std::string_view name)
+{
+    const auto& parameters = MotionG::PARAMETERS;
+    const auto found = std::lower_bound(parameters.begin(), parameters.end(), name, [](const ParameterInfo& parameter, const std::string_view name)
+    {
+        return parameter.name < name;
+    });
+    return found != parameters.end() && found->name == name ? found : nullptr;
+}
@@ -0,0 +1,88 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Register.hpp"
+
+///@brief How a parameter is laid out on the wire.
+enum ParameterType : uint8_t
+{
+    PARAMETER_UNS8,
+    PARAMETER_INT8,
+    PARAMETER_UNS16,
+    PARAMETER_INT16,
+    PARAMETER_UNS32,
+    PARAMETER_INT32
+};
+
+/**
+ * @brief A drive parameter, looked up by name at run time.
+ * @details The run time counterpart of `Register`, for parameters chosen by the host instead of the firmware.
+ *          Values are raw integers, in units of 1 / `scale`.
+ */
+struct ParameterInfo
+{
+    std::string_view name;
+    uint16_t address;
+    ParameterType type;
+    RegisterAccess access;
+    /**
+     * @brief In `MotionG::CONFIGURATION`, so safe to change, and to cache.
+     * @details Commands, set points, and the link itself are read write, but are not configuration.
+     */
+    bool configuration;
+    ///@brief Raw units per displayed unit.  A power of ten.
+    uint32_t scale;
+    ///@brief Lowest raw value allowed.
+    int64_t lower;
+    ///@brief Highest raw value allowed.
+    int64_t upper;
+
+    ///@brief Number of 16 bit registers the value occupies.
+    [[nodiscard]] constexpr uint16_t length() const
+    {
+        return type == PARAMETER_UNS32 || type == PARAMETER_INT32 ? 2 : 1;
+    }
+
+    [[nodiscard]] constexpr bool writable() const
+    {
+        return access == READ_WRITE;
+    }
+
+    [[nodiscard]] constexpr bool contains(const int64_t value) const
+    {
+        return value >= lower && value <= upper;
+    }
+
+    ///@brief Convert raw registers to a value.
+    [[nodiscard]] int64_t decode(const uint16_t* registers) const;
+
+    ///@brief Convert a value to raw registers.
+    void encode(int64_t value, uint16_t* registers) const;
+
+    /**
+     * @brief Parse a value as the user would type it.  "1.5" is 1500 for a scale of 1000.
+     * @return false if `text` is not a number, or has more decimal places than the scale allows.
+     */
+    bool parse(std::string_view text, int64_t& value) const;
+
+    /**
+     * @brief Format a value as the user would type it.
+     * @param buffer Receives a null terminated string.  24 characters is always enough.
+     */
+    void format(int64_t value, char* buffer, size_t size) const;
+};
+
+/**
+ * @brief Find a parameter in `docs/MotionG/params_info.csv`, by its "VariableName".
+ * @return The parameter, or nullptr if there is none by that name.
+ */
+const ParameterInfo* findParameter(std::string_view name);
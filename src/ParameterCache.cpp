@@ -0,0 +1,115 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "ParameterCache.hpp"
+
+bool ParameterCache::get(const uint16_t address, const uint16_t length, uint16_t* registers) const
+{
+    for (const auto& entry : entries)
+    {
+        if (entry.valid && entry.address == address && entry.length == length)
+        {
+            for (uint16_t i = 0; i < length; i++)
+            {
+                registers[i] = entry.registers[i];
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void ParameterCache::put(const uint16_t address, const uint16_t length, const uint16_t* registers, const bool dirty)
+{
+    if (length > 2)
+    {
+        return;
+    }
+    invalidate(address, length);
+
+    Entry* slot = nullptr;
+    for (auto& entry : entries)
+    {
+        if (not entry.valid)
+        {
+            slot = &entry;
+            break;
+        }
+        if (slot == nullptr && not entry.dirty)
+        {
+            slot = &entry;
+        }
+    }
+    if (slot == nullptr)
+    {
+        // Full of unsaved changes.  Reads will go to the drive instead.
+        return;
+    }
+
+    slot->address = address;
+    slot->length = length;
+    slot->valid = true;
+    slot->dirty = dirty;
+    for (uint16_t i = 0; i < length; i++)
+    {
+        slot->registers[i] = registers[i];
+    }
+}
+
+void ParameterCache::invalidate()
+{
+    for (auto& entry : entries)
+    {
+        entry.valid = false;
+        entry.dirty = false;
+    }
+}
+
+void ParameterCache::invalidate(const uint16_t address, const uint16_t length)
+{
+    const uint32_t end = address + length;
+    for (auto& entry : entries)
+    {
+        if (entry.valid && entry.address < end && address < entry.address + entry.length)
+        {
+            entry.valid = false;
+            entry.dirty = false;
+        }
+    }
+}
+
+void ParameterCache::markClean()
+{
+    for (auto& entry : entries)
+    {
+        entry.dirty = false;
+    }
+}
+
+bool ParameterCache::isDirty() const
+{
+    for (const auto& entry : entries)
+    {
+        if (entry.valid && entry.dirty)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ParameterCache::isDirty(const uint16_t address, const uint16_t length) const
+{
+    for (const auto& entry : entries)
+    {
+        if (entry.valid && entry.address == address && entry.length == length)
+        {
+            return entry.dirty;
+        }
+    }
+    return false;
+}
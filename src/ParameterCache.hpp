@@ -0,0 +1,70 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Shadow copy of a drive's configuration registers.
+ * @details Configuration only changes when this firmware writes it, so reads can be served locally.
+ *          Entries written since the last flash persist are marked dirty.
+ *          <br/>
+ *          Fixed size.  When full, clean entries are replaced first.
+ *          Dirty entries are never evicted, since they are the only record of unsaved changes.
+ */
+class ParameterCache
+{
+public:
+    static constexpr size_t CAPACITY = 16;
+
+    /**
+     * @brief Look up a value.
+     * @param address First register.
+     * @param length Number of registers.  At most 2.
+     * @param registers Receives the raw registers on a hit.
+     * @return true on a hit.
+     */
+    bool get(uint16_t address, uint16_t length, uint16_t* registers) const;
+
+    /**
+     * @brief Store a value.
+     * @param address First register.
+     * @param length Number of registers.  At most 2.
+     * @param registers Raw registers.
+     * @param dirty true if this came from a write which has not been persisted yet.
+     */
+    void put(uint16_t address, uint16_t length, const uint16_t* registers, bool dirty);
+
+    ///@brief Forget everything.  For when the drive may have reset.
+    void invalidate();
+
+    ///@brief Forget anything overlapping the given registers.  For writes this cache did not see.
+    void invalidate(uint16_t address, uint16_t length);
+
+    ///@brief Everything cached now matches flash.
+    void markClean();
+
+    ///@return true if any cached value was written, but not persisted.
+    [[nodiscard]] bool isDirty() const;
+
+    ///@return true if this exact value is cached, and was written but not persisted.
+    [[nodiscard]] bool isDirty(uint16_t address, uint16_t length) const;
+
+private:
+    struct Entry
+    {
+        uint16_t address = 0;
+        uint8_t length = 0;
+        bool valid = false;
+        bool dirty = false;
+        std::array<uint16_t, 2> registers = {};
+    };
+
+    std::array<Entry, CAPACITY> entries = {};
+};
@@ -0,0 +1,34 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "ParameterSnapshot.hpp"
+
+void ParameterSnapshot::seal()
+{
+    blob.magic = MAGIC;
+    blob.version = VERSION;
+    blob.count = REGISTER_COUNT;
+    blob.layout = LAYOUT;
+    blob.checksum = checksum();
+}
+
+bool ParameterSnapshot::isValid() const
+{
+    return blob.magic == MAGIC && blob.version == VERSION && blob.count == REGISTER_COUNT && blob.layout == LAYOUT
+        && blob.checksum == checksum();
+}
+
+uint32_t ParameterSnapshot::checksum() const
+{
+    uint32_t hash = 2166136261;
+    for (const auto value : blob.registers)
+    {
+        hash = (hash ^ (value >> 8)) * 16777619;
+        hash = (hash ^ (value & 0xFF)) * 16777619;
+    }
+    return hash;
+}
@@ -0,0 +1,109 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "MotionGRegisters.hpp"
+
+/**
+ * @brief Every configuration register of one drive, ready to be stored.
+ * @details Values are raw registers, in `MotionG::CONFIGURATION` order, with no addresses.
+ *          The layout is fingerprinted instead, so a snapshot taken by firmware with a different register list is refused.
+ *          <br/>
+ *          The stored form is this object's bytes, as-is.
+ *          Fill it with `LinearMotor::capture()`, or by loading those bytes, then check `isValid()`.
+ * @see LinearMotor::restore
+ */
+class ParameterSnapshot
+{
+public:
+    ///@brief Bump whenever the stored form changes.
+    static constexpr uint16_t VERSION = 1;
+
+    ///@brief Registers in `MotionG::CONFIGURATION`.
+    static constexpr size_t REGISTER_COUNT = []()
+    {
+        size_t count = 0;
+        for (const auto& span : MotionG::CONFIGURATION)
+        {
+            count += span.length;
+        }
+        return count;
+    }();
+
+    ///@brief FNV-1a of every address and length in `MotionG::CONFIGURATION`.
+    static constexpr uint32_t LAYOUT = []()
+    {
+        uint32_t hash = 2166136261;
+        for (const auto& span : MotionG::CONFIGURATION)
+        {
+            hash = (hash ^ (span.address >> 8)) * 16777619;
+            hash = (hash ^ (span.address & 0xFF)) * 16777619;
+            hash = (hash ^ span.length) * 16777619;
+        }
+        return hash;
+    }();
+
+    ///@brief Raw values, in `MotionG::CONFIGURATION` order.
+    uint16_t* getRegisters()
+    {
+        return blob.registers.data();
+    }
+
+    [[nodiscard]] const uint16_t* getRegisters() const
+    {
+        return blob.registers.data();
+    }
+
+    ///@brief Mark the registers as complete, once they have all been filled in.
+    void seal();
+
+    ///@brief Forget the contents.
+    void clear()
+    {
+        blob.magic = 0;
+    }
+
+    ///@return true if sealed by this firmware's layout, and not corrupted since.
+    [[nodiscard]] bool isValid() const;
+
+    ///@brief The stored form.  Load by writing `size()` bytes here, then checking `isValid()`.
+    uint8_t* data()
+    {
+        return reinterpret_cast<uint8_t*>(&blob);
+    }
+
+    [[nodiscard]] const uint8_t* data() const
+    {
+        return reinterpret_cast<const uint8_t*>(&blob);
+    }
+
+    [[nodiscard]] static constexpr size_t size()
+    {
+        return sizeof(Blob);
+    }
+
+private:
+    static constexpr uint32_t MAGIC = 0x50534D47; // "GMSP"
+
+    struct Blob
+    {
+        uint32_t magic = 0;
+        uint16_t version = VERSION;
+        uint16_t count = REGISTER_COUNT;
+        uint32_t layout = LAYOUT;
+        ///@brief FNV-1a of the registers.
+        uint32_t checksum = 0;
+        std::array<uint16_t, REGISTER_COUNT> registers = {};
+    };
+    Blob blob;
+
+    [[nodiscard]] uint32_t checksum() const;
+};
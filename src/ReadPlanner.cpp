@@ -0,0 +1,69 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "ReadPlanner.hpp"
+#include <algorithm>
+
+size_t ReadPlanner::plan(const RegisterSpan* wanted, const size_t count, RegisterSpan* reads, const uint16_t splitCost) const
+{
+    size_t planned = 0;
+    for (size_t done = 0; done < count; planned++)
+    {
+        done += planNext(wanted + done, count - done, reads[planned], splitCost);
+    }
+    return planned;
+}
+
+size_t ReadPlanner::planNext(const RegisterSpan* wanted, const size_t count, RegisterSpan& read, const uint16_t splitCost) const
+{
+    read = wanted[0];
+    size_t covered = 1;
+    for (; covered < count; covered++)
+    {
+        const auto& next = wanted[covered];
+        const auto gap = next.address - read.end();
+        const auto merged = next.end() - read.address;
+        if (merged > MAX_READ_REGISTERS || 2 * gap > splitCost || not isReadable(read.end(), next.address))
+        {
+            break;
+        }
+        read.length = merged;
+    }
+    return covered;
+}
+
+bool ReadPlanner::isReadable(uint32_t start, const uint32_t end) const
+{
+    // Nothing starting earlier than this can reach `start`.
+    const auto earliest = start >= MAX_SPAN_LENGTH ? start - (MAX_SPAN_LENGTH - 1) : 0;
+    const auto first = std::lower_bound(layout, layout + layoutSize, earliest,
+        [](const RegisterSpan& span, const uint32_t address) { return span.address < address; });
+    for (auto i = static_cast<size_t>(first - layout); i < layoutSize && start < end; i++)
+    {
+        const auto& span = layout[i];
+        if (span.end() <= start)
+        {
+            continue;
+        }
+        if (span.address > start)
+        {
+            return false;
+        }
+        start = span.end();
+    }
+    return start >= end;
+}
+
+uint16_t ReadPlanner::estimateSplitCost(const uint32_t roundTrip, const uint32_t baud)
+{
+    // 8 byte request, plus 5 bytes of response header and CRC.
+    constexpr uint32_t FRAMING = 13;
+    // 1 start, 8 data, and 1 stop bit.  In tenths of a microsecond.
+    const auto byteTime = std::max<uint32_t>(100000000UL / std::max<uint32_t>(baud, 1), 1);
+    const auto turnaround = roundTrip * 10 / byteTime;
+    return std::min<uint32_t>(FRAMING + turnaround, UINT16_MAX);
+}
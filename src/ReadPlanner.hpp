@@ -0,0 +1,90 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Maximum number of registers in one "Read Holding Registers" (0x03) request.
+ * @see Modbus Specification V1.1b3 P.15
+ */
+constexpr uint16_t MAX_READ_REGISTERS = 125;
+
+///@brief A run of consecutive Modbus registers.
+struct RegisterSpan
+{
+    uint16_t address = 0;
+    uint16_t length = 0;
+
+    [[nodiscard]] constexpr uint32_t end() const
+    {
+        return address + length;
+    }
+};
+
+/**
+ * @brief Merges wanted registers into as few "Read Holding Registers" requests as is worthwhile.
+ * @details Each gap between wanted registers is either read across, or becomes a split into a new request.
+ *          Reading across costs two response bytes per register.
+ *          Splitting costs a whole extra transaction, expressed in bytes of wire time.
+ *          <br/>
+ *          Gaps are only read across if every register in them is known to exist.
+ *          Drives answer reads of undefined registers with an exception, which would fail the whole request.
+ */
+class ReadPlanner
+{
+public:
+    /**
+     * @param layout Registers known to exist, sorted by address.  Each at most `MAX_SPAN_LENGTH` long.
+     * @param layoutSize Number of entries in `layout`.
+     */
+    constexpr ReadPlanner(const RegisterSpan* layout, const size_t layoutSize):
+        layout{layout},
+        layoutSize{layoutSize}
+    {
+    }
+
+    /**
+     * @brief Plan the reads.
+     * @param wanted Registers to read, sorted by address, and not overlapping.
+     * @param count Number of entries in `wanted`.
+     * @param reads Receives the planned requests.  Must have room for `count` entries.
+     * @param splitCost Cost of an extra transaction, in bytes.
+     * @return Number of requests in `reads`.
+     */
+    size_t plan(const RegisterSpan* wanted, size_t count, RegisterSpan* reads, uint16_t splitCost) const;
+
+    /**
+     * @brief Plan just the first read.  For lists too long to plan all at once.
+     * @param wanted Registers to read, sorted by address, and not overlapping.
+     * @param count Number of entries in `wanted`.  At least 1.
+     * @param read Receives the request.
+     * @param splitCost Cost of an extra transaction, in bytes.
+     * @return Number of entries of `wanted` the request covers.
+     */
+    size_t planNext(const RegisterSpan* wanted, size_t count, RegisterSpan& read, uint16_t splitCost) const;
+
+    ///@return true if every register from `start` up to (not including) `end` exists.
+    [[nodiscard]] bool isReadable(uint32_t start, uint32_t end) const;
+
+    /**
+     * @brief Estimate the cost of an extra transaction.
+     * @details Request and response framing, plus the drive's turnaround time.
+     * @param roundTrip Measured round trip time, in microseconds.  0 if unknown.
+     * @param baud Bus speed.
+     * @return Cost in bytes of wire time.
+     */
+    static uint16_t estimateSplitCost(uint32_t roundTrip, uint32_t baud);
+
+    ///@brief Longest value in a layout.  32 bits.
+    static constexpr uint16_t MAX_SPAN_LENGTH = 2;
+
+private:
+    const RegisterSpan* layout;
+    size_t layoutSize;
+};
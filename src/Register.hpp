@@ -0,0 +1,66 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+enum RegisterAccess : uint8_t
+{
+    READ_ONLY = 0,
+    READ_WRITE = 1
+};
+
+/**
+ * @brief A typed Modbus holding register, known at compile time.
+ * @details Width, signedness, and word order all come from the type.
+ *          32 bit values are sent high word first.
+ * @tparam Address Register address.
+ * @tparam T Value type.  An 8, 16, or 32 bit integer.
+ * @tparam Access Whether the register may be written.
+ */
+template <uint16_t Address, typename T, RegisterAccess Access>
+struct Register
+{
+    static_assert(std::is_integral_v<T> && sizeof(T) <= 4, "Registers hold 8, 16, or 32 bit integers");
+
+    using type = T;
+    static constexpr uint16_t address = Address;
+    ///@brief Number of 16 bit registers the value occupies.
+    static constexpr uint16_t length = sizeof(T) > 2 ? 2 : 1;
+    static constexpr bool writable = Access == READ_WRITE;
+
+    ///@brief Convert raw registers to a value.
+    static constexpr T decode(const uint16_t* registers)
+    {
+        if constexpr (length == 2)
+        {
+            return static_cast<T>(static_cast<uint32_t>(registers[0]) << 16 | registers[1]);
+        }
+        else
+        {
+            // Narrowing keeps only the low byte of 8 bit values, sign included.
+            return static_cast<T>(registers[0]);
+        }
+    }
+
+    ///@brief Convert a value to raw registers.
+    static constexpr void encode(const T value, uint16_t* registers)
+    {
+        if constexpr (length == 2)
+        {
+            const auto raw = static_cast<uint32_t>(value);
+            registers[0] = static_cast<uint16_t>(raw >> 16);
+            registers[1] = static_cast<uint16_t>(raw & 0xFFFF);
+        }
+        else
+        {
+            // 8 bit values are sent as their low byte, without sign extension.
+            registers[0] = static_cast<uint16_t>(static_cast<std::make_unsigned_t<T>>(value));
+        }
+    }
+};
@@ -0,0 +1,77 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "RttEstimator.hpp"
+#include <algorithm>
+
+RttEstimator::RttEstimator(const uint32_t floor, const uint32_t ceiling):
+    floor{floor},
+    ceiling{ceiling},
+    timeout{ceiling}
+{
+}
+
+void RttEstimator::addSample(uint32_t rtt)
+{
+    // Nothing slower than the ceiling can be waited for, so one bad measurement must not count for more.
+    rtt = std::min<uint32_t>(rtt, ceiling.load() * 1000);
+    if (not hasSample)
+    {
+        hasSample = true;
+        mean = rtt;
+        deviation = rtt / 2;
+    }
+    else
+    {
+        const auto error = rtt > mean ? rtt - mean : mean - rtt;
+        // Gains of 1/4 and 1/8, from RFC 6298.
+        deviation = deviation - deviation / 4 + error / 4;
+        mean = mean - mean / 8 + rtt / 8;
+    }
+    backoff = 0;
+    updateTimeout();
+}
+
+void RttEstimator::addTimeout()
+{
+    timeouts.fetch_add(1, std::memory_order_relaxed);
+    if (hasSample && backoff < MAX_BACKOFF)
+    {
+        backoff++;
+        updateTimeout();
+    }
+}
+
+void RttEstimator::setLimits(const uint32_t floor, const uint32_t ceiling)
+{
+    this->floor = floor;
+    this->ceiling = std::max(floor, ceiling);
+    if (hasSample)
+    {
+        updateTimeout();
+    }
+    else
+    {
+        timeout = this->ceiling.load();
+    }
+}
+
+void RttEstimator::reset()
+{
+    hasSample = false;
+    backoff = 0;
+    mean = 0;
+    deviation = 0;
+    timeout = ceiling.load();
+}
+
+void RttEstimator::updateTimeout()
+{
+    // Round up to whole milliseconds.
+    const auto rto = (mean + 4 * deviation + 999) / 1000;
+    timeout = std::clamp<uint32_t>(rto << backoff, floor, ceiling);
+}
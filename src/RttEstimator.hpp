@@ -0,0 +1,93 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Round trip time estimator, used to pick response timeouts.
+ * @details Same approach as TCP's retransmission timer (RFC 6298).
+ *          Keeps a smoothed mean and mean deviation, and uses `mean + 4 * deviation` as the timeout.
+ *          Each consecutive timeout doubles the result, until a response arrives again.
+ *          <br/>
+ *          Results are clamped to a configurable floor and ceiling.
+ *          Getters may be called from any task.
+ */
+class RttEstimator
+{
+public:
+    /**
+     * @param floor Minimum timeout, in milliseconds.
+     * @param ceiling Maximum timeout, in milliseconds.  Also used until the first sample arrives.
+     */
+    RttEstimator(uint32_t floor, uint32_t ceiling);
+
+    /**
+     * @brief Record a measured round trip time, in microseconds.
+     * @details Clamped to the ceiling, so a single bad measurement can not push the timeout out for long.
+     */
+    void addSample(uint32_t rtt);
+
+    ///@brief Record a transaction which timed out.
+    void addTimeout();
+
+    ///@brief Change the timeout limits, in milliseconds.
+    void setLimits(uint32_t floor, uint32_t ceiling);
+
+    ///@brief Forget all samples.
+    void reset();
+
+    ///@return Timeout to use for the next transaction, in milliseconds.
+    [[nodiscard]] uint32_t getTimeout() const
+    {
+        return timeout.load(std::memory_order_relaxed);
+    }
+
+    ///@return Smoothed round trip time, in microseconds.
+    [[nodiscard]] uint32_t getMean() const
+    {
+        return mean.load(std::memory_order_relaxed);
+    }
+
+    ///@return Round trip time mean deviation, in microseconds.
+    [[nodiscard]] uint32_t getDeviation() const
+    {
+        return deviation.load(std::memory_order_relaxed);
+    }
+
+    ///@return Total number of timeouts recorded.
+    [[nodiscard]] uint32_t getTimeouts() const
+    {
+        return timeouts.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint32_t getFloor() const
+    {
+        return floor.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint32_t getCeiling() const
+    {
+        return ceiling.load(std::memory_order_relaxed);
+    }
+
+private:
+    ///@brief Never back off more than 2^MAX_BACKOFF times.
+    static constexpr uint8_t MAX_BACKOFF = 5;
+
+    std::atomic<uint32_t> floor;
+    std::atomic<uint32_t> ceiling;
+    std::atomic<uint32_t> mean{0};
+    std::atomic<uint32_t> deviation{0};
+    std::atomic<uint32_t> timeout;
+    std::atomic<uint32_t> timeouts{0};
+    bool hasSample = false;
+    uint8_t backoff = 0;
+
+    void updateTimeout();
+};
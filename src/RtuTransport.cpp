@@ -0,0 +1,168 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "RtuTransport.hpp"
+#include "ModbusDefinitions.hpp"
+
+RtuTransport::RtuTransport(HardwareSerial& serial, const bool reassembleRequests):
+    serial{serial},
+    reassembleRequests{reassembleRequests}
+{
+}
+
+void RtuTransport::begin(const uint32_t baud, const uint32_t config)
+{
+    this->baud = baud;
+    const auto dataBits = 5 + (config >> 2 & 0x03);
+    const auto parityBits = (config & 0x02) ? 1 : 0;
+    const auto stopBits = (config & 0x30) == 0x30 ? 2 : 1;
+    bitsPerCharacter = 1 + dataBits + parityBits + stopBits;
+    listener = xTaskGetCurrentTaskHandle();
+
+    // The timeout must be set first, or the callback also runs every time the FIFO fills.
+    serial.setRxTimeout(RX_TIMEOUT_SYMBOLS);
+    serial.onReceive([this]
+    {
+        onReceive();
+    }, true);
+}
+
+void RtuTransport::send(ModbusADU& adu)
+{
+    listener = xTaskGetCurrentTaskHandle();
+    adu.updateCrc();
+    const auto sentAt = micros();
+    serial.write(adu.rtu, adu.getRtuLen());
+    if (recorder != nullptr)
+    {
+        recorder->record(recorderChannel, FLIGHT_SENT, sentAt, adu.rtu, adu.getRtuLen());
+    }
+}
+
+void RtuTransport::clear()
+{
+    while (frames.front() != nullptr)
+    {
+        frames.pop();
+    }
+}
+
+bool RtuTransport::wait(const TickType_t ticks)
+{
+    if (not frames.empty())
+    {
+        return true;
+    }
+    ulTaskNotifyTake(pdTRUE, ticks);
+    return not frames.empty();
+}
+
+unsigned long RtuTransport::characterTime(const size_t count) const
+{
+    return baud == 0 ? 0 : static_cast<unsigned long>(static_cast<uint64_t>(count) * bitsPerCharacter * 1000000 / baud);
+}
+
+void RtuTransport::onReceive()
+{
+    const auto now = micros();
+    auto available = serial.available();
+    // The UART only noticed the end after the timeout.
+    const auto startedAt = now - characterTime(available + RX_TIMEOUT_SYMBOLS);
+
+    while (available > 0)
+    {
+        auto frame = frames.prepare();
+        if (frame == nullptr)
+        {
+            // Consumer is behind.  Drop everything, so no fragment is mistaken for a frame later.
+            while (serial.read() >= 0)
+            {
+            }
+            partialLength = 0;
+            dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            break;
+        }
+        if (partialLength != 0 && startedAt - partialAt > REASSEMBLY_GAP)
+        {
+            // Too late to be the rest of it, so pass on what there is.
+            publish(*frame, partialLength);
+            continue;
+        }
+        if (partialLength == 0)
+        {
+            frame->startedAt = startedAt;
+        }
+
+        // Straight from the driver into the slot.
+        const auto room = MODBUS_RTU_MAX_ADU_SIZE - partialLength;
+        const auto length = serial.read(frame->adu.rtu + partialLength, std::min<size_t>(available, room));
+        if (length == 0)
+        {
+            break;
+        }
+        available -= length;
+        partialLength += length;
+        partialAt = now;
+        if (available == 0 && reassembleRequests && isPartialRequest(frame->adu.rtu, partialLength))
+        {
+            return;
+        }
+        publish(*frame, partialLength);
+    }
+
+    const auto task = listener.load();
+    if (task != nullptr)
+    {
+        xTaskNotifyGive(task);
+    }
+}
+
+bool RtuTransport::isPartialRequest(const uint8_t* frame, const uint16_t length) const
+{
+    // ASCII commands share the host port, and unit ids can be printable, so only the framing tells them apart.
+    // A line ending is never the start of a request.
+    if (length >= MODBUS_RTU_MAX_ADU_SIZE || frame[0] == '\r' || frame[0] == '\n')
+    {
+        return false;
+    }
+    if (length < 2)
+    {
+        // A unit id, or a single key pressed.  The next piece tells which.
+        return true;
+    }
+    // Text never has a function code second, so a command line falls through to the default.
+    switch (frame[1])
+    {
+    case 0x01:
+    case 0x02:
+    case 0x03:
+    case 0x04:
+    case 0x05:
+    case 0x06:
+        return length < 8;
+    case 0x0F:
+    case 0x10:
+        return length < 7 || length < 9 + frame[6];
+    case 0x17:
+        return length < 11 || length < 13 + frame[10];
+    default:
+        // Length unknown, so take it as it is.
+        return false;
+    }
+}
+
+void RtuTransport::publish(RtuFrame& frame, const uint16_t length)
+{
+    frame.length = length;
+    frame.adu.setRtuLen(length);
+    if (recorder != nullptr)
+    {
+        recorder->record(recorderChannel, FLIGHT_RECEIVED, frame.startedAt, frame.adu.rtu, length);
+    }
+    frames.publish();
+    partialLength = 0;
+}
@@ -0,0 +1,144 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <ModbusADU.h>
+#include <atomic>
+
+#include "FlightRecorder.hpp"
+#include "SpscQueue.hpp"
+
+///@brief A received frame.
+struct RtuFrame
+{
+    ModbusADU adu;
+    ///@brief Bytes received.  Unlike `ModbusADU::getRtuLen`, valid for runt frames too.
+    uint16_t length = 0;
+    ///@brief `micros()` when the first byte arrived.  Estimated from the frame length.
+    unsigned long startedAt = 0;
+};
+
+/**
+ * @brief Modbus RTU framing, driven by the UART's receive timeout.
+ * @details The UART hardware marks the end of a frame after `RX_TIMEOUT_SYMBOLS` characters of silence.
+ *          The serial event task then reads the frame straight into a preallocated slot, and notifies the listening task.
+ *          Nothing polls the port byte by byte, or waits out the inter-frame gap in software.
+ *          <br/>
+ *          Frames pass to a single consumer through a lock-free SPSC queue, and are read in place.
+ *          The listener is whichever task last called `begin()` or `send()`.
+ *          <br/>
+ *          Every frame sent or received can also be kept in a flight recorder.
+ * @warning Takes over the serial port's receive side.  Nothing else may read from it.
+ */
+class RtuTransport
+{
+public:
+    ///@brief Frames which may wait to be read.  Anything more is dropped.
+    static constexpr size_t FRAME_SLOTS = 4;
+
+    ///@brief Silence which ends a frame, in characters.  Rounded up from the 3.5 the standard asks for.
+    static constexpr uint8_t RX_TIMEOUT_SYMBOLS = 4;
+
+    /**
+     * @param serial Port to use.
+     * @param reassembleRequests USB serial adapters deliver data in packets, which can split a frame in two.
+     *                           If set, a request shorter than its function code says is held until the rest arrives.
+     *                           Text without a function code in its second byte, like an ASCII command, is passed straight on.
+     */
+    explicit RtuTransport(HardwareSerial& serial, bool reassembleRequests = false);
+    RtuTransport(const RtuTransport&) = delete;
+    RtuTransport(const RtuTransport&&) = delete;
+
+    /**
+     * @brief Start listening for frames.
+     * @details Call after the serial port is started, and again whenever its baud rate changes.
+     */
+    void begin(uint32_t baud, uint32_t config);
+
+    /**
+     * @brief Record every frame sent and received from now on.
+     * @details Set before calling `begin()`.
+     * @param channel Stored with each record, to tell ports apart.
+     */
+    void setRecorder(FlightRecorder* recorder, const uint8_t channel)
+    {
+        this->recorder = recorder;
+        recorderChannel = channel;
+    }
+
+    /**
+     * @brief Send a frame.  Calculates the CRC.
+     * @details Does not wait for the frame to leave the wire.
+     */
+    void send(ModbusADU& adu);
+
+    /**
+     * @brief Get the oldest received frame, without blocking.  Consumer only.
+     * @details Must be followed by `release()`.
+     * @return The frame, or nullptr if none is waiting.
+     */
+    RtuFrame* receive()
+    {
+        return frames.front();
+    }
+
+    ///@brief Release the frame returned by `receive()`.  Consumer only.
+    void release()
+    {
+        frames.pop();
+    }
+
+    ///@brief Drop every frame waiting to be read.  Consumer only.
+    void clear();
+
+    /**
+     * @brief Sleep until a frame arrives, or something else notifies this task.
+     * @return true if a frame is waiting.
+     */
+    bool wait(TickType_t ticks);
+
+    ///@brief Time to send `count` characters at the current baud rate, in microseconds.
+    [[nodiscard]] unsigned long characterTime(size_t count) const;
+
+    ///@brief Frames thrown away because every slot was full.
+    [[nodiscard]] uint32_t getDropped() const
+    {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    HardwareSerial& serial;
+    const bool reassembleRequests;
+    SpscQueue<RtuFrame, FRAME_SLOTS> frames;
+    std::atomic<TaskHandle_t> listener{nullptr};
+    std::atomic<uint32_t> dropped{0};
+
+    FlightRecorder* recorder = nullptr;
+    uint8_t recorderChannel = 0;
+
+    uint32_t baud = 0;
+    ///@brief Start, data, parity, and stop bits per character.
+    uint8_t bitsPerCharacter = 10;
+
+    ///@brief Bytes already in the slot being filled, waiting for the rest of a split request.
+    uint16_t partialLength = 0;
+    ///@brief `micros()` when the last piece arrived.
+    unsigned long partialAt = 0;
+
+    ///@brief Longest gap inside a split request, in microseconds.
+    static constexpr unsigned long REASSEMBLY_GAP = 5000;
+
+    ///@brief Called by the serial event task, once the line goes quiet.
+    void onReceive();
+
+    ///@return true if `frame` is the start of a request, with more to come.
+    [[nodiscard]] bool isPartialRequest(const uint8_t* frame, uint16_t length) const;
+
+    ///@brief Hand the slot being filled to the consumer.
+    void publish(RtuFrame& frame, uint16_t length);
+};
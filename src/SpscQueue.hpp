@@ -0,0 +1,131 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief Lock-free single-producer/single-consumer containers for passing data between tasks.
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Fixed size lock-free single-producer/single-consumer FIFO.
+ * @details Elements are never copied by the queue.
+ *          The producer fills a slot in place (`prepare()` then `publish()`),
+ *          and the consumer reads it in place (`front()` then `pop()`).
+ *          This matters for types like `ModbusADU`, which are not safe to copy by value.
+ * @tparam T Element type.  Must be default constructible.
+ * @tparam N Capacity.  Must be a power of two.
+ */
+template <typename T, size_t N>
+class SpscQueue
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    /**
+     * @brief Get the next free slot.  Producer only.
+     * @return The slot to fill, or nullptr if the queue is full.
+     */
+    T* prepare()
+    {
+        const auto h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == N)
+        {
+            return nullptr;
+        }
+        return &slots[h & (N - 1)];
+    }
+
+    /**
+     * @brief Make the slot returned by `prepare()` visible to the consumer.  Producer only.
+     */
+    void publish()
+    {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Get the oldest element.  Consumer only.
+     * @return The element, or nullptr if the queue is empty.
+     */
+    T* front()
+    {
+        const auto t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        return &slots[t & (N - 1)];
+    }
+
+    /**
+     * @brief Release the element returned by `front()`.  Consumer only.
+     */
+    void pop()
+    {
+        tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+private:
+    std::array<T, N> slots = {};
+    std::atomic<size_t> head{0};
+    std::atomic<size_t> tail{0};
+};
+
+/**
+ * @brief Lock-free single-producer/single-consumer "latest value" mailbox.
+ * @details A triple buffer.
+ *          The producer never blocks and never overwrites the slot being read.
+ *          The consumer always gets the most recent complete value, and older values are dropped.
+ * @tparam T Value type.  Must be copy assignable.
+ */
+template <typename T>
+class SpscLatest
+{
+public:
+    /**
+     * @brief Publish a new value.  Producer only.
+     */
+    void write(const T& value)
+    {
+        slots[back] = value;
+        const auto previous = middle.exchange(back | FRESH, std::memory_order_acq_rel);
+        back = previous & INDEX;
+    }
+
+    /**
+     * @brief Get the latest value, if there is a new one.  Consumer only.
+     * @param value Set to the latest value.  Unchanged if nothing new has been published.
+     * @return true if `value` was updated.
+     */
+    bool read(T& value)
+    {
+        if (not (middle.load(std::memory_order_relaxed) & FRESH))
+        {
+            return false;
+        }
+        const auto previous = middle.exchange(front, std::memory_order_acq_rel);
+        front = previous & INDEX;
+        value = slots[front];
+        return true;
+    }
+
+private:
+    static constexpr uint8_t INDEX = 0x03;
+    static constexpr uint8_t FRESH = 0x04;
+
+    std::array<T, 3> slots = {};
+    uint8_t back = 0;
+    std::atomic<uint8_t> middle{1};
+    uint8_t front = 2;
+};
@@ -0,0 +1,79 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "Statistics.hpp"
+
+void LatencyHistogram::add(const uint32_t micros)
+{
+    size_t bucket = 0;
+    while (bucket < BUCKETS - 1 && micros >> bucket != 0)
+    {
+        bucket++;
+    }
+    auto& counter = buckets[bucket];
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (micros > max.load(std::memory_order_relaxed))
+    {
+        max.store(micros, std::memory_order_relaxed);
+    }
+}
+
+uint32_t LatencyHistogram::getPercentile(const uint8_t percent) const
+{
+    const auto total = static_cast<uint64_t>(getCount());
+    if (total == 0)
+    {
+        return 0;
+    }
+    // Rank of the sample wanted, counting from 1.
+    const auto rank = std::max<uint64_t>(1, (total * percent + 99) / 100);
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < BUCKETS; bucket++)
+    {
+        seen += buckets[bucket].load(std::memory_order_relaxed);
+        if (seen >= rank)
+        {
+            return bucket == 0 ? 0 : std::min<uint32_t>((1UL << bucket) - 1, getMax());
+        }
+    }
+    return getMax();
+}
+
+void BusStatistics::record(const ModbusRTUMasterError error, const uint32_t micros)
+{
+    switch (error)
+    {
+    case MODBUS_RTU_MASTER_SUCCESS:
+        latency.add(micros);
+        break;
+    case MODBUS_RTU_MASTER_EXCEPTION_RESPONSE:
+        exceptions.increment();
+        latency.add(micros);
+        break;
+    case MODBUS_RTU_MASTER_RESPONSE_TIMEOUT:
+        timeouts.increment();
+        break;
+    case MODBUS_RTU_MASTER_CRC_ERROR:
+        crcErrors.increment();
+        break;
+    case MODBUS_RTU_MASTER_FRAME_ERROR:
+    case MODBUS_RTU_MASTER_UNEXPECTED_ID:
+    case MODBUS_RTU_MASTER_UNEXPECTED_FUNCTION_CODE:
+    case MODBUS_RTU_MASTER_UNEXPECTED_LENGTH:
+    case MODBUS_RTU_MASTER_UNEXPECTED_BYTE_COUNT:
+    case MODBUS_RTU_MASTER_UNEXPECTED_ADDRESS:
+    case MODBUS_RTU_MASTER_UNEXPECTED_VALUE:
+    case MODBUS_RTU_MASTER_UNEXPECTED_QUANTITY:
+        frameErrors.increment();
+        break;
+    default:
+        // Never reached the wire.
+        return;
+    }
+    transactions.increment();
+}
@@ -0,0 +1,134 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief Lock-free counters and histograms, for watching bus health.
+ * @details Every statistic has a single writer, so updates are plain loads and stores instead of read-modify-write.
+ *          Any task may read them at any time.
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <ModbusRTUMaster.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Cheap timestamp, in CPU cycles.
+ * @details Wraps roughly every 18 seconds at 240MHz, so only use it for short intervals.
+ */
+inline uint32_t cycleCount()
+{
+    return ESP.getCycleCount();
+}
+
+/**
+ * @return Microseconds since `start`, a `cycleCount()`.
+ * @warning Wrong once the cycle counter wraps, so only for intervals bounded well below that.  Time anything which may block with `micros()` or `millis()`.
+ */
+inline uint32_t microsSince(const uint32_t start)
+{
+    return (cycleCount() - start) / ESP.getCpuFreqMHz();
+}
+
+///@brief Event counter.  One writer, any number of readers.
+class Counter
+{
+public:
+    void increment()
+    {
+        value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint32_t get() const
+    {
+        return value.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint32_t> value{0};
+};
+
+/**
+ * @brief Histogram of durations, with power of two buckets.
+ * @details Bucket 0 counts 0us.  Bucket n counts [2^(n-1), 2^n) microseconds.
+ *          One writer, any number of readers.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr size_t BUCKETS = 24;
+
+    ///@brief Record a duration, in microseconds.
+    void add(uint32_t micros);
+
+    /**
+     * @brief Estimate a percentile.
+     * @param percent 0 to 100.
+     * @return Upper bound of the bucket the percentile falls in, in microseconds.  0 if empty.
+     */
+    [[nodiscard]] uint32_t getPercentile(uint8_t percent) const;
+
+    [[nodiscard]] uint32_t getCount() const
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    ///@return Longest duration recorded, in microseconds.
+    [[nodiscard]] uint32_t getMax() const
+    {
+        return max.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::array<std::atomic<uint32_t>, BUCKETS> buckets = {};
+    std::atomic<uint32_t> count{0};
+    std::atomic<uint32_t> max{0};
+};
+
+/**
+ * @brief Health of one motor bus.
+ * @details Updated by the task which owns the bus.
+ */
+class BusStatistics
+{
+public:
+    /**
+     * @brief Record a finished transaction.
+     * @details Errors which mean nothing was sent, like invalid arguments, are ignored.
+     * @param error Result.
+     * @param micros Time from sending the request to the end of the response.  Only recorded for responses.
+     */
+    void record(ModbusRTUMasterError error, uint32_t micros);
+
+    Counter transactions;
+    Counter timeouts;
+    Counter crcErrors;
+    ///@brief Frames which were too short, or did not match the request.
+    Counter frameErrors;
+    Counter exceptions;
+    ///@brief Time taken by transactions which got a response.
+    LatencyHistogram latency;
+};
+
+/**
+ * @brief Health of the host side.
+ * @details Updated by `loop()`.
+ */
+class GatewayStatistics
+{
+public:
+    Counter loops;
+    ///@brief Time taken by each pass through `loop()`.
+    LatencyHistogram loopTime;
+    ///@brief Frames received from the host.
+    Counter hostRequests;
+    ///@brief Frames forwarded to a motor.
+    Counter forwarded;
+    ///@brief Motor reads answered from the latest status poll.
+    Counter cached;
+    ///@brief Time from receiving a host frame to sending the reply.
+    LatencyHistogram serviceTime;
+};
@@ -0,0 +1,136 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "TelemetryStream.hpp"
+
+namespace
+{
+    size_t putVarint(uint8_t* buffer, uint32_t value)
+    {
+        size_t length = 0;
+        while (value >= 0x80)
+        {
+            buffer[length++] = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        buffer[length++] = static_cast<uint8_t>(value);
+        return length;
+    }
+
+    size_t putSigned(uint8_t* buffer, const int32_t value)
+    {
+        // Zigzag, so small negative numbers stay small.
+        return putVarint(buffer, static_cast<uint32_t>(value) << 1 ^ static_cast<uint32_t>(value >> 31));
+    }
+
+    ///@brief CRC-16/MODBUS, the same as RTU frames use.
+    uint16_t crc16(const uint8_t* buffer, const size_t length)
+    {
+        uint16_t crc = 0xFFFF;
+        for (size_t i = 0; i < length; i++)
+        {
+            crc ^= buffer[i];
+            for (auto bit = 0; bit < 8; bit++)
+            {
+                crc = crc & 1 ? crc >> 1 ^ 0xA001 : crc >> 1;
+            }
+        }
+        return crc;
+    }
+}
+
+void TelemetrySample::setAxis(const size_t axis, const LinearMotorStatus& status)
+{
+    auto& value = axes[axis];
+    // The optional fields can fail on their own, leaving them out of `fields`.
+    value.valid = status.modbusError == MODBUS_RTU_MASTER_SUCCESS && (status.fields & TELEMETRY_STATUS_FIELDS) == TELEMETRY_STATUS_FIELDS;
+    value.offset = status.timestamp - time;
+    value.errorCode = status.errorCode;
+    value.position = status.position;
+    value.followingError = status.followingError;
+    value.current = status.current;
+}
+
+size_t TelemetryEncoder::encode(const TelemetrySample& sample, uint8_t* frame)
+{
+    auto keyframe = sinceKeyframe >= KEYFRAME_INTERVAL;
+    for (size_t axis = 0; axis < sample.axes.size(); axis++)
+    {
+        if (sample.axes[axis].valid && not previous.axes[axis].valid)
+        {
+            keyframe = true;
+        }
+    }
+    sinceKeyframe = keyframe ? 1 : sinceKeyframe + 1;
+
+    auto payload = frame + 2;
+    size_t length = 0;
+    payload[length++] = keyframe ? KEYFRAME : DELTA;
+    payload[length++] = sequence++;
+    if (keyframe)
+    {
+        for (auto shift = 0; shift < 32; shift += 8)
+        {
+            payload[length++] = static_cast<uint8_t>(sample.time >> shift);
+        }
+    }
+    else
+    {
+        length += putVarint(payload + length, sample.time - previous.time);
+    }
+
+    for (size_t i = 0; i < sample.axes.size(); i++)
+    {
+        const auto& axis = sample.axes[i];
+        const auto& last = previous.axes[i];
+        const auto hasError = axis.valid && axis.errorCode != 0;
+        payload[length++] = (axis.valid ? 0x01 : 0x00) | (hasError ? 0x02 : 0x00);
+        length += putVarint(payload + length, axis.offset);
+        if (not axis.valid)
+        {
+            continue;
+        }
+        if (keyframe)
+        {
+            length += putSigned(payload + length, axis.position);
+            length += putSigned(payload + length, axis.followingError);
+            length += putSigned(payload + length, axis.current);
+        }
+        else
+        {
+            // Wraps, like the decoder's arithmetic.
+            length += putSigned(payload + length, static_cast<int32_t>(static_cast<uint32_t>(axis.position) - last.position));
+            length += putSigned(payload + length, static_cast<int32_t>(static_cast<uint32_t>(axis.followingError) - last.followingError));
+            length += putSigned(payload + length, axis.current - last.current);
+        }
+        if (hasError)
+        {
+            length += putVarint(payload + length, axis.errorCode);
+        }
+    }
+
+    // Invalid axes keep their last good values, so deltas stay relative to something the receiver has.
+    for (size_t i = 0; i < sample.axes.size(); i++)
+    {
+        if (sample.axes[i].valid)
+        {
+            previous.axes[i] = sample.axes[i];
+        }
+        else
+        {
+            previous.axes[i].valid = false;
+        }
+    }
+    previous.time = sample.time;
+
+    frame[0] = SYNC;
+    frame[1] = static_cast<uint8_t>(length);
+    const auto crc = crc16(frame + 1, length + 1);
+    frame[2 + length] = crc & 0xFF;
+    frame[3 + length] = crc >> 8;
+    return length + 4;
+}
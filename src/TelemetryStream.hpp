@@ -0,0 +1,86 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "LinearMotor.hpp"
+
+///@brief Status fields each telemetry sample needs.
+constexpr uint16_t TELEMETRY_STATUS_FIELDS = STATUS_ERROR_CODE | STATUS_POSITION | STATUS_CURRENT | STATUS_FOLLOWING_ERROR;
+
+///@brief One axis of a telemetry sample.
+struct TelemetryAxis
+{
+    ///@brief false if the axis could not be read.  Nothing else is sent.
+    bool valid = false;
+    ///@brief When the axis was read, in microseconds after the sample was triggered.
+    uint32_t offset = 0;
+    uint16_t errorCode = 0;
+    int32_t position = 0;
+    int32_t followingError = 0;
+    int16_t current = 0;
+};
+
+///@brief Both axes, sampled at the same moment.
+struct TelemetrySample
+{
+    ///@brief `micros()` when the sample was triggered.
+    uint32_t time = 0;
+    std::array<TelemetryAxis, 2> axes = {};
+
+    /**
+     * @brief Fill in one axis from a status snapshot.
+     * @param axis 0 for X, 1 for Y.
+     */
+    void setAxis(size_t axis, const LinearMotorStatus& status);
+};
+
+/**
+ * @brief Packs telemetry samples into compact binary frames.
+ * @details Frame: sync (0xA5), payload length, payload, CRC-16/MODBUS of length and payload (low byte first).
+ *          <br/>
+ *          Payload: kind (1: keyframe, 2: delta), sequence number, time, then X and Y.
+ *          Keyframes carry the time as a little endian uint32, and absolute values.
+ *          Delta frames carry the time since the last frame, and the change in each value.
+ *          Each axis is a flags byte (bit 0: valid, bit 1: error code follows), then its offset.
+ *          Valid axes follow with position, following error, and current, then the error code if flagged.
+ *          <br/>
+ *          Everything after the time is a LEB128 varint, with signed values zigzag encoded.
+ *          A keyframe is sent periodically, and whenever an axis recovers, so a receiver can join at any time.
+ */
+class TelemetryEncoder
+{
+public:
+    static constexpr uint8_t SYNC = 0xA5;
+    static constexpr uint8_t KEYFRAME = 1;
+    static constexpr uint8_t DELTA = 2;
+    static constexpr uint8_t KEYFRAME_INTERVAL = 64;
+    ///@brief Worst case frame size.
+    static constexpr size_t MAX_FRAME_SIZE = 64;
+
+    /**
+     * @brief Encode a sample.
+     * @param sample Sample to send.
+     * @param frame Receives up to `MAX_FRAME_SIZE` bytes.
+     * @return Frame length.
+     */
+    size_t encode(const TelemetrySample& sample, uint8_t* frame);
+
+    ///@brief Make the next frame a keyframe.
+    void reset()
+    {
+        sinceKeyframe = KEYFRAME_INTERVAL;
+    }
+
+private:
+    TelemetrySample previous;
+    uint8_t sequence = 0;
+    uint8_t sinceKeyframe = KEYFRAME_INTERVAL;
+};
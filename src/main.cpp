@@ -1,15 +1,30 @@
 /**
  *@file
  */
+#include <climits>
+#include <cstdio>
 #include <cstring>
+#include <string_view>
 #include <Arduino.h>
 #include <ModbusADU.h>
 #include <ModbusSlaveLogic.h>
+#include <Preferences.h>
 
 #include "ModbusDefinitions.hpp"
 #include "Button.hpp"
+#include "CommandLine.hpp"
+#include "FaultCapture.hpp"
+#include "FaultSupervisor.hpp"
+#include "FlightRecorder.hpp"
+#include "HostLink.hpp"
 #include "LinearMotor.hpp"
+#include "MotorBus.hpp"
+#include "MotorWorker.hpp"
+#include "Parameter.hpp"
+#include "ParameterSnapshot.hpp"
 #include "RGLed.hpp"
+#include "Statistics.hpp"
+#include "TelemetryStream.hpp"
 
 #define VERSION "2.0.0"
 
@@ -27,39 +42,200 @@ enum OperatingMode : uint16_t
      */
     RTU_GATEWAY = 1,
 
-    RTU_MIXED = 2
+    RTU_MIXED = 2,
+
+    /**
+     * @brief Binary telemetry streaming mode.
+     * @details Both axes are sampled together at a fixed rate, and sent as binary frames.
+     *          Buttons, LEDs, and error detection work as in ASCII mode.
+     *          ASCII commands and Modbus RTU are still accepted.
+     * @see TelemetryEncoder
+     */
+    STREAMING = 3
+};
+
+/**
+ * @brief Where a drive is, and how the host reaches it.
+ */
+struct AxisConfig
+{
+    const char* name;
+    ///@brief Index into `MotorBuses`.
+    uint8_t bus;
+    ///@brief Modbus node id on its bus.  Drives ship with 1, so any others must be moved with "NODE_ID".
+    uint8_t nodeId;
+    ///@brief Gateway unit id, until changed with "ROUTE".  0 leaves the axis unrouted.
+    uint8_t unitId;
+};
+
+/**
+ * @brief Every drive.  Grow the array to add more.
+ * @details X and Y must come first.  The single axis commands, LEDs, and telemetry use them.
+ *          Drives sharing a bus need their own node ids.  Unit id 1 is this board, and `FAN_OUT_UNIT` every axis at once.
+ */
+constexpr std::array<AxisConfig, 2> AXIS_CONFIG = {{
+    {"X", 0, 1, 2},
+    {"Y", 1, 1, 3},
+    // A gantry adds drives to the existing buses.
+    // {"Y2", 1, 2, 5},
+    // {"Z", 0, 2, 6},
+}};
+
+#define MOTOR_BUS_COUNT 2 // One per motor UART
+#define FAN_OUT_UNIT 4 // Gateway unit id which writes to every routed axis at once
+
+///@return true if every drive has a bus with room for it, and no two drives clash.
+constexpr bool isValidAxisConfig()
+{
+    for (size_t i = 0; i < AXIS_CONFIG.size(); i++)
+    {
+        const auto &axis = AXIS_CONFIG[i];
+        if (axis.bus >= MOTOR_BUS_COUNT || axis.nodeId == 0 || axis.unitId == 1 || axis.unitId == FAN_OUT_UNIT || axis.unitId > 247)
+        {
+            return false;
+        }
+        size_t sharingBus = 0;
+        for (size_t j = 0; j < AXIS_CONFIG.size(); j++)
+        {
+            const auto &other = AXIS_CONFIG[j];
+            sharingBus += other.bus == axis.bus;
+            if (i != j && ((other.bus == axis.bus && other.nodeId == axis.nodeId) || (axis.unitId != 0 && other.unitId == axis.unitId)))
+            {
+                return false;
+            }
+        }
+        if (sharingBus > MotorBus::MAX_DRIVES)
+        {
+            return false;
+        }
+    }
+    return AXIS_CONFIG.size() >= 2 && AXIS_CONFIG.size() <= FaultSupervisor::MAX_AXES;
+}
+static_assert(isValidAxisConfig(), "Axes need a valid bus, and their own node id on it, and their own unit id");
+
+/**
+ * @brief A drive, and the worker which owns its bus.
+ */
+struct Axis
+{
+    const char* name = "";
+    LinearMotor* motor = nullptr;
+    MotorWorker* worker = nullptr;
+    ///@brief The motor's index in its worker.
+    uint8_t slot = 0;
+    ///@brief Gateway unit id.  0 if unrouted.
+    uint8_t unitId = 0;
+    ///@brief Output prefix, like "X axis ".
+    std::array<char, 16> label = {};
+    ///@brief Latest polled status.
+    LinearMotorStatus status;
+    ///@brief Signals from around the latest fault.  Fed by the worker.
+    FaultCapture capture;
+
+    /**
+     * @brief Get a request slot to fill in, aimed at this motor.
+     * @see MotorWorker::prepareRequest
+     */
+    MotorRequest* prepareRequest() const
+    {
+        const auto request = worker->prepareRequest();
+        if (request != nullptr)
+        {
+            request->motor = slot;
+        }
+        return request;
+    }
+
+    /**
+     * @see MotorWorker::execute
+     */
+    MotorResponse& execute(const MotorCommand command, const uint32_t value = 0) const
+    {
+        return worker->execute(slot, command, value);
+    }
 };
 
 ///@brief For when in RTU Mode
-ModbusRTUComm* HostComm;
+RtuTransport* HostTransport;
+///@brief Host serial port baud rate.
+HostLink* Host;
 auto RTUSlaveLogic = ModbusSlaveLogic();
-std::array<uint16_t, 3> holdingRegisters = {};
+#define ROUTE_REGISTER 9 // Gateway unit id of each axis, in order
+std::array<uint16_t, ROUTE_REGISTER + AXIS_CONFIG.size()> holdingRegisters = {};
 std::array<bool, 2> discreteInputs = {};
-bool motorError = true;
+std::array<uint16_t, 87> inputRegisters = {};
+///@brief Axes whose part of the latest fan-out write failed.  Bit `i` is `Axes[i]`.
+uint16_t fanOutFailures = 0;
+
+std::array<MotorBus*, MOTOR_BUS_COUNT> MotorBuses;
+constexpr std::array<const char*, MOTOR_BUS_COUNT> BUS_LABELS = {"Bus 0 ", "Bus 1 "};
+
+///@brief Owns all traffic on the matching bus once started.
+std::array<MotorWorker*, MOTOR_BUS_COUNT> Workers;
+
+auto Axes = std::array<Axis, AXIS_CONFIG.size()>();
+auto &XAxis = Axes[0];
+auto &YAxis = Axes[1];
+
+///@brief Owns the emergency stop pin, once started.
+FaultSupervisor* Supervisor;
+
+///@brief Latest frames on every port.  Frozen when the emergency stop trips.
+auto Recorder = FlightRecorder();
+#define RECORDER_HOST_CHANNEL 0 // Motor bus n records as channel n + 1
+
+/**
+ * @brief Oldest status snapshot which may answer host reads, in milliseconds.
+ * @details 0 forwards every read to the motor.
+ */
+uint16_t gatewayCacheMaxAge = 10;
+
+///@brief Telemetry samples per second, in `STREAMING` mode.
+uint16_t streamRate = 200;
+auto telemetryEncoder = TelemetryEncoder();
+
+///@brief Telemetry sample in progress.
+struct
+{
+    TelemetrySample sample;
+    ///@brief `micros()` when the next sample is due.
+    unsigned long nextAt = 0;
+    bool active = false;
+    bool xDone = false;
+    bool yDone = false;
+} telemetry;
 
-LinearMotor* XMotor;
-LinearMotor* YMotor;
+///@brief Host side counters and timing.
+auto gatewayStatistics = GatewayStatistics();
 
-auto & XMotorSerial = Serial1;
-auto & YMotorSerial = Serial2;
+auto & MotorSerial0 = Serial1;
+auto & MotorSerial1 = Serial2;
 
+///@brief Bus 0, where X is.
 auto XLed = RGLed(19, 21);
+///@brief Bus 1, where Y is.
 auto YLed = RGLed(5, 18);
 
 auto EnableButton = Button(15, 1000);
 auto DisableButton = Button(4, 1000);
 
-void disableBothMotors();
-void enableBothMotors();
+void disableAllMotors();
+uint32_t enableAllMotors();
+void enableAndReport();
 
 void processPureData();
 void executeRtuGatewayLogic();
-void sendCmdByPort(const String &cmd);
+void sendCmdByPort(std::string_view cmd);
 
 OperatingMode mode = ASCII;
 
 #define MODBUS_BAUD 115200
+#define HOST_BAUD_REGISTER 5 // Requested host baud, high word first
+#define AGGREGATE_FUNCTION 0x41 // User defined.  Controller registers and every axis' latest status, in one reply
+#define MOTOR_MAX_BAUD 921600 // Motor buses negotiate up to this
 #define EMERGE_STOP_PIN 14 //stop klipper when error occur
+#define MOTOR_WORKER_CORE 0 // loop() runs on core 1
+#define FAULT_SUPERVISOR_PRIORITY 10 // Above every other application task
 
 /**
  * @brief Print a value in the format 0xFF
@@ -100,41 +276,75 @@ void printHex(T value)
     printHexArray(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
 }
 
+/**
+ * @brief Switch the host port to a new baud rate, or confirm the one just switched to.
+ * @details The reply goes out at the old rate.
+ *          The same command must then be sent again at the new rate, or the old rate comes back.
+ */
+void setHostBaud(const uint32_t baud)
+{
+    const auto confirming = Host->getState() == HOST_LINK_CONFIRMING;
+    if (not Host->request(baud))
+    {
+        Serial.println("Unsupported Host Baud");
+        return;
+    }
+    if (confirming || Host->getState() == HOST_LINK_STEADY)
+    {
+        Serial.print("Host baud: ");
+        Serial.println(Host->getBaud());
+        return;
+    }
+    Serial.print("Switching host baud, confirm within ");
+    Serial.print(HostLink::CONFIRM_TIMEOUT);
+    Serial.println("ms");
+}
+
 /**
  * @brief Read and execute ASCII commands.
- * @details Non-printable characters (except crlf) reset the ASCII command buffer and trigger a Modbus RTU read attempt.
+ * @details Frames with a good CRC, or starting with a non-printable character (except crlf), reset the ASCII command buffer and trigger a Modbus RTU read attempt.
+ *          Unit ids 32-126 are printable, so the CRC is what tells their requests from text.
  */
 void readCmd()
 {
-    static String inData = "";
+    static auto line = CommandLine();
 
-    // Non-printable characters trigger Modbus RTU logic.
+    const auto frame = HostTransport->receive();
+    if (frame == nullptr)
+    {
+        return;
+    }
+
+    // Non-printable characters, or a whole RTU frame, trigger Modbus RTU logic.
     // Backspace prevents erroneous ASCII commands from running.
-    if (Serial.available() > 0)
+    const char c = frame->adu.rtu[0];
+    const auto isRtu = frame->length >= 4 && frame->adu.crcGood();
+    if (isRtu || (not isprint(c) && c != '\r' && c != '\n'))
     {
-        const char c = Serial.peek();
-        if (not isprint(c) && c != '\r' && c != '\n')
-        {
-            inData = "";
-            executeRtuGatewayLogic();
-            return;
-        }
+        line.clear();
+        executeRtuGatewayLogic();
+        return;
     }
 
-    //读取所有的数据
-    while (Serial.available() > 0)
+    // Copied out first, so commands which take a while do not hold up the transport.
+    std::array<char, sizeof(frame->adu.rtu)> data = {};
+    const auto length = std::min<size_t>(frame->length, data.size());
+    std::copy_n(frame->adu.rtu, length, data.begin());
+    HostTransport->release();
+
+    for (size_t i = 0; i < length; i++)
     {
-        const char recieved = Serial.read();
-        inData += recieved;
-        if (recieved == '\n')
+        if (not line.add(data[i]))
         {
-            inData.trim();
-            if (inData.length() > 0)
-            {
-                sendCmdByPort(inData);
-            }
-            inData = "";
-            break;
+            continue;
+        }
+        if (line.isOverflowed())
+        {
+            Serial.println("Command Too Long");
+        }
+        else if (not line.get().empty())
+        {
+            sendCmdByPort(line.get());
         }
     }
 }
@@ -144,7 +354,7 @@ void readCmd()
  * @param status The motor's status.
  * @param prefix Prefix error messages with this.
  */
-void reportError(const LinearMotorStatus &status, const String &prefix)
+void reportError(const LinearMotorStatus &status, const char* prefix)
 {
     if (not status.isError())
     {
@@ -152,287 +362,1649 @@ void reportError(const LinearMotorStatus &status, const String &prefix)
     }
     if (status.modbusError)
     {
-        Serial.println(prefix + "error: Communication Error");
+        Serial.print(prefix);
+        Serial.println("error: Communication Error");
         return;
     }
-    Serial.print(prefix + "error:");
+    Serial.print(prefix);
+    Serial.print("error:");
     printHex(status.errorCode);
 }
 
+/**
+ * @brief Print every field of the latest status snapshot.
+ * @param status The motor's status.
+ * @param prefix Prefix the output with this.
+ */
+void reportStatus(const LinearMotorStatus &status, const char* prefix)
+{
+    Serial.print(prefix);
+    Serial.print("status: error=");
+    Serial.print(status.errorCode, HEX);
+    Serial.print(" modbus=");
+    Serial.print(status.modbusError);
+    Serial.print(" fields=");
+    Serial.print(status.fieldError);
+    Serial.print(" statusword=");
+    Serial.print(status.statusword, HEX);
+    Serial.print(" position=");
+    Serial.print(status.position);
+    Serial.print(" velocity=");
+    Serial.print(status.velocity);
+    Serial.print(" torque=");
+    Serial.print(status.torque);
+    Serial.print(" current=");
+    Serial.print(status.current);
+    Serial.print(" voltage=");
+    Serial.print(status.dcLinkVoltage);
+    if (status.has(STATUS_FOLLOWING_ERROR))
+    {
+        Serial.print(" following_error=");
+        Serial.print(status.followingError);
+    }
+    Serial.println();
+}
+
+/**
+ * @brief Print round trip time statistics.
+ * @param rtt The motor's statistics.
+ * @param prefix Prefix the output with this.
+ */
+void reportRtt(const RttEstimator &rtt, const char* prefix)
+{
+    Serial.print(prefix);
+    Serial.print("rtt: mean=");
+    Serial.print(rtt.getMean());
+    Serial.print("us deviation=");
+    Serial.print(rtt.getDeviation());
+    Serial.print("us timeout=");
+    Serial.print(rtt.getTimeout());
+    Serial.print("ms timeouts=");
+    Serial.println(rtt.getTimeouts());
+}
+
+/**
+ * @brief Print a latency histogram's summary.
+ */
+void reportLatency(const LatencyHistogram &latency)
+{
+    Serial.print(" p50=");
+    Serial.print(latency.getPercentile(50));
+    Serial.print("us p99=");
+    Serial.print(latency.getPercentile(99));
+    Serial.print("us max=");
+    Serial.print(latency.getMax());
+    Serial.print("us");
+}
+
+/**
+ * @brief Print bus health counters.
+ * @param statistics The motor's statistics.
+ * @param prefix Prefix the output with this.
+ */
+void reportBusStatistics(const BusStatistics &statistics, const char* prefix)
+{
+    Serial.print(prefix);
+    Serial.print("stats: transactions=");
+    Serial.print(statistics.transactions.get());
+    Serial.print(" timeouts=");
+    Serial.print(statistics.timeouts.get());
+    Serial.print(" crc=");
+    Serial.print(statistics.crcErrors.get());
+    Serial.print(" frame=");
+    Serial.print(statistics.frameErrors.get());
+    Serial.print(" exceptions=");
+    Serial.print(statistics.exceptions.get());
+    reportLatency(statistics.latency);
+    Serial.println();
+}
+
+/**
+ * @brief Print how long each class of traffic waited for a motor bus.
+ * @param arbiter The bus' arbiter.
+ * @param prefix Prefix the output with this.
+ */
+void reportArbiterStatistics(const BusArbiter &arbiter, const char* prefix)
+{
+    static constexpr std::array<const char*, TRAFFIC_CLASSES> CLASS_NAMES = {"safety", "host", "config"};
+    for (size_t i = 0; i < TRAFFIC_CLASSES; i++)
+    {
+        const auto trafficClass = static_cast<TrafficClass>(i);
+        Serial.print(prefix);
+        Serial.print(CLASS_NAMES[i]);
+        Serial.print(" wait: count=");
+        Serial.print(arbiter.getWaitTime(trafficClass).getCount());
+        Serial.print(" deadline=");
+        Serial.print(arbiter.getDeadline(trafficClass));
+        Serial.print("us misses=");
+        Serial.print(arbiter.getDeadlineMisses(trafficClass).get());
+        reportLatency(arbiter.getWaitTime(trafficClass));
+        Serial.println();
+    }
+}
+
+/**
+ * @brief Print host side counters.
+ */
+void reportGatewayStatistics()
+{
+    Serial.print("Gateway stats: loops=");
+    Serial.print(gatewayStatistics.loops.get());
+    reportLatency(gatewayStatistics.loopTime);
+    Serial.print(" requests=");
+    Serial.print(gatewayStatistics.hostRequests.get());
+    Serial.print(" forwarded=");
+    Serial.print(gatewayStatistics.forwarded.get());
+    Serial.print(" cached=");
+    Serial.print(gatewayStatistics.cached.get());
+    reportLatency(gatewayStatistics.serviceTime);
+    Serial.println();
+}
+
+/**
+ * @brief Print emergency stop counters, and detection to pin latency.
+ */
+void reportFaultStatistics()
+{
+    Serial.print("Fault stats: trips=");
+    Serial.print(Supervisor->getTrips().get());
+    Serial.print(" deadline=");
+    Serial.print(Supervisor->getDeadline());
+    Serial.print("us misses=");
+    Serial.print(Supervisor->getDeadlineMisses().get());
+    Serial.print(" stale=");
+    Serial.print(Supervisor->getStaleAxes().get());
+    reportLatency(Supervisor->getLatency());
+    Serial.println();
+}
+
 /**
  * @brief Send a raw Modbus command to a motor, and display the response.
  * @details Commands are in the format "##1,2,3,4,5,6".
  *          The following retrieves X axis position: "##1,3,240,16,0,2"
- * @param cmds String of comma separated ints.  Preceded by two characters.
- * @param motor Motor to send the command to.
- * @param axisName Used to make output more readable to the user.
+ * @param args Comma separated bytes.
+ * @param axis Motor to send the command to.
  */
-void pureCMD(const String &cmds, LinearMotor &motor, const String &axisName)
+void pureCMD(CommandArgs &args, const Axis &axis)
 {
-    auto adu = ModbusADU();
-
-    const auto buffer_tx = cmds.substring(2, cmds.length());
-
-    int index = 0;
-    int startPos = 0;
-    int commaPos = buffer_tx.indexOf(',', startPos);
-    while (commaPos != -1)
+    auto request = axis.prepareRequest();
+    if (request == nullptr)
     {
-        adu.rtu[index++] = buffer_tx.substring(startPos, commaPos).toInt();
-        startPos = commaPos + 1;
-        commaPos = buffer_tx.indexOf(',', startPos);
+        return;
     }
-    // 处理最后一个数字（如果有）
-    //Last digit may not have a comma after it
-    if (startPos < buffer_tx.length())
+    request->command = RAW_ADU;
+    auto &adu = request->adu;
+
+    // Leave room for the CRC.
+    uint16_t index = 0;
+    long value = 0;
+    while (index < sizeof(adu.rtu) - 2 && args.next(value))
     {
-        adu.rtu[index++] = buffer_tx.substring(startPos).toInt();
+        adu.rtu[index++] = value;
     }
     adu.setLength(index);
     adu.updateCrc();
 
     printHexArray(adu.rtu, adu.getRtuLen());
-    motor.writeAdu(adu);
+    axis.worker->submitRequest();
 
-    const auto readStatus = motor.readAdu(adu);
-    if (readStatus)
-    {
-        adu.prepareExceptionResponse(GATEWAY_TARGET_DEVICE_FAILED_TO_RESPOND);
-    }
-    Serial.print(axisName + " axis value: ");
-    printHexArray(adu.data, adu.getDataLen());
+    auto &response = axis.worker->waitForResponse();
+    Serial.print(axis.label.data());
+    Serial.print("value: ");
+    printHexArray(response.adu.data, response.adu.getDataLen());
+    axis.worker->releaseResponse();
 }
 
-void sendCmdByPort(const String &cmd)
+
+/**
+ * @brief Print the value read by a motor command, or the error if it failed.
+ * @param axis Motor to run the command on.
+ * @param command A command which returns a value.
+ */
+void printMotorValue(const Axis &axis, const MotorCommand command)
 {
-    if(cmd.startsWith("DISABLE"))
+    const auto &response = axis.execute(command);
+    if (response.error)
     {
-        disableBothMotors();
+        Serial.println("Communication Error");
     }
-    else if(cmd.startsWith("VERSION"))
+    else
     {
-      Serial.println(VERSION);
+        Serial.println(response.value);
     }
-    else if(cmd.startsWith("##"))
+    axis.worker->releaseResponse();
+}
+
+/**
+ * @brief Run a command on every motor at the same time, and wait for all of them to finish.
+ * @details Buses work in parallel.  Drives sharing a bus take turns.
+ */
+void executeOnAllMotors(const MotorCommand command, const uint32_t value = 0)
+{
+    std::array<bool, AXIS_CONFIG.size()> submitted = {};
+    for (size_t i = 0; i < Axes.size(); i++)
     {
-       pureCMD(cmd, *XMotor,"X");
+        auto request = Axes[i].prepareRequest();
+        if (request == nullptr)
+        {
+            continue;
+        }
+        request->command = command;
+        request->value = value;
+        Axes[i].worker->submitRequest();
+        submitted[i] = true;
     }
-    else if(cmd.startsWith("@@"))
+
+    // Each worker answers in order, so wait in the same order.
+    for (size_t i = 0; i < Axes.size(); i++)
     {
-       pureCMD(cmd, *YMotor,"Y");
+        if (submitted[i])
+        {
+            Axes[i].worker->waitForResponse();
+            Axes[i].worker->releaseResponse();
+        }
     }
-    else if(cmd.startsWith("ENABLE"))
+}
+
+/**
+ * @brief Run a command which applies to a whole bus on every bus at the same time, and wait for all of them to finish.
+ */
+void executeOnAllBuses(const MotorCommand command, const uint32_t value = 0)
+{
+    std::array<bool, MOTOR_BUS_COUNT> submitted = {};
+    for (size_t i = 0; i < Workers.size(); i++)
     {
-        enableBothMotors();
+        auto request = Workers[i]->prepareRequest();
+        if (request == nullptr)
+        {
+            continue;
+        }
+        request->motor = 0;
+        request->command = command;
+        request->value = value;
+        Workers[i]->submitRequest();
+        submitted[i] = true;
     }
-    else if(cmd.startsWith("AUTO_GAIN_OFF"))
+    for (size_t i = 0; i < Workers.size(); i++)
     {
-        XMotor->setAutoGain(false);
-        YMotor->setAutoGain(false);
+        if (submitted[i])
+        {
+            Workers[i]->waitForResponse();
+            Workers[i]->releaseResponse();
+        }
     }
-    else if(cmd.startsWith("FILTER_OFF"))
+}
+
+/**
+ * @return true if any drive on a bus has an error.
+ */
+bool hasError(const MotorWorker* worker)
+{
+    return std::any_of(Axes.begin(), Axes.end(), [worker](const Axis &axis)
+    {
+        return axis.worker == worker && axis.status.isError();
+    });
+}
+
+/**
+ * @return The axis the gateway sends a unit id to, or nullptr if there is none.
+ */
+Axis* findRoute(const uint8_t unitId)
+{
+    if (unitId == 0)
     {
-        XMotor->setFilter1Off();
-        XMotor->setFilter2Off();
-        YMotor->setFilter1Off();
-        YMotor->setFilter2Off();
+        return nullptr;
     }
-    else if(cmd.startsWith("CURRENT_X:"))
+    const auto found = std::find_if(Axes.begin(), Axes.end(), [unitId](const Axis &axis)
+    {
+        return axis.unitId == unitId;
+    });
+    return found == Axes.end() ? nullptr : found;
+}
+
+/**
+ * @brief Change the gateway unit id an axis answers to.
+ * @param unitId 0 leaves the axis unrouted.
+ * @return false if the unit id is not allowed, or another axis has it.
+ */
+bool setRoute(Axis &axis, const long unitId)
+{
+    // 1 is this board.
+    if (unitId < 0 || unitId == 1 || unitId == FAN_OUT_UNIT || unitId > 247)
     {
-        const auto value = cmd.substring(10).toInt();
-        XMotor->setCurrentGain(value);
+        return false;
     }
-    else if(cmd.startsWith("CURRENT_Y:"))
+    const auto current = findRoute(unitId);
+    if (current != nullptr && current != &axis)
     {
-        const auto value = cmd.substring(10).toInt();
-        YMotor->setCurrentGain(value);
+        return false;
     }
-    else if(cmd.startsWith("INERDIA_X:"))
+    axis.unitId = unitId;
+    return true;
+}
+
+/**
+ * @brief Tell the user if a configuration change did not go as asked.
+ * @param error From `APPLY_CONFIG`.
+ */
+void reportCommit(const ModbusRTUMasterError error)
+{
+    if (error == MODBUS_RTU_MASTER_UNEXPECTED_VALUE)
     {
-        const auto value = cmd.substring(10).toInt();
-        XMotor->setInertia(value);
+        Serial.println("Value Not Kept");
     }
-    else if(cmd.startsWith("INERDIA_Y:"))
+    else if (error)
     {
-        const auto value = cmd.substring(10).toInt();
-        YMotor->setInertia(value);
+        Serial.println("Communication Error");
     }
-    else if(cmd.startsWith("GET_CURRENT_X"))
+}
+
+/**
+ * @brief Print whether each drive's latest save to flash finished.
+ */
+void reportFlashStates()
+{
+    constexpr std::array<const char*, 4> STATES = {"idle", "saving", "saved", "failed"};
+    for (const auto &axis : Axes)
     {
-        const auto response = XMotor->getCurrentGain();
-        if(std::holds_alternative<ModbusRTUMasterError>(response))
-        {
-            Serial.println("Communication Error");
-        } else
-        {
-            Serial.println(std::get<uint32_t>(response));
-        }
+        const auto state = axis.execute(GET_FLASH_STATE).value;
+        axis.worker->releaseResponse();
+        Serial.print(axis.label.data());
+        Serial.print("flash: ");
+        Serial.println(state < STATES.size() ? STATES[state] : "unknown");
     }
-    else if(cmd.startsWith("GET_CURRENT_Y"))
+}
+
+/**
+ * @brief Send the flight recorder's contents, a channel at a time, oldest first.
+ * @details A text line giving the record count and size, then each `FlightRecord` as raw bytes.
+ *          Sort by sequence number to interleave the channels again.
+ *          Records still being written when recording paused go out with a length of 0.
+ *          Recording pauses meanwhile, and a fault's freeze is kept.
+ * @param args Empty, or "CLEAR" to forget everything and start recording again.
+ */
+void sendRecording(CommandArgs &args)
+{
+    if (not args.empty())
     {
-        const auto response = YMotor->getCurrentGain();
-        if(std::holds_alternative<ModbusRTUMasterError>(response))
-        {
-            Serial.println("Communication Error");
-        } else
+        if (args.next() != "CLEAR")
         {
-            Serial.println(std::get<uint32_t>(response));
+            Serial.println("Unknown Command");
+            return;
         }
+        Recorder.clear();
+        Serial.println("Recording cleared");
+        return;
     }
-    else if(cmd.startsWith("GET_INERDIA_X"))
+
+    Recorder.pause();
+    const auto wasFrozen = Recorder.isFrozen();
+    uint32_t count = 0;
+    for (uint8_t channel = 0; channel < FlightRecorder::CHANNELS; channel++)
     {
-        const auto response = XMotor->getInertia();
-        if(std::holds_alternative<ModbusRTUMasterError>(response))
-        {
-            Serial.println("Communication Error");
-        } else
-        {
-            Serial.println(std::get<uint32_t>(response));
-        }
+        count += Recorder.getNext(channel) - Recorder.getOldest(channel);
     }
-    else if(cmd.startsWith("GET_INERDIA_Y"))
+    Serial.print("Recording: ");
+    Serial.print(count);
+    Serial.print(" records of ");
+    Serial.print(sizeof(FlightRecord));
+    Serial.println(wasFrozen ? " bytes, frozen" : " bytes");
+    for (uint8_t channel = 0; channel < FlightRecorder::CHANNELS; channel++)
     {
-        const auto response = YMotor->getInertia();
-        if(std::holds_alternative<ModbusRTUMasterError>(response))
+        const auto oldest = Recorder.getOldest(channel);
+        const auto next = Recorder.getNext(channel);
+        for (auto index = oldest; index != next; index++)
         {
-            Serial.println("Communication Error");
-        } else
-        {
-            Serial.println(std::get<uint32_t>(response));
+            auto record = FlightRecord();
+            if (not Recorder.read(channel, index, record))
+            {
+                record = FlightRecord();
+                record.channel = channel;
+            }
+            Serial.write(reinterpret_cast<const uint8_t*>(&record), sizeof(record));
         }
     }
-    else if(cmd.startsWith("RTU_GATEWAY"))
-    {
-        mode = RTU_GATEWAY;
-        XLed.setColor(OFF);
-        YLed.setColor(OFF);
-    }
-    else if(cmd.startsWith("RTU_MIXED"))
+    // A fault during the download freezes the recorder on its own, which this leaves alone.
+    Recorder.resume();
+}
+
+/**
+ * @brief Set a motor's current gain and inertia together, with a single disable, persist, and enable.
+ * @param args "current,inertia"
+ * @param axis Motor to tune.
+ */
+void applyTuning(CommandArgs &args, const Axis &axis)
+{
+    long current = 0;
+    long inertia = 0;
+    if (not args.next(current) || not args.next(inertia))
     {
-        mode = RTU_MIXED;
+        Serial.println("Unknown Command");
+        return;
     }
-    else
+    auto request = axis.prepareRequest();
+    if (request == nullptr)
     {
-        Serial.println("Unknown Command");
+        return;
     }
-}
-
-void disableBothMotors()
-{
-    XMotor->disable();
-    YMotor->disable();
-}
+    request->command = APPLY_CONFIG;
+    request->config.clear();
+    request->config.stage<MotionG::CurrentBandwidth>(current);
+    request->config.stage<MotionG::Inertia>(inertia);
+    axis.worker->submitRequest();
 
-void enableBothMotors()
-{
-    XMotor->enable();
-    YMotor->enable();
+    reportCommit(axis.worker->waitForResponse().error);
+    axis.worker->releaseResponse();
 }
 
-inline void setErrorState(const bool isError)
+/**
+ * @brief Get the motor named by the next argument, like "X" or "y".
+ * @return nullptr, after telling the user, if there is no such motor.
+ */
+Axis* nextAxis(CommandArgs &args)
 {
-    if (motorError == isError)
+    const auto name = args.next();
+    for (auto &axis : Axes)
     {
-        return;
+        const auto axisName = std::string_view(axis.name);
+        if (name.size() == axisName.size() && std::equal(name.begin(), name.end(), axisName.begin(), [](const char a, const char b)
+        {
+            return toupper(a) == toupper(b);
+        }))
+        {
+            return &axis;
+        }
     }
-    motorError = isError;
-    digitalWrite(EMERGE_STOP_PIN, !isError);
-}
-
-void setRTURegisters()
-{
-    holdingRegisters[0] = mode;
-    holdingRegisters[1] = XLed.getColor();
-    holdingRegisters[2] = YLed.getColor();
-    discreteInputs[0] = DisableButton.getState();
-    discreteInputs[1] = EnableButton.getState();
-    //motorError // Handled automatically
+    Serial.println("Unknown Axis");
+    return nullptr;
 }
 
-void updateFromRTURegisters()
+/**
+ * @brief Get the drive parameter named by the next argument.
+ * @return nullptr, after telling the user, if there is none by that name.
+ */
+const ParameterInfo* nextParameter(CommandArgs &args)
 {
-    mode = static_cast<OperatingMode>(holdingRegisters[0]);
-    XLed.setColor(static_cast<RGLedColor>(holdingRegisters[1]));
-    YLed.setColor(static_cast<RGLedColor>(holdingRegisters[2]));
+    const auto parameter = findParameter(args.next());
+    if (parameter == nullptr)
+    {
+        Serial.println("Unknown Parameter");
+    }
+    return parameter;
 }
 
 /**
- * @brief Forwards packets, while acting as a Modbus slave.
- * @warning This stops all automatic tasks, and relies on the host for all logic.
- * @details Acts as a Modbus slave with an id of 1.
- *          Routes Modbus packets with an id of 2 to X motor.
- *          Routes Modbus packets with an id of 3 to Y motor.
- *          <br/>
- *          Writing a 0 to id 1, holding register 0 exits this mode.
+ * @brief Print any parameter in params_info.csv.
+ * @details Configuration parameters come from the shadow cache when possible.
+ * @param args "axis name", like "X motor_rotor_inertia".
  */
-void executeRtuGatewayLogic()
+void getParameter(CommandArgs &args)
 {
-    auto adu = ModbusADU();
-    if (HostComm->readAdu(adu) != MODBUS_RTU_COMM_SUCCESS)
+    const auto axis = nextAxis(args);
+    if (axis == nullptr)
+    {
+        return;
+    }
+    const auto parameter = nextParameter(args);
+    if (parameter == nullptr)
     {
         return;
     }
 
-    switch (adu.getUnitId())
+    // Commands and set points change under the cache, so only configuration may be answered from it.
+    const auto command = parameter->configuration ? READ_CACHED_REGISTERS : READ_REGISTERS;
+    const auto &response = axis->execute(command, static_cast<uint32_t>(parameter->address) << 16 | parameter->length());
+    if (response.error)
+    {
+        Serial.println("Communication Error");
+    }
+    else
+    {
+        std::array<uint16_t, 2> registers = {};
+        if (parameter->length() == 2)
+        {
+            registers = {static_cast<uint16_t>(response.value >> 16), static_cast<uint16_t>(response.value & 0xFFFF)};
+        }
+        else
+        {
+            registers[0] = response.value & 0xFFFF;
+        }
+        std::array<char, 24> text = {};
+        parameter->format(parameter->decode(registers.data()), text.data(), text.size());
+        Serial.println(text.data());
+    }
+    axis->worker->releaseResponse();
+}
+
+/**
+ * @brief Change any configuration parameter in params_info.csv, within the limits it gives.
+ * @details Like `TUNE_X`, the motor is disabled, and the change is saved to flash.
+ *          Commands, set points, and the baud rate and node id are refused, as setting them could strand the drive.
+ * @param args "axis name value", like "X motor_rotor_inertia 120".
+ */
+void setParameter(CommandArgs &args)
+{
+    const auto axis = nextAxis(args);
+    if (axis == nullptr)
+    {
+        return;
+    }
+    const auto parameter = nextParameter(args);
+    if (parameter == nullptr)
+    {
+        return;
+    }
+    if (not parameter->writable())
+    {
+        Serial.println("Read Only Parameter");
+        return;
+    }
+    if (not parameter->configuration)
+    {
+        Serial.println("Not A Configuration Parameter");
+        return;
+    }
+    int64_t value = 0;
+    if (not parameter->parse(args.next(), value))
+    {
+        Serial.println("Invalid Value");
+        return;
+    }
+    if (not parameter->contains(value))
+    {
+        std::array<char, 24> lower = {};
+        std::array<char, 24> upper = {};
+        parameter->format(parameter->lower, lower.data(), lower.size());
+        parameter->format(parameter->upper, upper.data(), upper.size());
+        Serial.print("Out Of Range: ");
+        Serial.print(lower.data());
+        Serial.print(" to ");
+        Serial.println(upper.data());
+        return;
+    }
+
+    auto request = axis->prepareRequest();
+    if (request == nullptr)
+    {
+        return;
+    }
+    std::array<uint16_t, 2> registers = {};
+    parameter->encode(value, registers.data());
+    request->command = APPLY_CONFIG;
+    request->config.clear();
+    request->config.stage(parameter->address, parameter->length(), registers.data());
+    axis->worker->submitRequest();
+
+    reportCommit(axis->worker->waitForResponse().error);
+    axis->worker->releaseResponse();
+}
+
+/**
+ * @brief Get the next argument as an integer, clamped to a range.
+ * @return false, after telling the user, if the argument is missing or not an integer.
+ */
+bool nextValue(CommandArgs &args, long &value, const long lowest, const long highest)
+{
+    if (not args.next(value))
+    {
+        Serial.println("Unknown Command");
+        return false;
+    }
+    value = std::clamp(value, lowest, highest);
+    return true;
+}
+
+/**
+ * @brief Print which gateway unit id each axis answers to, or change one.
+ * @param args Nothing to print them all, or "axis unitId".  A unit id of 0 unroutes the axis.
+ */
+void routeAxis(CommandArgs &args)
+{
+    if (args.empty())
+    {
+        for (const auto &axis : Axes)
+        {
+            Serial.print(axis.label.data());
+            Serial.print("unit id: ");
+            Serial.println(axis.unitId);
+        }
+        return;
+    }
+    const auto axis = nextAxis(args);
+    long unitId = 0;
+    if (axis == nullptr || not args.next(unitId))
+    {
+        return;
+    }
+    if (not setRoute(*axis, unitId))
+    {
+        Serial.println("Unit Id Unavailable");
+    }
+}
+
+/**
+ * @brief Move a drive to its axis' node id, so it can share a bus.
+ * @details Only the drive being moved may answer at the old id, so connect them one at a time.
+ * @param args "axis fromId", like "Z 1".
+ */
+void adoptDrive(CommandArgs &args)
+{
+    const auto axis = nextAxis(args);
+    long fromId = 0;
+    if (axis == nullptr || not nextValue(args, fromId, 1, 247))
+    {
+        return;
+    }
+    const auto &response = axis->execute(ADOPT_DRIVE, fromId);
+    if (response.error)
+    {
+        Serial.println("Communication Error");
+    }
+    else
+    {
+        Serial.print(axis->label.data());
+        Serial.print("node id: ");
+        Serial.println(axis->motor->getId());
+    }
+    axis->worker->releaseResponse();
+}
+
+///@brief Working copy for the snapshot commands.  Too big for the stack.
+ParameterSnapshot Snapshot;
+constexpr auto SNAPSHOT_NAMESPACE = "snapshots";
+
+/**
+ * @brief Run a snapshot command on `Snapshot`, and wait for it.
+ * @details Must be followed by `releaseResponse()`.
+ */
+MotorResponse& executeSnapshot(const Axis &axis, const MotorCommand command, const uint32_t value = 0)
+{
+    auto request = axis.prepareRequest();
+    while (request == nullptr)
+    {
+        // Worker is still busy with earlier requests.
+        vTaskDelay(1);
+        request = axis.prepareRequest();
+    }
+    request->command = command;
+    request->value = value;
+    request->snapshot = &Snapshot;
+    axis.worker->submitRequest();
+    return axis.worker->waitForResponse();
+}
+
+/**
+ * @brief Load an axis' saved snapshot into `Snapshot`.
+ * @return false if there is none, or it was taken by firmware with a different register list.
+ */
+bool loadSnapshot(const Axis &axis)
+{
+    auto preferences = Preferences();
+    preferences.begin(SNAPSHOT_NAMESPACE, true);
+    const auto length = preferences.getBytes(axis.name, Snapshot.data(), Snapshot.size());
+    preferences.end();
+    return length == Snapshot.size() && Snapshot.isValid();
+}
+
+/**
+ * @brief Print each axis' fault capture state.
+ */
+void reportCaptureStates()
+{
+    constexpr std::array<const char*, 3> STATES = {"armed", "recording", "done"};
+    for (const auto &axis : Axes)
+    {
+        Serial.print(axis.label.data());
+        Serial.print("capture: ");
+        Serial.print(STATES[axis.capture.getState()]);
+        Serial.print(" window=");
+        Serial.println(axis.capture.getPostTrigger());
+    }
+}
+
+/**
+ * @brief Send an axis' fault capture, oldest first.
+ * @details A text line giving the sample count, size, and the index of the first sample with an error,
+ *          then each `CaptureSample` as raw bytes.
+ * @param args Empty for every axis' state.  "axis" to send its capture, or "axis CLEAR" to wait for the next fault.
+ */
+void sendCapture(CommandArgs &args)
+{
+    if (args.empty())
+    {
+        reportCaptureStates();
+        return;
+    }
+    auto axis = nextAxis(args);
+    if (axis == nullptr)
+    {
+        return;
+    }
+    auto &capture = axis->capture;
+    if (not args.empty())
+    {
+        if (args.next() != "CLEAR")
+        {
+            Serial.println("Unknown Command");
+            return;
+        }
+        Serial.print(axis->label.data());
+        Serial.println(capture.rearm() ? "capture: armed" : "capture: not done");
+        return;
+    }
+    if (capture.getState() != CAPTURE_DONE)
+    {
+        Serial.print(axis->label.data());
+        Serial.println("capture: not done");
+        return;
+    }
+
+    Serial.print("Capture: ");
+    Serial.print(capture.getCount());
+    Serial.print(" samples of ");
+    Serial.print(sizeof(CaptureSample));
+    Serial.print(" bytes, trigger at ");
+    Serial.println(capture.getTriggerIndex());
+    for (size_t i = 0; i < capture.getCount(); i++)
+    {
+        Serial.write(reinterpret_cast<const uint8_t*>(&capture.getSample(i)), sizeof(CaptureSample));
+    }
+}
+
+/**
+ * @brief Read every configuration register of a drive, and save them to flash.
+ * @details Replaces any earlier snapshot of the same axis.
+ * @param args "axis", like "X".
+ */
+void captureSnapshot(CommandArgs &args)
+{
+    const auto axis = nextAxis(args);
+    if (axis == nullptr)
+    {
+        return;
+    }
+    const auto start = millis();
+    const auto error = executeSnapshot(*axis, CAPTURE_PARAMETERS).error;
+    axis->worker->releaseResponse();
+    if (error)
+    {
+        Serial.println("Communication Error");
+        return;
+    }
+    const auto busTime = millis() - start;
+
+    auto preferences = Preferences();
+    preferences.begin(SNAPSHOT_NAMESPACE, false);
+    const auto saved = preferences.putBytes(axis->name, Snapshot.data(), Snapshot.size()) == Snapshot.size();
+    preferences.end();
+    if (not saved)
+    {
+        Serial.println("Storage Error");
+        return;
+    }
+    Serial.print(axis->label.data());
+    Serial.print("snapshot: registers=");
+    Serial.print(ParameterSnapshot::REGISTER_COUNT);
+    Serial.print(" time=");
+    Serial.print(busTime);
+    Serial.println("ms");
+}
+
+/**
+ * @brief Compare a drive with a saved snapshot, and optionally write back whatever differs.
+ * @param args "axis", or "axis source" to use another axis' snapshot, like "Y X".
+ * @param apply false to only count the differences.
+ */
+void restoreSnapshot(CommandArgs &args, const bool apply)
+{
+    const auto axis = nextAxis(args);
+    if (axis == nullptr)
+    {
+        return;
+    }
+    const auto source = args.empty() ? axis : nextAxis(args);
+    if (source == nullptr)
+    {
+        return;
+    }
+    if (not loadSnapshot(*source))
+    {
+        Serial.println("No Snapshot");
+        return;
+    }
+    const auto start = millis();
+    const auto &response = executeSnapshot(*axis, RESTORE_PARAMETERS, apply);
+    if (response.error)
+    {
+        Serial.println("Communication Error");
+    }
+    else
+    {
+        Serial.print(axis->label.data());
+        Serial.print(apply ? "restore: changed=" : "diff: differ=");
+        Serial.print(response.value);
+        Serial.print(" time=");
+        Serial.print(millis() - start);
+        Serial.println("ms");
+    }
+    axis->worker->releaseResponse();
+}
+
+/**
+ * @brief Every ASCII command, sorted by name.
+ * @details Names end at the first ':', ',', whitespace, or digit.  Everything after that is arguments.
+ */
+constexpr std::array<CommandEntry, 41> COMMANDS = {{
+    {"##", [](CommandArgs &args) { pureCMD(args, XAxis); }},
+    {"@@", [](CommandArgs &args) { pureCMD(args, YAxis); }},
+    {"AUTO_GAIN_OFF", [](CommandArgs &) { executeOnAllMotors(SET_AUTO_GAIN, false); }},
+    {"BAUD", [](CommandArgs &)
+    {
+        Serial.print("Host baud: ");
+        Serial.println(Host->getBaud());
+        for (size_t i = 0; i < MotorBuses.size(); i++)
+        {
+            Serial.print(BUS_LABELS[i]);
+            Serial.print("baud: ");
+            Serial.println(MotorBuses[i]->getBaud());
+        }
+    }},
+    {"CACHE_AGE", [](CommandArgs &args)
+    {
+        long age = 0;
+        if (nextValue(args, age, 0, UINT16_MAX))
+        {
+            gatewayCacheMaxAge = age;
+        }
+    }},
+    {"CAPTURE", sendCapture},
+    {"CAPTURE_WINDOW", [](CommandArgs &args)
+    {
+        // "CAPTURE_WINDOW:samples" after the trigger.
+        long window = 0;
+        if (nextValue(args, window, 0, FaultCapture::SAMPLES - 1))
+        {
+            for (auto &axis : Axes)
+            {
+                axis.capture.setPostTrigger(window);
+            }
+        }
+    }},
+    {"CURRENT_X", [](CommandArgs &args)
+    {
+        long value = 0;
+        if (nextValue(args, value, 0, LONG_MAX))
+        {
+            XAxis.execute(SET_CURRENT_GAIN, value);
+            XAxis.worker->releaseResponse();
+        }
+    }},
+    {"CURRENT_Y", [](CommandArgs &args)
+    {
+        long value = 0;
+        if (nextValue(args, value, 0, LONG_MAX))
+        {
+            YAxis.execute(SET_CURRENT_GAIN, value);
+            YAxis.worker->releaseResponse();
+        }
+    }},
+    {"DIFF", [](CommandArgs &args) { restoreSnapshot(args, false); }},
+    {"DISABLE", [](CommandArgs &) { disableAllMotors(); }},
+    {"ENABLE", [](CommandArgs &) { enableAndReport(); }},
+    {"FAULT_DEADLINE", [](CommandArgs &args)
+    {
+        long deadline = 0;
+        if (nextValue(args, deadline, 1, UINT16_MAX))
+        {
+            Supervisor->setDeadline(deadline);
+        }
+    }},
+    {"FILTER_OFF", [](CommandArgs &) { executeOnAllMotors(SET_FILTERS_OFF); }},
+    {"FLASH", [](CommandArgs &) { reportFlashStates(); }},
+    {"GET", getParameter},
+    {"GET_CURRENT_X", [](CommandArgs &) { printMotorValue(XAxis, GET_CURRENT_GAIN); }},
+    {"GET_CURRENT_Y", [](CommandArgs &) { printMotorValue(YAxis, GET_CURRENT_GAIN); }},
+    {"GET_INERDIA_X", [](CommandArgs &) { printMotorValue(XAxis, GET_INERTIA); }},
+    {"GET_INERDIA_Y", [](CommandArgs &) { printMotorValue(YAxis, GET_INERTIA); }},
+    {"HOST_BAUD", [](CommandArgs &args)
+    {
+        long baud = 0;
+        if (nextValue(args, baud, 0, LONG_MAX))
+        {
+            setHostBaud(baud);
+        }
+    }},
+    {"INERDIA_X", [](CommandArgs &args)
+    {
+        long value = 0;
+        if (nextValue(args, value, 0, LONG_MAX))
+        {
+            XAxis.execute(SET_INERTIA, value);
+            XAxis.worker->releaseResponse();
+        }
+    }},
+    {"INERDIA_Y", [](CommandArgs &args)
+    {
+        long value = 0;
+        if (nextValue(args, value, 0, LONG_MAX))
+        {
+            YAxis.execute(SET_INERTIA, value);
+            YAxis.worker->releaseResponse();
+        }
+    }},
+    {"MOTOR_BAUD", [](CommandArgs &args)
+    {
+        long baud = 0;
+        if (nextValue(args, baud, 0, LONG_MAX))
+        {
+            executeOnAllBuses(NEGOTIATE_BAUD, baud);
+        }
+    }},
+    {"NODE_ID", adoptDrive},
+    {"RECORDING", sendRecording},
+    {"RESTORE", [](CommandArgs &args) { restoreSnapshot(args, true); }},
+    {"ROUTE", routeAxis},
+    {"RTT", [](CommandArgs &)
+    {
+        for (size_t i = 0; i < MotorBuses.size(); i++)
+        {
+            reportRtt(MotorBuses[i]->getRttEstimator(), BUS_LABELS[i]);
+        }
+    }},
+    {"RTU_GATEWAY", [](CommandArgs &)
+    {
+        mode = RTU_GATEWAY;
+        XLed.setColor(OFF);
+        YLed.setColor(OFF);
+    }},
+    {"RTU_MIXED", [](CommandArgs &) { mode = RTU_MIXED; }},
+    {"SET", setParameter},
+    {"SNAPSHOT", captureSnapshot},
+    {"STATS", [](CommandArgs &)
+    {
+        for (size_t i = 0; i < MotorBuses.size(); i++)
+        {
+            reportBusStatistics(MotorBuses[i]->getStatistics(), BUS_LABELS[i]);
+            reportArbiterStatistics(Workers[i]->getArbiter(), BUS_LABELS[i]);
+        }
+        reportGatewayStatistics();
+        reportFaultStatistics();
+    }},
+    {"STATUS", [](CommandArgs &)
+    {
+        for (const auto &axis : Axes)
+        {
+            reportStatus(axis.status, axis.label.data());
+        }
+    }},
+    {"STOP", [](CommandArgs &) { mode = ASCII; }},
+    {"STREAM", [](CommandArgs &args)
+    {
+        // "STREAM" or "STREAM:rate" in samples per second.
+        long rate = streamRate;
+        if (not args.empty() && not nextValue(args, rate, 1, 1000))
+        {
+            return;
+        }
+        streamRate = rate;
+        mode = STREAMING;
+    }},
+    {"TIMEOUT_LIMITS", [](CommandArgs &args)
+    {
+        // "TIMEOUT_LIMITS:floor,ceiling" in milliseconds.
+        long floor = 0;
+        long ceiling = 0;
+        if (nextValue(args, floor, 0, UINT16_MAX) && nextValue(args, ceiling, 0, UINT16_MAX))
+        {
+            executeOnAllBuses(SET_TIMEOUT_LIMITS, floor << 16 | ceiling);
+        }
+    }},
+    {"TUNE_X", [](CommandArgs &args) { applyTuning(args, XAxis); }},
+    {"TUNE_Y", [](CommandArgs &args) { applyTuning(args, YAxis); }},
+    {"VERSION", [](CommandArgs &) { Serial.println(VERSION); }},
+}};
+static_assert(isSorted(COMMANDS), "Commands must be sorted by name, with no duplicates");
+
+void sendCmdByPort(const std::string_view cmd)
+{
+    auto args = CommandArgs(cmd);
+    const auto command = findCommand(COMMANDS, args.getName());
+    if (command == nullptr)
+    {
+        Serial.println("Unknown Command");
+        return;
+    }
+    command->handler(args);
+}
+
+void disableAllMotors()
+{
+    executeOnAllMotors(DISABLE_MOTOR);
+}
+
+/**
+ * @brief Bring every motor to Operation Enabled, clearing any faults.
+ * @details Buses work in parallel.  Drives sharing a bus take turns, one state transition at a time.
+ * @return Bit `i` set if `Axes[i]` got there.
+ */
+uint32_t enableAllMotors()
+{
+    std::array<bool, MOTOR_BUS_COUNT> submitted = {};
+    std::array<uint32_t, MOTOR_BUS_COUNT> enabled = {};
+    for (size_t i = 0; i < Workers.size(); i++)
+    {
+        auto request = Workers[i]->prepareRequest();
+        if (request == nullptr)
+        {
+            continue;
+        }
+        request->motor = 0;
+        request->command = ENABLE_ALL_MOTORS;
+        Workers[i]->submitRequest();
+        submitted[i] = true;
+    }
+    for (size_t i = 0; i < Workers.size(); i++)
+    {
+        if (submitted[i])
+        {
+            enabled[i] = Workers[i]->waitForResponse().value;
+            Workers[i]->releaseResponse();
+        }
+    }
+
+    uint32_t axes = 0;
+    for (size_t i = 0; i < Axes.size(); i++)
+    {
+        if (enabled[AXIS_CONFIG[i].bus] & 1 << Axes[i].slot)
+        {
+            axes |= 1 << i;
+        }
+    }
+    return axes;
+}
+
+/**
+ * @brief Enable every motor, and say which ones made it.
+ */
+void enableAndReport()
+{
+    const auto start = millis();
+    const auto enabled = enableAllMotors();
+    const auto elapsed = millis() - start;
+    for (size_t i = 0; i < Axes.size(); i++)
+    {
+        Serial.print(Axes[i].label.data());
+        Serial.println(enabled & 1 << i ? "enabled" : "enable failed");
+    }
+    Serial.print("time=");
+    Serial.print(elapsed);
+    Serial.println("ms");
+}
+
+/**
+ * @brief Publish round trip time statistics as four input registers.
+ * @param registers Mean (us), deviation (us), timeout (ms), timeout count.  Saturating.
+ */
+void setRttRegisters(uint16_t* registers, const RttEstimator &rtt)
+{
+    registers[0] = std::min<uint32_t>(rtt.getMean(), UINT16_MAX);
+    registers[1] = std::min<uint32_t>(rtt.getDeviation(), UINT16_MAX);
+    registers[2] = std::min<uint32_t>(rtt.getTimeout(), UINT16_MAX);
+    registers[3] = std::min<uint32_t>(rtt.getTimeouts(), UINT16_MAX);
+}
+
+/**
+ * @brief Publish a 32 bit value as two input registers, high word first.
+ */
+void setRegisterPair(uint16_t* registers, const uint32_t value)
+{
+    registers[0] = value >> 16;
+    registers[1] = value & 0xFFFF;
+}
+
+/**
+ * @brief Publish a latency histogram as three input registers.
+ * @param registers p50, p99, and max (us).  Saturating.
+ */
+void setLatencyRegisters(uint16_t* registers, const LatencyHistogram &latency)
+{
+    registers[0] = std::min<uint32_t>(latency.getPercentile(50), UINT16_MAX);
+    registers[1] = std::min<uint32_t>(latency.getPercentile(99), UINT16_MAX);
+    registers[2] = std::min<uint32_t>(latency.getMax(), UINT16_MAX);
+}
+
+/**
+ * @brief Publish bus health as thirteen input registers.
+ * @param registers Transactions, timeouts, CRC errors, frame errors, and exceptions as 32 bit pairs, then latency.
+ */
+void setBusRegisters(uint16_t* registers, const BusStatistics &statistics)
+{
+    setRegisterPair(&registers[0], statistics.transactions.get());
+    setRegisterPair(&registers[2], statistics.timeouts.get());
+    setRegisterPair(&registers[4], statistics.crcErrors.get());
+    setRegisterPair(&registers[6], statistics.frameErrors.get());
+    setRegisterPair(&registers[8], statistics.exceptions.get());
+    setLatencyRegisters(&registers[10], statistics.latency);
+}
+
+/**
+ * @brief Publish bus arbitration statistics as fifteen input registers.
+ * @param registers Wait time p50, p99, and max, then deadline misses as a 32 bit pair.  Safety, host, then config traffic.
+ */
+void setArbiterRegisters(uint16_t* registers, const BusArbiter &arbiter)
+{
+    for (size_t i = 0; i < TRAFFIC_CLASSES; i++)
+    {
+        const auto trafficClass = static_cast<TrafficClass>(i);
+        setLatencyRegisters(&registers[i * 5], arbiter.getWaitTime(trafficClass));
+        setRegisterPair(&registers[i * 5 + 3], arbiter.getDeadlineMisses(trafficClass).get());
+    }
+}
+
+/**
+ * @brief Publish host side statistics as thirteen input registers.
+ * @param registers Loops, loop time, host requests, forwarded, cached, then service time p50 and p99.
+ */
+void setGatewayRegisters(uint16_t* registers)
+{
+    setRegisterPair(&registers[0], gatewayStatistics.loops.get());
+    setLatencyRegisters(&registers[2], gatewayStatistics.loopTime);
+    setRegisterPair(&registers[5], gatewayStatistics.hostRequests.get());
+    setRegisterPair(&registers[7], gatewayStatistics.forwarded.get());
+    setRegisterPair(&registers[9], gatewayStatistics.cached.get());
+    registers[11] = std::min<uint32_t>(gatewayStatistics.serviceTime.getPercentile(50), UINT16_MAX);
+    registers[12] = std::min<uint32_t>(gatewayStatistics.serviceTime.getPercentile(99), UINT16_MAX);
+}
+
+/**
+ * @brief Publish emergency stop statistics as seven input registers.
+ * @param registers Detection to pin latency, then deadline misses and trips as 32 bit pairs.
+ */
+void setFaultRegisters(uint16_t* registers)
+{
+    setLatencyRegisters(&registers[0], Supervisor->getLatency());
+    setRegisterPair(&registers[3], Supervisor->getDeadlineMisses().get());
+    setRegisterPair(&registers[5], Supervisor->getTrips().get());
+}
+
+void setRTURegisters()
+{
+    holdingRegisters[0] = mode;
+    holdingRegisters[1] = XLed.getColor();
+    holdingRegisters[2] = YLed.getColor();
+    holdingRegisters[3] = gatewayCacheMaxAge;
+    holdingRegisters[4] = streamRate;
+    setRegisterPair(&holdingRegisters[HOST_BAUD_REGISTER], Host->getBaud());
+    holdingRegisters[7] = Host->getState();
+    holdingRegisters[8] = std::min<uint32_t>(Supervisor->getDeadline(), UINT16_MAX);
+    for (size_t i = 0; i < Axes.size(); i++)
+    {
+        holdingRegisters[ROUTE_REGISTER + i] = Axes[i].unitId;
+    }
+    discreteInputs[0] = DisableButton.getState();
+    discreteInputs[1] = EnableButton.getState();
+    setRttRegisters(&inputRegisters[0], MotorBuses[0]->getRttEstimator());
+    setRttRegisters(&inputRegisters[4], MotorBuses[1]->getRttEstimator());
+    setBusRegisters(&inputRegisters[8], MotorBuses[0]->getStatistics());
+    setBusRegisters(&inputRegisters[21], MotorBuses[1]->getStatistics());
+    setGatewayRegisters(&inputRegisters[34]);
+    setFaultRegisters(&inputRegisters[47]);
+    setArbiterRegisters(&inputRegisters[54], Workers[0]->getArbiter());
+    setArbiterRegisters(&inputRegisters[69], Workers[1]->getArbiter());
+    inputRegisters[84] = fanOutFailures;
+    setRegisterPair(&inputRegisters[85], Supervisor->getStaleAxes().get());
+}
+
+/**
+ * @return true if `adu` is a request to write `address`.
+ */
+bool writesHoldingRegister(ModbusADU &adu, const uint16_t address)
+{
+    switch (adu.getFunctionCode())
+    {
+    case 0x06:
+        return adu.getDataRegister(0) == address;
+    case 0x10:
+        return address >= adu.getDataRegister(0) && address - adu.getDataRegister(0) < adu.getDataRegister(1);
+    default:
+        return false;
+    }
+}
+
+void updateFromRTURegisters()
+{
+    mode = static_cast<OperatingMode>(holdingRegisters[0]);
+    XLed.setColor(static_cast<RGLedColor>(holdingRegisters[1]));
+    YLed.setColor(static_cast<RGLedColor>(holdingRegisters[2]));
+    gatewayCacheMaxAge = holdingRegisters[3];
+    streamRate = std::clamp<uint16_t>(holdingRegisters[4], 1, 1000);
+    Supervisor->setDeadline(holdingRegisters[8]);
+    for (size_t i = 0; i < Axes.size(); i++)
+    {
+        // Clashing or reserved ids are refused, and read back as the old value.
+        setRoute(Axes[i], holdingRegisters[ROUTE_REGISTER + i]);
+    }
+}
+
+/**
+ * @brief Forward an ADU to a motor through its worker, and wait for the response.
+ * @param axis Motor to forward to.
+ * @param adu To forward.  Will be changed to the response message.
+ */
+void forwardToMotor(const Axis &axis, ModbusADU &adu)
+{
+    auto request = axis.prepareRequest();
+    if (request == nullptr)
     {
-    case 1:
-        setRTURegisters();
-        RTUSlaveLogic.processPdu(adu);
-        updateFromRTURegisters();
-        break;
-    case 2:
-        XMotor->forwardAdu(adu);
-        break;
-    case 3:
-        YMotor->forwardAdu(adu);
-        break;
-    default:
         adu.prepareExceptionResponse(GATEWAY_PATH_UNAVAILABLE);
-        YLed.setColor(RED);
+        return;
+    }
+    request->command = FORWARD_ADU;
+    copyAdu(request->adu, adu);
+    axis.worker->submitRequest();
+    copyAdu(adu, axis.worker->waitForResponse().adu);
+    axis.worker->releaseResponse();
+}
+
+/**
+ * @brief Forward a write to every routed axis at once, and merge the responses.
+ * @details Every worker gets its request before any is waited on, so drives on different buses are written in parallel.
+ *          Only writes are accepted, as their responses match whenever they succeed.
+ *          If any axis fails, the first failure is sent instead, and `fanOutFailures` says which axes failed.
+ * @param adu Request.  Changed to the response.
+ */
+void forwardToAllMotors(ModbusADU &adu)
+{
+    switch (adu.getFunctionCode())
+    {
+    case 0x05:
+    case 0x06:
+    case 0x0F:
+    case 0x10:
         break;
+    default:
+        adu.prepareExceptionResponse(ILLEGAL_FUNCTION);
+        return;
+    }
+
+    std::array<bool, AXIS_CONFIG.size()> submitted = {};
+    for (size_t i = 0; i < Axes.size(); i++)
+    {
+        if (Axes[i].unitId == 0)
+        {
+            continue;
+        }
+        auto request = Axes[i].prepareRequest();
+        if (request == nullptr)
+        {
+            continue;
+        }
+        request->command = FORWARD_ADU;
+        copyAdu(request->adu, adu);
+        Axes[i].worker->submitRequest();
+        submitted[i] = true;
+    }
+
+    // Drives on the same bus answer in the order they were asked, so waiting in that order never blocks on a later one.
+    uint16_t failures = 0;
+    auto answered = false;
+    for (size_t i = 0; i < Axes.size(); i++)
+    {
+        if (Axes[i].unitId == 0)
+        {
+            continue;
+        }
+        if (not submitted[i])
+        {
+            if (failures == 0)
+            {
+                adu.prepareExceptionResponse(GATEWAY_PATH_UNAVAILABLE);
+            }
+            failures |= 1 << i;
+            answered = true;
+            continue;
+        }
+        auto &response = Axes[i].worker->waitForResponse().adu;
+        const auto failed = response.getFunctionCode() >= 0x80;
+        if ((failed && failures == 0) || not answered)
+        {
+            copyAdu(adu, response);
+        }
+        Axes[i].worker->releaseResponse();
+        failures |= failed << i;
+        answered = true;
     }
-    HostComm->writeAdu(adu);
+    if (not answered)
+    {
+        adu.prepareExceptionResponse(GATEWAY_PATH_UNAVAILABLE);
+    }
+    fanOutFailures = failures;
+}
+
+/**
+ * @brief Answer a host read from the latest background status poll, instead of the motor.
+ * @details Only "Read Holding Registers" requests entirely covered by a fresh enough snapshot are answered.
+ * @param status Latest status of the motor the request is for.
+ * @param adu Request.  Changed to the response on success.
+ * @return true if `adu` is now the response.
+ */
+bool readFromStatus(const LinearMotorStatus &status, ModbusADU &adu)
+{
+    if (gatewayCacheMaxAge == 0 || adu.getFunctionCode() != 0x03 || adu.getDataLen() != 4)
+    {
+        return false;
+    }
+    if (micros() - status.timestamp > gatewayCacheMaxAge * 1000UL)
+    {
+        return false;
+    }
+    const auto address = adu.getDataRegister(0);
+    const auto quantity = adu.getDataRegister(1);
+    if (quantity == 0 || quantity > MAX_READ_REGISTERS)
+    {
+        return false;
+    }
+
+    std::array<uint16_t, MAX_READ_REGISTERS> registers = {};
+    if (not status.getRegisters(address, quantity, registers.data()))
+    {
+        return false;
+    }
+    prepareReadHoldingRegistersResponse(adu, registers.data(), quantity);
+    return true;
+}
+
+///@brief Registers per axis in an aggregate reply.
+constexpr size_t AGGREGATE_AXIS_REGISTERS = 16;
+///@brief Registers before the axes in an aggregate reply: time, buttons, then every holding register.
+constexpr size_t AGGREGATE_HEADER_REGISTERS = 3 + std::tuple_size_v<decltype(holdingRegisters)>;
+constexpr size_t AGGREGATE_REGISTERS = AGGREGATE_HEADER_REGISTERS + AGGREGATE_AXIS_REGISTERS * AXIS_CONFIG.size();
+// Unit id, function code, byte count, and CRC around the registers.
+static_assert(AGGREGATE_REGISTERS * 2 + 5 <= MODBUS_RTU_MAX_ADU_SIZE, "Aggregate reply must fit one frame, so fewer axes");
+
+/**
+ * @brief Publish a status snapshot as sixteen registers.
+ * @param registers Fields read, Modbus error, "Error_code", "Statusword", then "Position_actual_value", "Velocity_actual_value",
+ *                  "Torque_actual_value", "Current_actual_value", "DC_link_circuit_voltage", "Following_error_actual_value",
+ *                  and when it was read (us).  32 bit values are high word first.
+ */
+void setStatusRegisters(uint16_t* registers, const LinearMotorStatus &status)
+{
+    registers[0] = status.fields;
+    registers[1] = status.modbusError;
+    registers[2] = status.errorCode;
+    registers[3] = status.statusword;
+    setRegisterPair(&registers[4], status.position);
+    setRegisterPair(&registers[6], status.velocity);
+    registers[8] = status.torque;
+    registers[9] = status.current;
+    setRegisterPair(&registers[10], status.dcLinkVoltage);
+    setRegisterPair(&registers[12], status.followingError);
+    setRegisterPair(&registers[14], status.timestamp);
+}
+
+/**
+ * @brief Answer `AGGREGATE_FUNCTION` from what the controller already has, without touching a motor bus.
+ * @details Laid out like a "Read Holding Registers" response: a byte count, then registers.
+ *          The time now (us), the buttons (bit 0: disable, bit 1: enable), then every holding register.
+ *          Each axis' latest status follows, in `AXIS_CONFIG` order, as `setStatusRegisters()` lays it out.
+ * @param adu Request.  Changed to the response.
+ */
+void prepareAggregateResponse(ModbusADU &adu)
+{
+    setRTURegisters();
+    std::array<uint16_t, AGGREGATE_REGISTERS> registers = {};
+    setRegisterPair(&registers[0], micros());
+    registers[2] = discreteInputs[0] | discreteInputs[1] << 1;
+    std::copy(holdingRegisters.begin(), holdingRegisters.end(), &registers[3]);
+    for (size_t i = 0; i < Axes.size(); i++)
+    {
+        setStatusRegisters(&registers[AGGREGATE_HEADER_REGISTERS + i * AGGREGATE_AXIS_REGISTERS], Axes[i].status);
+    }
+    prepareReadHoldingRegistersResponse(adu, registers.data(), registers.size());
+}
+
+/**
+ * @brief Forwards packets, while acting as a Modbus slave.
+ * @warning This stops all automatic tasks, and relies on the host for all logic.
+ * @details Acts as a Modbus slave with an id of 1.
+ *          Routes every other id through the routing table.  By default, 2 is the X motor, and 3 the Y motor.
+ *          `FAN_OUT_UNIT` writes to every routed motor at once.
+ *          <br/>
+ *          Writing a 0 to id 1, holding register 0 exits this mode.
+ */
+void executeRtuGatewayLogic()
+{
+    const auto frame = HostTransport->receive();
+    if (frame == nullptr)
+    {
+        return;
+    }
+    // Handled in place, and the response goes back out from the same slot.
+    auto &adu = frame->adu;
+    if (frame->length < 4 || not adu.crcGood())
+    {
+        HostTransport->release();
+        return;
+    }
+    const auto start = cycleCount();
+    gatewayStatistics.hostRequests.increment();
+
+    switch (adu.getUnitId())
+    {
+    case 1:
+    {
+        if (adu.getFunctionCode() == AGGREGATE_FUNCTION)
+        {
+            gatewayStatistics.cached.increment();
+            prepareAggregateResponse(adu);
+            break;
+        }
+        // Rewriting the current rate confirms it, so the write itself matters, not the value changing.
+        const auto baudWritten = writesHoldingRegister(adu, HOST_BAUD_REGISTER + 1);
+        setRTURegisters();
+        const auto previous = holdingRegisters;
+        RTUSlaveLogic.processPdu(adu);
+        const auto baud = static_cast<uint32_t>(holdingRegisters[HOST_BAUD_REGISTER]) << 16 | holdingRegisters[HOST_BAUD_REGISTER + 1];
+        if (baudWritten && adu.getFunctionCode() < 0x80 && not HostLink::isSupported(baud))
+        {
+            // The whole write is refused, so nothing else in it takes effect either.
+            holdingRegisters = previous;
+            adu.prepareExceptionResponse(ILLEGAL_DATA_VALUE);
+            break;
+        }
+        updateFromRTURegisters();
+        if (baudWritten && adu.getFunctionCode() < 0x80)
+        {
+            Host->request(baud);
+        }
+        break;
+    }
+    case FAN_OUT_UNIT:
+        gatewayStatistics.forwarded.increment();
+        forwardToAllMotors(adu);
+        break;
+    default:
+    {
+        const auto axis = findRoute(adu.getUnitId());
+        if (axis == nullptr)
+        {
+            adu.prepareExceptionResponse(GATEWAY_PATH_UNAVAILABLE);
+            YLed.setColor(RED);
+        }
+        else if (readFromStatus(axis->status, adu))
+        {
+            gatewayStatistics.cached.increment();
+        }
+        else
+        {
+            gatewayStatistics.forwarded.increment();
+            forwardToMotor(*axis, adu);
+        }
+        break;
+    }
+    }
+    HostTransport->send(adu);
+    HostTransport->release();
+    gatewayStatistics.serviceTime.add(microsSince(start));
+}
+
+/**
+ * @brief Sample X and Y together at `streamRate`, and send each sample as a binary frame.
+ * @param newX A new X status arrived.
+ * @param newY A new Y status arrived.
+ */
+void streamTelemetry(const bool newX, const bool newY)
+{
+    const auto now = micros();
+    const auto period = 1000000UL / streamRate;
+    if (telemetry.active)
+    {
+        // Polls started before the trigger are too old.
+        telemetry.xDone |= newX && static_cast<long>(XAxis.status.timestamp - telemetry.sample.time) >= 0;
+        telemetry.yDone |= newY && static_cast<long>(YAxis.status.timestamp - telemetry.sample.time) >= 0;
+
+        // A sample taking several periods has stalled, so send what there is.
+        const auto stalled = now - telemetry.sample.time > period * 4;
+        if (not (telemetry.xDone && telemetry.yDone) && not stalled)
+        {
+            return;
+        }
+        telemetry.sample.setAxis(0, XAxis.status);
+        telemetry.sample.axes[0].valid &= telemetry.xDone;
+        telemetry.sample.setAxis(1, YAxis.status);
+        telemetry.sample.axes[1].valid &= telemetry.yDone;
+
+        std::array<uint8_t, TelemetryEncoder::MAX_FRAME_SIZE> frame = {};
+        Serial.write(frame.data(), telemetryEncoder.encode(telemetry.sample, frame.data()));
+        telemetry.active = false;
+    }
+
+    if (static_cast<long>(now - telemetry.nextAt) < 0)
+    {
+        return;
+    }
+    // Keep to the schedule, unless too far behind to catch up.
+    telemetry.nextAt = now - telemetry.nextAt > period ? now + period : telemetry.nextAt + period;
+    telemetry.sample.time = now;
+    telemetry.active = true;
+    telemetry.xDone = false;
+    telemetry.yDone = false;
+    XAxis.worker->triggerPoll(XAxis.slot);
+    YAxis.worker->triggerPoll(YAxis.slot);
 }
 
 void setup()
 {
-    HostComm = new ModbusRTUComm(Serial);
-    Serial.begin(MODBUS_BAUD);
-    HostComm->begin(MODBUS_BAUD, SERIAL_8N1);
+    // USB delivers host data in packets, which may split a request.
+    HostTransport = new RtuTransport(Serial, true);
+    HostTransport->setRecorder(&Recorder, RECORDER_HOST_CHANNEL);
+    Host = new HostLink(Serial, *HostTransport);
+    Host->begin();
     RTUSlaveLogic.configureHoldingRegisters(holdingRegisters.data(), holdingRegisters.size());
     RTUSlaveLogic.configureDiscreteInputs(discreteInputs.data(), discreteInputs.size());
+    RTUSlaveLogic.configureInputRegisters(inputRegisters.data(), inputRegisters.size());
 
-    XMotor = new LinearMotor(XMotorSerial, 1);
-    XMotor->begin(MODBUS_BAUD, SERIAL_8N1, 22, 23);
+    MotorBuses[0] = new MotorBus(MotorSerial0);
+    MotorBuses[0]->setRecorder(&Recorder, RECORDER_HOST_CHANNEL + 1);
+    MotorBuses[0]->begin(MODBUS_BAUD, SERIAL_8N1, 22, 23);
 
-    YMotor = new LinearMotor(YMotorSerial, 1);
-    YMotor->begin(MODBUS_BAUD, SERIAL_8N1, 16, 17);
+    MotorBuses[1] = new MotorBus(MotorSerial1);
+    MotorBuses[1]->setRecorder(&Recorder, RECORDER_HOST_CHANNEL + 2);
+    MotorBuses[1]->begin(MODBUS_BAUD, SERIAL_8N1, 16, 17);
 
-    EnableButton.begin(enableBothMotors);
-    DisableButton.begin(disableBothMotors);
+    // Faults go from the workers straight to the pin, without waiting on loop().
+    Supervisor = new FaultSupervisor(EMERGE_STOP_PIN);
+    // Keeps the frames which led up to the fault, until the host clears them.
+    Supervisor->setTripListener([] { Recorder.freeze(); });
+    Supervisor->begin(MOTOR_WORKER_CORE, FAULT_SUPERVISOR_PRIORITY);
+
+    for (size_t i = 0; i < Workers.size(); i++)
+    {
+        Workers[i] = new MotorWorker(*MotorBuses[i]);
+    }
+    for (size_t i = 0; i < Axes.size(); i++)
+    {
+        const auto &config = AXIS_CONFIG[i];
+        auto &axis = Axes[i];
+        axis.name = config.name;
+        axis.unitId = config.unitId;
+        snprintf(axis.label.data(), axis.label.size(), "%s axis ", config.name);
+        axis.motor = new LinearMotor(*MotorBuses[config.bus], config.nodeId);
+        axis.worker = Workers[config.bus];
+        axis.slot = axis.worker->addMotor(*axis.motor);
+        axis.worker->setErrorListener(axis.slot, [i](const LinearMotorStatus& status)
+        {
+            Supervisor->report(i, status);
+        });
+        Supervisor->watch(i);
+        axis.worker->setSampleListener(axis.slot, [i](const LinearMotorStatus& status)
+        {
+            Axes[i].capture.add(status);
+        });
+    }
+
+    // Both buses on the core loop() does not use, so host and UI handling is never starved.
+    Workers[0]->begin("MotorBus0", MOTOR_WORKER_CORE);
+    Workers[1]->begin("MotorBus1", MOTOR_WORKER_CORE);
+
+    // Less wire time per frame means lower latency for both polling and the gateway.
+    executeOnAllBuses(NEGOTIATE_BAUD, MOTOR_MAX_BAUD);
+
+    EnableButton.begin(enableAllMotors);
+    DisableButton.begin(disableAllMotors);
 
     XLed.begin();
     YLed.begin();
 
-    pinMode(EMERGE_STOP_PIN, OUTPUT);
-    setErrorState(false);
-
     Serial.print("System inited, Version: magx-eslm-");
     Serial.println(VERSION);
 }
 
 void loop()
 {
-    auto xStatus = LinearMotorStatus();
-    auto yStatus = LinearMotorStatus();
-    if (mode == ASCII || mode == RTU_MIXED)
+    // Blocking commands can hold a pass up for longer than the cycle counter lasts, so timed in microseconds.
+    static auto loopStart = micros();
+    gatewayStatistics.loopTime.add(micros() - loopStart);
+    gatewayStatistics.loops.increment();
+    loopStart = micros();
+
+    // Streaming samples on its own schedule, so X and Y are read at the same moment.
+    const auto streaming = mode == STREAMING;
+    const auto polling = mode == ASCII || mode == RTU_MIXED;
+    // The gateway leaves the pin alone, as the host handles errors itself.
+    Supervisor->setEnabled(polling || streaming);
+    // Streaming only polls once per sample, so a slow stream must not look like a stuck bus.
+    const auto sampleTime = streaming ? 2000 / streamRate : 0;
+    Supervisor->setStaleTimeout(std::max<uint32_t>(FaultSupervisor::DEFAULT_STALE_TIMEOUT, sampleTime));
+    const auto statusFields = streaming ? TELEMETRY_STATUS_FIELDS : static_cast<uint16_t>(STATUS_DEFAULT);
+    for (const auto worker : Workers)
+    {
+        worker->setPolling(polling);
+        worker->setStatusFields(statusFields);
+        // Fault captures need a few more fields, read whenever the bus is otherwise idle.
+        worker->setSampleFields(CAPTURE_STATUS_FIELDS);
+    }
+    static auto wasStreaming = false;
+    if (streaming && not wasStreaming)
     {
-        xStatus = XMotor->getStatus();
-        yStatus = YMotor->getStatus();
+        telemetryEncoder.reset();
+        telemetry.active = false;
+        telemetry.nextAt = micros();
+    }
+    wasStreaming = streaming;
 
-        setErrorState(xStatus.isError() || yStatus.isError());
-        XLed.setColor(xStatus.isError() ? RED : GREEN );
-        YLed.setColor(yStatus.isError() ? RED : GREEN );
+    // Only report errors once per poll, not once per loop.
+    std::array<bool, AXIS_CONFIG.size()> newStatus = {};
+    for (size_t i = 0; i < Axes.size(); i++)
+    {
+        newStatus[i] = Axes[i].worker->getStatus(Axes[i].slot, Axes[i].status);
+    }
+
+    if (polling || streaming)
+    {
+        XLed.setColor(hasError(Workers[0]) ? RED : GREEN );
+        YLed.setColor(hasError(Workers[1]) ? RED : GREEN );
 
         EnableButton.update();
         DisableButton.update();
@@ -440,8 +2012,19 @@ void loop()
 
     if (mode == ASCII)
     {
-        reportError(xStatus, "X axis ");
-        reportError(yStatus, "Y axis ");
+        for (size_t i = 0; i < Axes.size(); i++)
+        {
+            if (newStatus[i])
+            {
+                reportError(Axes[i].status, Axes[i].label.data());
+            }
+        }
+        readCmd();
+    }
+
+    if (streaming)
+    {
+        streamTelemetry(newStatus[0], newStatus[1]);
         readCmd();
     }
 
@@ -449,4 +2032,7 @@ void loop()
     {
         executeRtuGatewayLogic();
     }
+
+    // After any reply, so it goes out at the rate the host expects.
+    Host->update();
 }
@@ -0,0 +1,327 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include "SimulatedDrive.hpp"
+#include "MotionGRegisters.hpp"
+#include "../ModbusDefinitions.hpp"
+
+namespace
+{
+    ///@brief CiA 402 Statusword values, for each state.
+    constexpr uint16_t SWITCH_ON_DISABLED = 0x0040;
+    constexpr uint16_t READY_TO_SWITCH_ON = 0x0021;
+    constexpr uint16_t SWITCHED_ON = 0x0023;
+    constexpr uint16_t OPERATION_ENABLED = 0x0027;
+    constexpr uint16_t FAULT = 0x0008;
+}
+
+SimulatedDrive::SimulatedDrive(HardwareSerial& serial, const uint8_t id, const DriveTiming timing):
+    serial{serial},
+    id{id},
+    timing{timing},
+    registers(0x10000, 0),
+    defined(0x10000, false)
+{
+    for (const auto& span : MotionG::LAYOUT)
+    {
+        for (uint32_t i = span.address; i < span.end(); i++)
+        {
+            defined[i] = true;
+        }
+    }
+    state = previousState = SWITCH_ON_DISABLED;
+    registers[MotionG::Statusword::address] = state;
+    MotionG::DC_link_circuit_voltage::encode(48000, &registers[MotionG::DC_link_circuit_voltage::address]);
+    MotionG::ModbusBaudrate::encode(baud, &registers[MotionG::ModbusBaudrate::address]);
+    serial.attach(this);
+}
+
+void SimulatedDrive::receive(const uint8_t* data, const size_t length, const unsigned long at)
+{
+    if (serial.baudRate() != baud)
+    {
+        // Garbage at this end.
+        frame.clear();
+        return;
+    }
+
+    // Same as a real drive: silence ends a frame, so anything stale is dropped.
+    const auto start = at - serial.characterTime(length);
+    if (not frame.empty() && start - lastByteAt > serial.characterTime(3) + serial.characterTime(1) / 2)
+    {
+        frame.clear();
+    }
+    lastByteAt = at;
+
+    frame.insert(frame.end(), data, data + length);
+    const auto expected = expectedLength();
+    if (frame.size() > MODBUS_RTU_MAX_ADU_SIZE)
+    {
+        frame.clear();
+    }
+    else if (expected != 0 && frame.size() >= expected)
+    {
+        frame.resize(expected);
+        process(at);
+        frame.clear();
+    }
+}
+
+void SimulatedDrive::injectFault(const uint16_t errorCode)
+{
+    registers[MotionG::Error_code::address] = errorCode;
+    state = previousState = FAULT;
+    registers[MotionG::Statusword::address] = state;
+}
+
+void SimulatedDrive::setBaud(const uint32_t baud)
+{
+    this->baud = baud;
+    MotionG::ModbusBaudrate::encode(baud, &registers[MotionG::ModbusBaudrate::address]);
+}
+
+size_t SimulatedDrive::expectedLength() const
+{
+    if (frame.size() < 2)
+    {
+        return 0;
+    }
+    switch (frame[1])
+    {
+    case 0x03:
+    case 0x06:
+        return 8;
+    case 0x10:
+        return frame.size() < 7 ? 0 : 9 + frame[6];
+    case 0x17:
+        return frame.size() < 11 ? 0 : 13 + frame[10];
+    default:
+        // Unsupported, so the length is unknown.  Assume the shortest request.
+        return 8;
+    }
+}
+
+bool SimulatedDrive::isDefined(const uint16_t address, const uint16_t quantity) const
+{
+    for (uint32_t i = address; i < static_cast<uint32_t>(address) + quantity; i++)
+    {
+        if (i > 0xFFFF || not defined[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SimulatedDrive::process(unsigned long at)
+{
+    auto adu = ModbusADU();
+    std::memcpy(adu.rtu, frame.data(), frame.size());
+    adu.setRtuLen(frame.size());
+    if (not online || not adu.crcGood())
+    {
+        return;
+    }
+    const auto unitId = adu.getUnitId();
+    if (unitId != id && unitId != 0)
+    {
+        return;
+    }
+    requests++;
+
+    // Busy until the save finishes.
+    registers[MotionG::FlashStorageStatus::address] = static_cast<long>(at - flashBusyUntil) < 0 ? 1 : 0;
+    now = at;
+    showState();
+
+    uint8_t exception = 0;
+    switch (adu.getFunctionCode())
+    {
+    case 0x03:
+    {
+        const auto address = adu.getDataRegister(0);
+        const auto quantity = adu.getDataRegister(1);
+        if (quantity == 0 || quantity > 125)
+        {
+            exception = ILLEGAL_DATA_VALUE;
+        }
+        else if (not isDefined(address, quantity))
+        {
+            exception = ILLEGAL_DATA_ADDRESS;
+        }
+        else
+        {
+            prepareReadHoldingRegistersResponse(adu, &registers[address], quantity);
+        }
+        break;
+    }
+    case 0x06:
+    {
+        const auto address = adu.getDataRegister(0);
+        if (not isDefined(address, 1))
+        {
+            exception = ILLEGAL_DATA_ADDRESS;
+            break;
+        }
+        write(address, adu.getDataRegister(1));
+        if (address == MotionG::ControlCmd::address)
+        {
+            flashBusyUntil = at + timing.flashDelay;
+        }
+        // Response echoes the request.
+        break;
+    }
+    case 0x10:
+    {
+        const auto address = adu.getDataRegister(0);
+        const auto quantity = adu.getDataRegister(1);
+        if (quantity == 0 || quantity > 123 || adu.data[4] != quantity * 2)
+        {
+            exception = ILLEGAL_DATA_VALUE;
+            break;
+        }
+        if (not isDefined(address, quantity))
+        {
+            exception = ILLEGAL_DATA_ADDRESS;
+            break;
+        }
+        for (uint16_t i = 0; i < quantity; i++)
+        {
+            write(address + i, adu.data[5 + i * 2] << 8 | adu.data[6 + i * 2]);
+        }
+        adu.setDataLen(4);
+        break;
+    }
+    case 0x17:
+    {
+        const auto readAddress = adu.getDataRegister(0);
+        const auto readQuantity = adu.getDataRegister(1);
+        const auto writeAddress = adu.getDataRegister(2);
+        const auto writeQuantity = adu.getDataRegister(3);
+        if (readQuantity == 0 || readQuantity > 125 || writeQuantity == 0 || writeQuantity > 121 || adu.data[8] != writeQuantity * 2)
+        {
+            exception = ILLEGAL_DATA_VALUE;
+            break;
+        }
+        if (not isDefined(readAddress, readQuantity) || not isDefined(writeAddress, writeQuantity))
+        {
+            exception = ILLEGAL_DATA_ADDRESS;
+            break;
+        }
+        // Writes happen before reads.
+        for (uint16_t i = 0; i < writeQuantity; i++)
+        {
+            write(writeAddress + i, adu.data[9 + i * 2] << 8 | adu.data[10 + i * 2]);
+        }
+        prepareReadHoldingRegistersResponse(adu, &registers[readAddress], readQuantity);
+        break;
+    }
+    default:
+        exception = ILLEGAL_FUNCTION;
+        break;
+    }
+
+    const auto newBaud = exception ? 0 : checkBaud(exception);
+
+    if (unitId != 0)
+    {
+        if (exception)
+        {
+            adu.prepareExceptionResponse(exception);
+        }
+        adu.updateCrc();
+        const auto jitter = timing.jitter == 0 ? 0 : random() % (timing.jitter + 1);
+        serial.inject(adu.rtu, adu.getRtuLen(), at + timing.responseDelay + jitter);
+    }
+
+    // The response still goes out at the old rate.
+    if (newBaud != 0)
+    {
+        baud = newBaud;
+    }
+}
+
+uint32_t SimulatedDrive::checkBaud(uint8_t& exception)
+{
+    auto& raw = registers[MotionG::ModbusBaudrate::address];
+    const auto requested = MotionG::ModbusBaudrate::decode(&raw);
+    if (requested == baud)
+    {
+        return 0;
+    }
+    if (requested < 9600 || requested > timing.maxBaud)
+    {
+        MotionG::ModbusBaudrate::encode(baud, &raw);
+        exception = ILLEGAL_DATA_VALUE;
+        return 0;
+    }
+    return requested;
+}
+
+void SimulatedDrive::write(const uint16_t address, const uint16_t value)
+{
+    if (address == MotionG::Controlword::address)
+    {
+        setControlword(value);
+        return;
+    }
+    if (address == MotionG::ControlCmd::address && value == 0x01)
+    {
+        flashWrites++;
+        savedBaud = MotionG::ModbusBaudrate::decode(&registers[MotionG::ModbusBaudrate::address]);
+    }
+    registers[address] = value;
+}
+
+void SimulatedDrive::setControlword(const uint16_t value)
+{
+    controlwordWrites++;
+    const auto previous = registers[MotionG::Controlword::address];
+    registers[MotionG::Controlword::address] = value;
+
+    const auto before = state;
+    if (state == FAULT)
+    {
+        // Fault reset happens on the rising edge of bit 7.
+        if ((value & 0x80) && not (previous & 0x80))
+        {
+            registers[MotionG::Error_code::address] = 0;
+            state = SWITCH_ON_DISABLED;
+        }
+    }
+    else if (not (value & 0x02))
+    {
+        // Disable voltage.
+        state = SWITCH_ON_DISABLED;
+    }
+    else if ((value & 0x0F) == 0x06)
+    {
+        // Shutdown.
+        state = READY_TO_SWITCH_ON;
+    }
+    else if ((value & 0x0F) == 0x07 && state != SWITCH_ON_DISABLED)
+    {
+        state = SWITCHED_ON;
+    }
+    else if ((value & 0x0F) == 0x0F && state != SWITCH_ON_DISABLED)
+    {
+        state = OPERATION_ENABLED;
+    }
+
+    if (state != before)
+    {
+        // Takes a moment to show.
+        previousState = registers[MotionG::Statusword::address];
+        settledAt = now + timing.transitionDelay;
+    }
+    showState();
+}
+
+void SimulatedDrive::showState()
+{
+    registers[MotionG::Statusword::address] = static_cast<long>(now - settledAt) < 0 ? previousState : state;
+}
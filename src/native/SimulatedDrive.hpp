@@ -0,0 +1,157 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <ModbusADU.h>
+#include <random>
+#include <vector>
+
+///@brief How quickly a `SimulatedDrive` answers.  All times are in microseconds.
+struct DriveTiming
+{
+    ///@brief From the end of a request to the start of its response.
+    unsigned long responseDelay = 300;
+    ///@brief Random extra delay, up to this much.
+    unsigned long jitter = 100;
+    ///@brief How long "FlashStorageStatus" reads busy after being asked to persist to flash.
+    unsigned long flashDelay = 20000;
+    ///@brief How long "Statusword" shows the old state after a "Controlword" write changes it.
+    unsigned long transitionDelay = 1000;
+    ///@brief Fastest baud rate the drive accepts.  Faster ones are an illegal data value.
+    uint32_t maxBaud = 921600;
+};
+
+/**
+ * @brief Software MotionG DN1-G60xxN drive, on the other end of a simulated serial line.
+ * @details Every register in the Modbus dictionary exists, and anything else is an illegal address.
+ *          Supports function codes 0x03, 0x06, 0x10, and 0x17.
+ *          Controlword and Statusword follow the CiA 402 state machine, with a settling delay, and faults can be injected.
+ *          Writing "ModbusBaudrate" switches rates right after the response, and anything sent at another rate is ignored.
+ *          Saving to flash is acknowledged at once, then "FlashStorageStatus" is 1 until it finishes.
+ */
+class SimulatedDrive : public SerialDevice
+{
+public:
+    SimulatedDrive(HardwareSerial& serial, uint8_t id, DriveTiming timing = {});
+
+    void receive(const uint8_t* data, size_t length, unsigned long at) override;
+
+    ///@brief Raise a fault, like the hardware would.
+    void injectFault(uint16_t errorCode);
+
+    ///@brief Stop responding, as if power was lost.
+    void setOnline(const bool online)
+    {
+        this->online = online;
+    }
+
+    uint16_t getRegister(uint16_t address) const
+    {
+        return registers[address];
+    }
+
+    void setRegister(const uint16_t address, const uint16_t value)
+    {
+        registers[address] = value;
+    }
+
+    ///@brief Requests answered, broadcasts included.
+    [[nodiscard]] uint32_t getRequests() const
+    {
+        return requests;
+    }
+
+    ///@brief Number of times settings were persisted to flash.
+    [[nodiscard]] uint32_t getFlashWrites() const
+    {
+        return flashWrites;
+    }
+
+    ///@brief Number of Controlword writes.
+    [[nodiscard]] uint32_t getControlwordWrites() const
+    {
+        return controlwordWrites;
+    }
+
+    [[nodiscard]] uint8_t getId() const
+    {
+        return id;
+    }
+
+    [[nodiscard]] uint32_t getBaud() const
+    {
+        return baud;
+    }
+
+    ///@brief Rate in flash, which the drive would power up at.
+    [[nodiscard]] uint32_t getSavedBaud() const
+    {
+        return savedBaud;
+    }
+
+    ///@brief Change rates immediately, as if configured that way before power on.
+    void setBaud(uint32_t baud);
+
+    void resetCounters()
+    {
+        requests = flashWrites = controlwordWrites = 0;
+    }
+
+private:
+    HardwareSerial& serial;
+    const uint8_t id;
+    DriveTiming timing;
+    bool online = true;
+    uint32_t baud = 115200;
+    uint32_t savedBaud = 115200;
+
+    std::vector<uint16_t> registers;
+    std::vector<bool> defined;
+
+    std::vector<uint8_t> frame;
+    unsigned long lastByteAt = 0;
+    unsigned long flashBusyUntil = 0;
+
+    ///@brief CiA 402 state, as a "Statusword".  Shown once `settledAt` passes.
+    uint16_t state = 0;
+    ///@brief What "Statusword" shows until then.
+    uint16_t previousState = 0;
+    unsigned long settledAt = 0;
+    ///@brief When the request being handled arrived.
+    unsigned long now = 0;
+
+    uint32_t requests = 0;
+    uint32_t flashWrites = 0;
+    uint32_t controlwordWrites = 0;
+
+    std::minstd_rand random;
+
+    ///@return Length of the request being received, or 0 if not known yet.
+    [[nodiscard]] size_t expectedLength() const;
+
+    ///@brief Handle a complete request.
+    void process(unsigned long at);
+
+    ///@return true if every register in the range exists.
+    [[nodiscard]] bool isDefined(uint16_t address, uint16_t quantity) const;
+
+    ///@brief Update "Statusword" from the state, once the latest transition has settled.
+    void showState();
+
+    ///@brief Store a register, with any side effects.
+    void write(uint16_t address, uint16_t value);
+
+    /**
+     * @brief Check a write to "ModbusBaudrate".
+     * @return Rate to switch to once the response is sent, or 0 if unchanged.
+     */
+    uint32_t checkBaud(uint8_t& exception);
+
+    ///@brief Follow the CiA 402 state machine.
+    void setControlword(uint16_t value);
+};
@@ -0,0 +1,409 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief Measure motor bus latency against a simulated drive.
+ * @details Usage: benchmark [iterations] [response delay (us)] [baud] [drive max baud]
+ *          Ends with several drives sharing one bus, as a gantry would.
+ */
+
+// Each unit test brings its own main().
+#ifndef PIO_UNIT_TESTING
+#include <Arduino.h>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "SimulatedDrive.hpp"
+#include "../FlightRecorder.hpp"
+#include "../LinearMotor.hpp"
+#include "../ModbusDefinitions.hpp"
+#include "../MotorBus.hpp"
+
+namespace
+{
+    ///@brief Records everything on the first bus, as the firmware does.  Too big for the stack.
+    FlightRecorder recorder;
+
+    ///@brief Only used to time recording.
+    FlightRecorder scratchRecorder;
+
+    struct Result
+    {
+        std::vector<unsigned long> latencies;
+        unsigned long elapsed = 0;
+        size_t errors = 0;
+    };
+
+    /**
+     * @brief Run an operation repeatedly, timing each run.
+     * @param operation Returns true on success.
+     */
+    Result measure(const size_t iterations, const std::function<bool()>& operation)
+    {
+        auto result = Result();
+        result.latencies.reserve(iterations);
+        const auto start = micros();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            const auto before = micros();
+            if (not operation())
+            {
+                result.errors++;
+            }
+            result.latencies.push_back(micros() - before);
+        }
+        result.elapsed = micros() - start;
+        return result;
+    }
+
+    unsigned long percentile(const std::vector<unsigned long>& sorted, const unsigned percent)
+    {
+        return sorted[(sorted.size() - 1) * percent / 100];
+    }
+
+    void report(const char* name, Result result)
+    {
+        if (result.latencies.empty())
+        {
+            return;
+        }
+        std::sort(result.latencies.begin(), result.latencies.end());
+        const auto throughput = result.elapsed == 0 ? 0.0 : result.latencies.size() * 1e6 / result.elapsed;
+        std::printf("%-28s %7zu %10.1f %9lu %9lu %9lu %7zu\n", name, result.latencies.size(), throughput,
+                    percentile(result.latencies, 50), percentile(result.latencies, 99), result.latencies.back(), result.errors);
+    }
+
+    ///@brief Drive the non-blocking interface until `done` is set.
+    void waitFor(MotorBus& bus, const bool& done)
+    {
+        while (not done)
+        {
+            bus.update();
+        }
+    }
+
+    ///@brief What the drive saw, per operation.
+    void reportDrive(const SimulatedDrive& drive, const size_t iterations)
+    {
+        std::printf("    %.1f requests, %.1f Controlword writes, %.1f flash writes per op\n",
+                    static_cast<double>(drive.getRequests()) / iterations,
+                    static_cast<double>(drive.getControlwordWrites()) / iterations,
+                    static_cast<double>(drive.getFlashWrites()) / iterations);
+    }
+}
+
+int main(const int argc, char** argv)
+{
+    const size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    auto timing = DriveTiming();
+    if (argc > 2)
+    {
+        timing.responseDelay = std::strtoul(argv[2], nullptr, 10);
+    }
+    const uint32_t baud = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 115200;
+    if (argc > 4)
+    {
+        timing.maxBaud = std::strtoul(argv[4], nullptr, 10);
+    }
+    // Every configuration change persists to flash, which is slow.
+    const auto configIterations = std::max<size_t>(1, iterations / 20);
+
+    auto serial = HardwareSerial(1);
+    auto drive = SimulatedDrive(serial, 1, timing);
+    auto bus = MotorBus(serial);
+    bus.setRecorder(&recorder, 1);
+    auto motor = LinearMotor(bus, 1);
+    bus.begin(baud, SERIAL_8N1, -1, -1);
+    drive.setBaud(baud);
+
+    std::printf("%zu iterations, %lu us response delay, %u baud\n\n", iterations, timing.responseDelay, baud);
+    std::printf("%-28s %7s %10s %9s %9s %9s %7s\n", "benchmark", "ops", "ops/s", "p50 (us)", "p99 (us)", "max (us)", "errors");
+
+    report("getStatus", measure(iterations, [&]
+    {
+        return not motor.getStatus().modbusError;
+    }));
+
+    report("submitGetStatus", measure(iterations, [&]
+    {
+        auto done = false;
+        auto success = false;
+        motor.submitGetStatus([&](const LinearMotorStatus& status)
+        {
+            success = not status.modbusError;
+            done = true;
+        });
+        waitFor(bus, done);
+        return success;
+    }));
+
+    // As the gateway sees it: a host read of Error_code through unit id 2.
+    report("forwardAdu", measure(iterations, [&]
+    {
+        auto adu = ModbusADU();
+        prepareReadHoldingRegisters(adu, 2, MotionG::Error_code::address, MotionG::Error_code::length);
+        return motor.forwardAdu(adu);
+    }));
+
+    report("submitForward", measure(iterations, [&]
+    {
+        auto adu = ModbusADU();
+        prepareReadHoldingRegisters(adu, 2, MotionG::Error_code::address, MotionG::Error_code::length);
+        auto done = false;
+        auto success = false;
+        motor.submitForward(adu, [&](ModbusADU&, const bool forwarded)
+        {
+            success = forwarded;
+            done = true;
+        });
+        waitFor(bus, done);
+        return success;
+    }));
+
+    // Alternate values, since writing what the drive already has is skipped.
+    uint32_t gain = 100;
+    drive.resetCounters();
+    report("tune, per setter", measure(configIterations, [&]
+    {
+        gain = gain == 100 ? 101 : 100;
+        motor.setCurrentGain(gain);
+        motor.setInertia(gain);
+        return true;
+    }));
+    reportDrive(drive, configIterations);
+
+    drive.resetCounters();
+    report("tune, transaction", measure(configIterations, [&]
+    {
+        gain = gain == 100 ? 101 : 100;
+        auto transaction = ConfigTransaction();
+        transaction.stage<MotionG::CurrentBandwidth>(gain);
+        transaction.stage<MotionG::Inertia>(gain);
+        return motor.commit(transaction) == MODBUS_RTU_MASTER_SUCCESS;
+    }));
+    reportDrive(drive, configIterations);
+
+    // The save finishes in the background, and status polls notice.
+    drive.resetCounters();
+    report("tune, until saved", measure(configIterations, [&]
+    {
+        gain = gain == 100 ? 101 : 100;
+        auto transaction = ConfigTransaction();
+        transaction.stage<MotionG::CurrentBandwidth>(gain);
+        if (motor.commit(transaction) != MODBUS_RTU_MASTER_SUCCESS)
+        {
+            return false;
+        }
+        while (motor.getFlashState() == FLASH_SAVING)
+        {
+            motor.getStatus();
+        }
+        return motor.getFlashState() == FLASH_SAVED && not motor.hasUnsavedChanges();
+    }));
+    reportDrive(drive, configIterations);
+
+    // Everything is saved by now, so nothing needs doing.
+    drive.resetCounters();
+    report("tune, unchanged", measure(configIterations, [&]
+    {
+        auto transaction = ConfigTransaction();
+        transaction.stage<MotionG::CurrentBandwidth>(gain);
+        return motor.commit(transaction) == MODBUS_RTU_MASTER_SUCCESS;
+    }));
+    reportDrive(drive, configIterations);
+
+    // Replacing a drive: capture everything once, then put back whatever differs.
+    static auto snapshot = ParameterSnapshot();
+    drive.resetCounters();
+    report("snapshot capture", measure(1, [&]
+    {
+        return motor.capture(snapshot) == MODBUS_RTU_MASTER_SUCCESS;
+    }));
+    reportDrive(drive, 1);
+
+    drive.setRegister(MotionG::Inertia::address + 1, 1234);
+    drive.setRegister(MotionG::CurrentBandwidth::address + 1, 321);
+    drive.setRegister(MotionG::Home_offset::address + 1, 7);
+    uint16_t changed = 0;
+    drive.resetCounters();
+    report("snapshot restore, 3 changed", measure(1, [&]
+    {
+        return motor.restore(snapshot, true, changed) == MODBUS_RTU_MASTER_SUCCESS && changed == 3;
+    }));
+    reportDrive(drive, 1);
+
+    drive.resetCounters();
+    report("snapshot restore, unchanged", measure(1, [&]
+    {
+        return motor.restore(snapshot, true, changed) == MODBUS_RTU_MASTER_SUCCESS && changed == 0;
+    }));
+    reportDrive(drive, 1);
+
+    // The Enable button, after a fault.
+    drive.resetCounters();
+    report("enable, from fault", measure(configIterations, [&]
+    {
+        drive.injectFault(0x2310);
+        return motor.enable() == MODBUS_RTU_MASTER_SUCCESS;
+    }));
+    reportDrive(drive, configIterations);
+
+    // Same as at bring-up: as fast as both ends allow.
+    const auto before = bus.getBaud();
+    const auto negotiateStart = micros();
+    const auto negotiated = bus.negotiateBaud(MotorBus::BAUD_RATES.front());
+    std::printf("\nnegotiated %u -> %u baud in %lu us\n", before, negotiated, micros() - negotiateStart);
+    if (negotiated != before)
+    {
+        report("getStatus, negotiated", measure(iterations, [&]
+        {
+            return not motor.getStatus().modbusError;
+        }));
+
+        // Saving drops to the default rate, so the drive still powers up there.
+        drive.resetCounters();
+        report("tune, negotiated", measure(configIterations, [&]
+        {
+            gain = gain == 100 ? 101 : 100;
+            auto transaction = ConfigTransaction();
+            transaction.stage<MotionG::CurrentBandwidth>(gain);
+            return motor.commit(transaction) == MODBUS_RTU_MASTER_SUCCESS && motor.getFlashState() == FLASH_SAVED
+                && drive.getSavedBaud() == MotorBus::DEFAULT_BAUD && drive.getBaud() == negotiated;
+        }));
+        reportDrive(drive, configIterations);
+    }
+
+    const auto& rtt = bus.getRttEstimator();
+    std::printf("\nrtt: mean=%luus deviation=%luus timeout=%lums timeouts=%lu\n",
+                static_cast<unsigned long>(rtt.getMean()), static_cast<unsigned long>(rtt.getDeviation()),
+                static_cast<unsigned long>(rtt.getTimeout()), static_cast<unsigned long>(rtt.getTimeouts()));
+    const auto& statistics = bus.getStatistics();
+    std::printf("bus: transactions=%u timeouts=%u crc=%u frame=%u exceptions=%u\n",
+                statistics.transactions.get(), statistics.timeouts.get(), statistics.crcErrors.get(),
+                statistics.frameErrors.get(), statistics.exceptions.get());
+
+    constexpr uint32_t RECORD_COUNT = 1000000;
+    auto frame = ModbusADU();
+    prepareReadHoldingRegisters(frame, 1, MotionG::Error_code::address, MotionG::Error_code::length);
+    const auto recordStart = micros();
+    for (uint32_t i = 0; i < RECORD_COUNT; i++)
+    {
+        scratchRecorder.record(1, FLIGHT_SENT, i, frame.rtu, frame.getRtuLen());
+    }
+    std::printf("recorder: frames=%u, %.0f ns per record\n", recorder.getRecorded(),
+                (micros() - recordStart) * 1000.0 / RECORD_COUNT);
+
+    // A gantry: several drives on one wire, polled in turn.
+    constexpr size_t SHARED_DRIVES = 3;
+    auto sharedSerial = HardwareSerial(2);
+    auto sharedBus = MotorBus(sharedSerial);
+    sharedBus.begin(baud, SERIAL_8N1, -1, -1);
+    std::vector<std::unique_ptr<SimulatedDrive>> sharedDrives;
+    std::vector<std::unique_ptr<LinearMotor>> sharedMotors;
+    for (uint8_t id = 1; id <= SHARED_DRIVES; id++)
+    {
+        sharedDrives.push_back(std::make_unique<SimulatedDrive>(sharedSerial, id, timing));
+        sharedDrives.back()->setBaud(baud);
+        sharedMotors.push_back(std::make_unique<LinearMotor>(sharedBus, id));
+    }
+
+    std::printf("\n%zu drives on one bus\n", SHARED_DRIVES);
+    const auto sharedStart = micros();
+    const auto sharedNegotiated = sharedBus.negotiateBaud(MotorBus::BAUD_RATES.front());
+    std::printf("negotiated %u -> %u baud in %lu us\n", baud, sharedNegotiated, micros() - sharedStart);
+
+    size_t next = 0;
+    report("submitGetStatus, in turn", measure(iterations, [&]
+    {
+        auto done = false;
+        auto success = false;
+        sharedMotors[next]->submitGetStatus([&](const LinearMotorStatus& status)
+        {
+            success = not status.modbusError;
+            done = true;
+        });
+        next = (next + 1) % sharedMotors.size();
+        waitFor(sharedBus, done);
+        return success;
+    }));
+    for (const auto& sharedDrive : sharedDrives)
+    {
+        std::printf("    drive %u: %u requests at %u baud\n", sharedDrive->getId(), sharedDrive->getRequests(), sharedDrive->getBaud());
+    }
+
+    std::vector<LinearMotor*> sharedPointers;
+    for (const auto& sharedMotor : sharedMotors)
+    {
+        sharedPointers.push_back(sharedMotor.get());
+    }
+    report("enable from fault, in turn", measure(configIterations, [&]
+    {
+        auto success = true;
+        for (size_t i = 0; i < SHARED_DRIVES; i++)
+        {
+            sharedDrives[i]->injectFault(0x2310);
+            success = sharedMotors[i]->enable() == MODBUS_RTU_MASTER_SUCCESS && success;
+        }
+        return success;
+    }));
+    report("enable from fault, together", measure(configIterations, [&]
+    {
+        for (const auto& sharedDrive : sharedDrives)
+        {
+            sharedDrive->injectFault(0x2310);
+        }
+        auto error = MODBUS_RTU_MASTER_SUCCESS;
+        return LinearMotor::enableAll(sharedPointers.data(), sharedPointers.size(), error) == (1 << SHARED_DRIVES) - 1;
+    }));
+
+    // The gateway's fan-out unit: the same write to a drive on each bus.
+    std::printf("\none drive on each of two buses\n");
+    uint32_t window = 1000;
+    const auto prepareWindowWrite = [&window](ModbusADU& adu)
+    {
+        std::array<uint16_t, MotionG::Following_error_window::length> raw = {};
+        MotionG::Following_error_window::encode(window, raw.data());
+        prepareWriteMultipleRegisters(adu, 4, MotionG::Following_error_window::address, raw.data(), raw.size());
+    };
+    report("write both, in turn", measure(configIterations, [&]
+    {
+        window++;
+        auto first = ModbusADU();
+        auto second = ModbusADU();
+        prepareWindowWrite(first);
+        prepareWindowWrite(second);
+        return motor.forwardAdu(first) && sharedMotors[0]->forwardAdu(second);
+    }));
+    report("write both, together", measure(configIterations, [&]
+    {
+        window++;
+        auto first = ModbusADU();
+        auto second = ModbusADU();
+        prepareWindowWrite(first);
+        prepareWindowWrite(second);
+        auto firstDone = false;
+        auto secondDone = false;
+        auto success = true;
+        motor.submitForward(first, [&](ModbusADU&, const bool forwarded)
+        {
+            success &= forwarded;
+            firstDone = true;
+        });
+        sharedMotors[0]->submitForward(second, [&](ModbusADU&, const bool forwarded)
+        {
+            success &= forwarded;
+            secondDone = true;
+        });
+        while (not (firstDone && secondDone))
+        {
+            bus.update();
+            sharedBus.update();
+        }
+        return success;
+    }));
+    return 0;
+}
+#endif
@@ -0,0 +1,91 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include <unity.h>
+
+#include "Cia402.hpp"
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void testDecodeStates()
+{
+    // Bit 9 (remote) and bit 4 (voltage enabled) set, as a real drive reports them.
+    TEST_ASSERT_EQUAL(CIA402_NOT_READY_TO_SWITCH_ON, decodeCia402State(0x0200));
+    TEST_ASSERT_EQUAL(CIA402_SWITCH_ON_DISABLED, decodeCia402State(0x0250));
+    TEST_ASSERT_EQUAL(CIA402_READY_TO_SWITCH_ON, decodeCia402State(0x0231));
+    TEST_ASSERT_EQUAL(CIA402_SWITCHED_ON, decodeCia402State(0x0233));
+    TEST_ASSERT_EQUAL(CIA402_OPERATION_ENABLED, decodeCia402State(0x0237));
+    TEST_ASSERT_EQUAL(CIA402_QUICK_STOP_ACTIVE, decodeCia402State(0x0217));
+    TEST_ASSERT_EQUAL(CIA402_FAULT_REACTION_ACTIVE, decodeCia402State(0x021F));
+    TEST_ASSERT_EQUAL(CIA402_FAULT, decodeCia402State(0x0218));
+}
+
+void testDecodeIgnoresOtherBits()
+{
+    // Warning, target reached, and manufacturer bits.
+    TEST_ASSERT_EQUAL(CIA402_OPERATION_ENABLED, decodeCia402State(0xC6B7));
+    // Quick stop is a "don't care" while faulted.
+    TEST_ASSERT_EQUAL(CIA402_FAULT, decodeCia402State(0x0238));
+}
+
+void testDecodeInvalid()
+{
+    // Switch on disabled with ready to switch on also set.
+    TEST_ASSERT_EQUAL(CIA402_NOT_READY_TO_SWITCH_ON, decodeCia402State(0x0041));
+}
+
+void testEnableSequence()
+{
+    uint16_t controlword = 0;
+    TEST_ASSERT_TRUE(nextEnableControlword(CIA402_SWITCH_ON_DISABLED, controlword));
+    TEST_ASSERT_EQUAL_HEX16(0x06, controlword);
+    TEST_ASSERT_TRUE(nextEnableControlword(CIA402_READY_TO_SWITCH_ON, controlword));
+    TEST_ASSERT_EQUAL_HEX16(0x0F, controlword);
+    TEST_ASSERT_TRUE(nextEnableControlword(CIA402_SWITCHED_ON, controlword));
+    TEST_ASSERT_EQUAL_HEX16(0x0F, controlword);
+    TEST_ASSERT_TRUE(nextEnableControlword(CIA402_QUICK_STOP_ACTIVE, controlword));
+    TEST_ASSERT_EQUAL_HEX16(0x0F, controlword);
+}
+
+void testFaultResetEdge()
+{
+    uint16_t controlword = 0x0F;
+    TEST_ASSERT_TRUE(nextEnableControlword(CIA402_FAULT, controlword));
+    TEST_ASSERT_EQUAL_HEX16(CONTROLWORD_FAULT_RESET, controlword);
+    // Still faulted with the bit set, so it must drop first.
+    TEST_ASSERT_TRUE(nextEnableControlword(CIA402_FAULT, controlword));
+    TEST_ASSERT_EQUAL_HEX16(0x06, controlword);
+    TEST_ASSERT_TRUE(nextEnableControlword(CIA402_FAULT, controlword));
+    TEST_ASSERT_EQUAL_HEX16(CONTROLWORD_FAULT_RESET, controlword);
+}
+
+void testNothingToSend()
+{
+    uint16_t controlword = 0x1234;
+    TEST_ASSERT_FALSE(nextEnableControlword(CIA402_OPERATION_ENABLED, controlword));
+    TEST_ASSERT_FALSE(nextEnableControlword(CIA402_NOT_READY_TO_SWITCH_ON, controlword));
+    TEST_ASSERT_FALSE(nextEnableControlword(CIA402_FAULT_REACTION_ACTIVE, controlword));
+    TEST_ASSERT_EQUAL_HEX16(0x1234, controlword);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testDecodeStates);
+    RUN_TEST(testDecodeIgnoresOtherBits);
+    RUN_TEST(testDecodeInvalid);
+    RUN_TEST(testEnableSequence);
+    RUN_TEST(testFaultResetEdge);
+    RUN_TEST(testNothingToSend);
+    return UNITY_END();
+}
@@ -0,0 +1,191 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include <climits>
+#include <string>
+#include <unity.h>
+
+#include "CommandLine.hpp"
+
+namespace
+{
+    ///@return true if the last character completed a line.
+    bool addAll(CommandLine& line, const std::string_view text)
+    {
+        auto complete = false;
+        for (const auto c : text)
+        {
+            complete = line.add(c);
+        }
+        return complete;
+    }
+
+    void handle(CommandArgs&)
+    {
+    }
+
+    constexpr std::array<CommandEntry, 3> COMMANDS = {{
+        {"GET", handle},
+        {"SET", handle},
+        {"STATS", handle},
+    }};
+    static_assert(isSorted(COMMANDS));
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void testLineTrimmed()
+{
+    auto line = CommandLine();
+    TEST_ASSERT_FALSE(addAll(line, "  STATS\t\r"));
+    TEST_ASSERT_TRUE(line.add('\n'));
+    TEST_ASSERT_TRUE(line.get() == "STATS");
+    TEST_ASSERT_FALSE(line.isOverflowed());
+
+    // The next character starts a new line.
+    TEST_ASSERT_TRUE(addAll(line, "GET\n"));
+    TEST_ASSERT_TRUE(line.get() == "GET");
+}
+
+void testLineOverflow()
+{
+    auto line = CommandLine();
+    TEST_ASSERT_TRUE(addAll(line, std::string(CommandLine::CAPACITY + 1, 'A') + "\n"));
+    TEST_ASSERT_TRUE(line.isOverflowed());
+    TEST_ASSERT_TRUE(line.get().empty());
+
+    // Only the long line is lost.
+    TEST_ASSERT_TRUE(addAll(line, "GET\n"));
+    TEST_ASSERT_FALSE(line.isOverflowed());
+    TEST_ASSERT_TRUE(line.get() == "GET");
+}
+
+void testLineClear()
+{
+    auto line = CommandLine();
+    addAll(line, "GARBAGE");
+    line.clear();
+    TEST_ASSERT_TRUE(addAll(line, "STOP\n"));
+    TEST_ASSERT_TRUE(line.get() == "STOP");
+}
+
+void testArgsSplit()
+{
+    auto args = CommandArgs("GET X  name");
+    TEST_ASSERT_TRUE(args.getName() == "GET");
+    TEST_ASSERT_FALSE(args.empty());
+    TEST_ASSERT_TRUE(args.next() == "X");
+    TEST_ASSERT_TRUE(args.next() == "name");
+    TEST_ASSERT_TRUE(args.empty());
+    TEST_ASSERT_TRUE(args.next().empty());
+}
+
+void testArgsNameEndsAtDigit()
+{
+    auto stream = CommandArgs("STREAM:200");
+    TEST_ASSERT_TRUE(stream.getName() == "STREAM");
+    long rate = 0;
+    TEST_ASSERT_TRUE(stream.next(rate));
+    TEST_ASSERT_EQUAL(200, rate);
+
+    auto move = CommandArgs("##1,3");
+    TEST_ASSERT_TRUE(move.getName() == "##");
+    long first = 0;
+    long second = 0;
+    TEST_ASSERT_TRUE(move.next(first));
+    TEST_ASSERT_TRUE(move.next(second));
+    TEST_ASSERT_EQUAL(1, first);
+    TEST_ASSERT_EQUAL(3, second);
+}
+
+void testArgsInteger()
+{
+    auto args = CommandArgs("SET x -5 999");
+    long value = 7;
+    TEST_ASSERT_FALSE(args.next(value));
+    TEST_ASSERT_EQUAL(7, value);
+    TEST_ASSERT_TRUE(args.next(value));
+    TEST_ASSERT_EQUAL(-5, value);
+
+    uint8_t clamped = 0;
+    TEST_ASSERT_TRUE(args.next(clamped, 0, 255));
+    TEST_ASSERT_EQUAL(255, clamped);
+    TEST_ASSERT_FALSE(args.next(clamped, 0, 255));
+}
+
+void testFindCommand()
+{
+    TEST_ASSERT_TRUE(findCommand(COMMANDS, "SET") == &COMMANDS[1]);
+    TEST_ASSERT_TRUE(findCommand(COMMANDS, "STATS") == &COMMANDS[2]);
+    TEST_ASSERT_NULL(findCommand(COMMANDS, "STAT"));
+    TEST_ASSERT_NULL(findCommand(COMMANDS, "ZZZ"));
+    TEST_ASSERT_NULL(findCommand(COMMANDS, ""));
+
+    constexpr std::array<CommandEntry, 2> unsorted = {{{"SET", handle}, {"GET", handle}}};
+    static_assert(not isSorted(unsorted));
+    constexpr std::array<CommandEntry, 2> duplicated = {{{"GET", handle}, {"GET", handle}}};
+    static_assert(not isSorted(duplicated));
+}
+
+void testParseInteger()
+{
+    long value = 0;
+    TEST_ASSERT_TRUE(parseInteger("42", value));
+    TEST_ASSERT_EQUAL(42, value);
+    TEST_ASSERT_TRUE(parseInteger("+7", value));
+    TEST_ASSERT_EQUAL(7, value);
+    TEST_ASSERT_TRUE(parseInteger("-0", value));
+    TEST_ASSERT_EQUAL(0, value);
+
+    value = 3;
+    TEST_ASSERT_FALSE(parseInteger("", value));
+    TEST_ASSERT_FALSE(parseInteger("-", value));
+    TEST_ASSERT_FALSE(parseInteger("+", value));
+    TEST_ASSERT_FALSE(parseInteger("12a", value));
+    TEST_ASSERT_FALSE(parseInteger(" 1", value));
+    TEST_ASSERT_FALSE(parseInteger("1.5", value));
+    TEST_ASSERT_EQUAL(3, value);
+}
+
+void testParseIntegerLimits()
+{
+    long value = 0;
+    TEST_ASSERT_TRUE(parseInteger(std::to_string(LONG_MAX), value));
+    TEST_ASSERT_TRUE(value == LONG_MAX);
+    TEST_ASSERT_TRUE(parseInteger(std::to_string(LONG_MIN), value));
+    TEST_ASSERT_TRUE(value == LONG_MIN);
+
+    // One past either end.
+    auto tooBig = std::to_string(LONG_MAX);
+    tooBig.back()++;
+    TEST_ASSERT_FALSE(parseInteger(tooBig, value));
+    auto tooSmall = std::to_string(LONG_MIN);
+    tooSmall.back()++;
+    TEST_ASSERT_FALSE(parseInteger(tooSmall, value));
+    TEST_ASSERT_FALSE(parseInteger("99999999999999999999999", value));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testLineTrimmed);
+    RUN_TEST(testLineOverflow);
+    RUN_TEST(testLineClear);
+    RUN_TEST(testArgsSplit);
+    RUN_TEST(testArgsNameEndsAtDigit);
+    RUN_TEST(testArgsInteger);
+    RUN_TEST(testFindCommand);
+    RUN_TEST(testParseInteger);
+    RUN_TEST(testParseIntegerLimits);
+    return UNITY_END();
+}
@@ -0,0 +1,278 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include <array>
+#include <thread>
+#include <unity.h>
+
+#include "FlightRecorder.hpp"
+
+namespace
+{
+    ///@brief Too big for the stack.
+    FlightRecorder recorder;
+
+    ///@brief A write, so never thinned.
+    const std::array<uint8_t, 8> FRAME = {0x02, 0x06, 0x60, 0x40, 0x00, 0x0F, 0xC7, 0xDD};
+    const std::array<uint8_t, 8> POLL = {0x02, 0x03, 0x60, 0x41, 0x00, 0x01, 0xDA, 0x1D};
+    const std::array<uint8_t, 7> REPLY = {0x02, 0x03, 0x02, 0x02, 0x37, 0x3C, 0x2A};
+
+    void recordOne(const uint8_t channel, const uint32_t time)
+    {
+        recorder.record(channel, FLIGHT_SENT, time, FRAME.data(), FRAME.size());
+    }
+
+    void poll(const uint32_t time, const bool answered = true)
+    {
+        recorder.record(1, FLIGHT_SENT, time, POLL.data(), POLL.size());
+        if (answered)
+        {
+            recorder.record(1, FLIGHT_RECEIVED, time + 500, REPLY.data(), REPLY.size());
+        }
+    }
+}
+
+void setUp()
+{
+    recorder.clear();
+}
+
+void tearDown()
+{
+}
+
+void testRecordAndRead()
+{
+    recordOne(1, 1234);
+    TEST_ASSERT_EQUAL_UINT32(1, recorder.getNext(1));
+    TEST_ASSERT_EQUAL_UINT32(0, recorder.getNext(0));
+    TEST_ASSERT_EQUAL_UINT32(1, recorder.getRecorded());
+
+    auto record = FlightRecord();
+    TEST_ASSERT_TRUE(recorder.read(1, 0, record));
+    TEST_ASSERT_EQUAL_UINT32(1234, record.time);
+    TEST_ASSERT_EQUAL_UINT32(0, record.sequence);
+    TEST_ASSERT_EQUAL(FRAME.size(), record.length);
+    TEST_ASSERT_EQUAL(1, record.channel);
+    TEST_ASSERT_EQUAL(FLIGHT_SENT, record.direction);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(FRAME.data(), record.data.data(), FRAME.size());
+
+    // Never written.
+    TEST_ASSERT_FALSE(recorder.read(1, 1, record));
+    TEST_ASSERT_FALSE(recorder.read(0, 0, record));
+}
+
+void testLongFrameCut()
+{
+    std::array<uint8_t, 100> frame = {};
+    for (size_t i = 0; i < frame.size(); i++)
+    {
+        frame[i] = static_cast<uint8_t>(i);
+    }
+    recorder.record(0, FLIGHT_RECEIVED, 0, frame.data(), frame.size());
+
+    auto record = FlightRecord();
+    TEST_ASSERT_TRUE(recorder.read(0, 0, record));
+    TEST_ASSERT_EQUAL(frame.size(), record.length);
+    TEST_ASSERT_EQUAL(FLIGHT_RECEIVED, record.direction);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(frame.data(), record.data.data(), FlightRecord::DATA_SIZE);
+}
+
+void testSequenceAcrossChannels()
+{
+    recordOne(0, 0);
+    recordOne(2, 0);
+    recordOne(0, 0);
+
+    auto record = FlightRecord();
+    TEST_ASSERT_TRUE(recorder.read(2, 0, record));
+    TEST_ASSERT_EQUAL_UINT32(1, record.sequence);
+    TEST_ASSERT_TRUE(recorder.read(0, 1, record));
+    TEST_ASSERT_EQUAL_UINT32(2, record.sequence);
+}
+
+void testOverwritesOldest()
+{
+    recordOne(2, 99);
+    for (uint32_t i = 0; i < FlightRecorder::RECORDS + 10; i++)
+    {
+        recordOne(0, i);
+    }
+    TEST_ASSERT_EQUAL_UINT32(10, recorder.getOldest(0));
+    TEST_ASSERT_EQUAL_UINT32(FlightRecorder::RECORDS + 10, recorder.getNext(0));
+
+    auto record = FlightRecord();
+    TEST_ASSERT_FALSE(recorder.read(0, 9, record));
+    TEST_ASSERT_TRUE(recorder.read(0, 10, record));
+    TEST_ASSERT_EQUAL_UINT32(10, record.time);
+
+    // A busy channel leaves the others alone.
+    TEST_ASSERT_EQUAL_UINT32(0, recorder.getOldest(2));
+    TEST_ASSERT_TRUE(recorder.read(2, 0, record));
+    TEST_ASSERT_EQUAL_UINT32(99, record.time);
+}
+
+void testUnknownChannelDropped()
+{
+    recordOne(FlightRecorder::CHANNELS, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, recorder.getRecorded());
+}
+
+void testPause()
+{
+    recordOne(0, 1);
+    recorder.pause();
+    recordOne(0, 2);
+    TEST_ASSERT_EQUAL_UINT32(1, recorder.getNext(0));
+    TEST_ASSERT_FALSE(recorder.isFrozen());
+
+    recorder.resume();
+    recordOne(0, 3);
+    auto record = FlightRecord();
+    TEST_ASSERT_TRUE(recorder.read(0, 1, record));
+    TEST_ASSERT_EQUAL_UINT32(3, record.time);
+}
+
+void testFreezeOutlastsPause()
+{
+    recordOne(0, 1);
+    recorder.pause();
+    // A fault while the records are read out.
+    TEST_ASSERT_FALSE(recorder.freeze());
+    TEST_ASSERT_TRUE(recorder.freeze());
+    recorder.resume();
+    TEST_ASSERT_TRUE(recorder.isFrozen());
+    recordOne(0, 2);
+    TEST_ASSERT_EQUAL_UINT32(1, recorder.getNext(0));
+}
+
+void testRoutinePollsThinned()
+{
+    poll(0);
+    poll(1000);
+    poll(2000);
+    TEST_ASSERT_EQUAL_UINT32(2, recorder.getNext(1));
+    poll(FlightRecorder::POLL_INTERVAL);
+    TEST_ASSERT_EQUAL_UINT32(4, recorder.getNext(1));
+
+    auto record = FlightRecord();
+    TEST_ASSERT_TRUE(recorder.read(1, 2, record));
+    TEST_ASSERT_EQUAL_UINT32(FlightRecorder::POLL_INTERVAL, record.time);
+    TEST_ASSERT_EQUAL(2, record.skipped);
+    TEST_ASSERT_TRUE(recorder.read(1, 3, record));
+    TEST_ASSERT_EQUAL(0, record.skipped);
+
+    // Writes are always kept, and carry the count too.
+    poll(FlightRecorder::POLL_INTERVAL + 1000);
+    recorder.record(1, FLIGHT_SENT, 0, FRAME.data(), FRAME.size());
+    TEST_ASSERT_TRUE(recorder.read(1, 4, record));
+    TEST_ASSERT_EQUAL(FRAME[1], record.data[1]);
+    TEST_ASSERT_EQUAL(1, record.skipped);
+}
+
+void testUnansweredPollKept()
+{
+    poll(0);
+    poll(1000, false);
+    TEST_ASSERT_EQUAL_UINT32(2, recorder.getNext(1));
+    recordOne(1, 2000);
+    TEST_ASSERT_EQUAL_UINT32(4, recorder.getNext(1));
+
+    auto record = FlightRecord();
+    TEST_ASSERT_TRUE(recorder.read(1, 2, record));
+    TEST_ASSERT_EQUAL_UINT32(1000, record.time);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(POLL.data(), record.data.data(), POLL.size());
+}
+
+void testUnansweredPollKeptWhenFrozen()
+{
+    poll(0);
+    poll(1000, false);
+    recorder.freeze();
+    poll(2000);
+    TEST_ASSERT_EQUAL_UINT32(3, recorder.getNext(1));
+}
+
+void testExceptionReplyKept()
+{
+    const std::array<uint8_t, 5> exception = {0x02, 0x83, 0x02, 0x31, 0x30};
+    poll(0);
+    poll(1000, false);
+    recorder.record(1, FLIGHT_RECEIVED, 1500, exception.data(), exception.size());
+    TEST_ASSERT_EQUAL_UINT32(3, recorder.getNext(1));
+
+    auto record = FlightRecord();
+    TEST_ASSERT_TRUE(recorder.read(1, 2, record));
+    TEST_ASSERT_EQUAL(FLIGHT_RECEIVED, record.direction);
+    TEST_ASSERT_EQUAL(exception.size(), record.length);
+}
+
+void testClear()
+{
+    recordOne(0, 1);
+    recordOne(1, 1);
+    recorder.freeze();
+    recorder.clear();
+    TEST_ASSERT_FALSE(recorder.isFrozen());
+    TEST_ASSERT_EQUAL_UINT32(0, recorder.getRecorded());
+    TEST_ASSERT_EQUAL_UINT32(0, recorder.getNext(0));
+
+    auto record = FlightRecord();
+    TEST_ASSERT_FALSE(recorder.read(1, 0, record));
+    recordOne(1, 5);
+    TEST_ASSERT_TRUE(recorder.read(1, 0, record));
+    TEST_ASSERT_EQUAL_UINT32(0, record.sequence);
+}
+
+void testConcurrentWriters()
+{
+    constexpr uint32_t PER_WRITER = 200;
+    auto writer = [](const uint8_t channel)
+    {
+        for (uint32_t i = 0; i < PER_WRITER; i++)
+        {
+            recordOne(channel, i);
+        }
+    };
+    auto first = std::thread(writer, 0);
+    auto second = std::thread(writer, 1);
+    first.join();
+    second.join();
+
+    TEST_ASSERT_EQUAL_UINT32(2 * PER_WRITER, recorder.getRecorded());
+    std::array<bool, 2 * PER_WRITER> seen = {};
+    for (uint8_t channel = 0; channel < 2; channel++)
+    {
+        for (uint32_t index = 0; index < PER_WRITER; index++)
+        {
+            auto record = FlightRecord();
+            TEST_ASSERT_TRUE(recorder.read(channel, index, record));
+            TEST_ASSERT_EQUAL_UINT32(index, record.time);
+            TEST_ASSERT_FALSE(seen[record.sequence]);
+            seen[record.sequence] = true;
+        }
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testRecordAndRead);
+    RUN_TEST(testLongFrameCut);
+    RUN_TEST(testSequenceAcrossChannels);
+    RUN_TEST(testOverwritesOldest);
+    RUN_TEST(testUnknownChannelDropped);
+    RUN_TEST(testPause);
+    RUN_TEST(testFreezeOutlastsPause);
+    RUN_TEST(testRoutinePollsThinned);
+    RUN_TEST(testUnansweredPollKept);
+    RUN_TEST(testUnansweredPollKeptWhenFrozen);
+    RUN_TEST(testExceptionReplyKept);
+    RUN_TEST(testClear);
+    RUN_TEST(testConcurrentWriters);
+    return UNITY_END();
+}
@@ -0,0 +1,148 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include <array>
+#include <string>
+#include <unity.h>
+
+#include "Parameter.hpp"
+
+namespace
+{
+    constexpr auto MILLI = ParameterInfo{"milli", 0x2000, PARAMETER_INT32, READ_WRITE, true, 1000, -100000, 100000};
+    constexpr auto WHOLE = ParameterInfo{"whole", 0x2002, PARAMETER_INT16, READ_WRITE, true, 1, -32768, 32767};
+
+    int64_t parse(const ParameterInfo& parameter, const std::string_view text)
+    {
+        int64_t value = 0;
+        TEST_ASSERT_TRUE(parameter.parse(text, value));
+        return value;
+    }
+
+    bool refuses(const ParameterInfo& parameter, const std::string_view text)
+    {
+        int64_t value = 123;
+        return not parameter.parse(text, value) && value == 123;
+    }
+
+    std::string format(const ParameterInfo& parameter, const int64_t value)
+    {
+        std::array<char, 24> buffer = {};
+        parameter.format(value, buffer.data(), buffer.size());
+        return buffer.data();
+    }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void testParseScaled()
+{
+    TEST_ASSERT_EQUAL_INT64(1500, parse(MILLI, "1.5"));
+    TEST_ASSERT_EQUAL_INT64(2000, parse(MILLI, "2"));
+    TEST_ASSERT_EQUAL_INT64(3000, parse(MILLI, "+3."));
+    TEST_ASSERT_EQUAL_INT64(-250, parse(MILLI, "-0.25"));
+    TEST_ASSERT_EQUAL_INT64(1, parse(MILLI, "0.001"));
+    TEST_ASSERT_EQUAL_INT64(500, parse(MILLI, ".5"));
+}
+
+void testParseRefused()
+{
+    TEST_ASSERT_TRUE(refuses(MILLI, ""));
+    TEST_ASSERT_TRUE(refuses(MILLI, "-"));
+    TEST_ASSERT_TRUE(refuses(MILLI, "."));
+    TEST_ASSERT_TRUE(refuses(MILLI, "1.2345"));
+    TEST_ASSERT_TRUE(refuses(MILLI, "1.2.3"));
+    TEST_ASSERT_TRUE(refuses(MILLI, "1e3"));
+    TEST_ASSERT_TRUE(refuses(MILLI, "9999999999999"));
+    TEST_ASSERT_TRUE(refuses(WHOLE, "1.5"));
+}
+
+void testFormat()
+{
+    TEST_ASSERT_EQUAL_STRING("1.500", format(MILLI, 1500).c_str());
+    TEST_ASSERT_EQUAL_STRING("-0.250", format(MILLI, -250).c_str());
+    TEST_ASSERT_EQUAL_STRING("0.000", format(MILLI, 0).c_str());
+    TEST_ASSERT_EQUAL_STRING("-7", format(WHOLE, -7).c_str());
+}
+
+void testFormatParsesBack()
+{
+    for (const int64_t value : {-100000, -1, 0, 1, 999, 1000, 100000})
+    {
+        TEST_ASSERT_EQUAL_INT64(value, parse(MILLI, format(MILLI, value)));
+    }
+}
+
+void testRegisters()
+{
+    std::array<uint16_t, 2> registers = {};
+    MILLI.encode(-2, registers.data());
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, registers[0]);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFE, registers[1]);
+    TEST_ASSERT_EQUAL_INT64(-2, MILLI.decode(registers.data()));
+    TEST_ASSERT_EQUAL(2, MILLI.length());
+
+    constexpr auto unsigned32 = ParameterInfo{"u32", 0, PARAMETER_UNS32, READ_ONLY, false, 1, 0, 4294967295};
+    unsigned32.encode(4294967295, registers.data());
+    TEST_ASSERT_EQUAL_INT64(4294967295, unsigned32.decode(registers.data()));
+}
+
+void testNarrowRegisters()
+{
+    constexpr auto signed8 = ParameterInfo{"i8", 0, PARAMETER_INT8, READ_WRITE, true, 1, -128, 127};
+    constexpr auto unsigned8 = ParameterInfo{"u8", 0, PARAMETER_UNS8, READ_WRITE, true, 1, 0, 255};
+    uint16_t raw = 0;
+    // Sent as the low byte, without sign extension.
+    signed8.encode(-1, &raw);
+    TEST_ASSERT_EQUAL_HEX16(0x00FF, raw);
+    TEST_ASSERT_EQUAL_INT64(-1, signed8.decode(&raw));
+    TEST_ASSERT_EQUAL_INT64(255, unsigned8.decode(&raw));
+    TEST_ASSERT_EQUAL(1, signed8.length());
+
+    raw = 0x8000;
+    TEST_ASSERT_EQUAL_INT64(-32768, WHOLE.decode(&raw));
+}
+
+void testLimits()
+{
+    TEST_ASSERT_TRUE(MILLI.contains(100000));
+    TEST_ASSERT_FALSE(MILLI.contains(100001));
+    TEST_ASSERT_FALSE(MILLI.contains(-100001));
+    TEST_ASSERT_TRUE(MILLI.writable());
+}
+
+void testFindParameter()
+{
+    const auto found = findParameter("app_current_limit");
+    TEST_ASSERT_NOT_NULL(found);
+    TEST_ASSERT_EQUAL_HEX16(0x0462, found->address);
+    TEST_ASSERT_EQUAL(PARAMETER_UNS32, found->type);
+    TEST_ASSERT_TRUE(found->configuration);
+
+    TEST_ASSERT_NULL(findParameter("app_current_limi"));
+    TEST_ASSERT_NULL(findParameter(""));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testParseScaled);
+    RUN_TEST(testParseRefused);
+    RUN_TEST(testFormat);
+    RUN_TEST(testFormatParsesBack);
+    RUN_TEST(testRegisters);
+    RUN_TEST(testNarrowRegisters);
+    RUN_TEST(testLimits);
+    RUN_TEST(testFindParameter);
+    return UNITY_END();
+}
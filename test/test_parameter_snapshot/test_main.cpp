@@ -0,0 +1,100 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include <algorithm>
+#include <unity.h>
+
+#include "ParameterSnapshot.hpp"
+
+namespace
+{
+    ParameterSnapshot snapshot;
+
+    void fill(ParameterSnapshot& target)
+    {
+        for (size_t i = 0; i < ParameterSnapshot::REGISTER_COUNT; i++)
+        {
+            target.getRegisters()[i] = static_cast<uint16_t>(i * 7);
+        }
+    }
+}
+
+void setUp()
+{
+    snapshot = ParameterSnapshot();
+    fill(snapshot);
+    snapshot.seal();
+}
+
+void tearDown()
+{
+}
+
+void testUnsealedInvalid()
+{
+    const auto empty = ParameterSnapshot();
+    TEST_ASSERT_FALSE(empty.isValid());
+}
+
+void testSealed()
+{
+    TEST_ASSERT_TRUE(snapshot.isValid());
+    snapshot.clear();
+    TEST_ASSERT_FALSE(snapshot.isValid());
+}
+
+void testRegisterChangeDetected()
+{
+    snapshot.getRegisters()[ParameterSnapshot::REGISTER_COUNT - 1] ^= 0x0100;
+    TEST_ASSERT_FALSE(snapshot.isValid());
+    snapshot.seal();
+    TEST_ASSERT_TRUE(snapshot.isValid());
+}
+
+void testStoredForm()
+{
+    auto loaded = ParameterSnapshot();
+    std::copy_n(snapshot.data(), ParameterSnapshot::size(), loaded.data());
+    TEST_ASSERT_TRUE(loaded.isValid());
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(snapshot.getRegisters(), loaded.getRegisters(), ParameterSnapshot::REGISTER_COUNT);
+    TEST_ASSERT_EQUAL(16 + 2 * ParameterSnapshot::REGISTER_COUNT, ParameterSnapshot::size());
+}
+
+void testHeaderChangeDetected()
+{
+    // Magic, version, count, layout, and checksum, in that order.
+    for (const size_t offset : {0, 4, 6, 8, 12})
+    {
+        auto loaded = ParameterSnapshot();
+        std::copy_n(snapshot.data(), ParameterSnapshot::size(), loaded.data());
+        loaded.data()[offset] ^= 0x01;
+        TEST_ASSERT_FALSE(loaded.isValid());
+    }
+}
+
+void testLayoutCoversConfiguration()
+{
+    size_t count = 0;
+    for (const auto& span : MotionG::CONFIGURATION)
+    {
+        TEST_ASSERT_TRUE(MotionG::isConfiguration(span.address));
+        count += span.length;
+    }
+    TEST_ASSERT_EQUAL(count, ParameterSnapshot::REGISTER_COUNT);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testUnsealedInvalid);
+    RUN_TEST(testSealed);
+    RUN_TEST(testRegisterChangeDetected);
+    RUN_TEST(testStoredForm);
+    RUN_TEST(testHeaderChangeDetected);
+    RUN_TEST(testLayoutCoversConfiguration);
+    return UNITY_END();
+}
@@ -0,0 +1,123 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include <array>
+#include <unity.h>
+
+#include "ReadPlanner.hpp"
+
+namespace
+{
+    ///@brief 0x10-0x15 with one 32 bit value, then a hole, then 0x20-0x21.
+    constexpr std::array<RegisterSpan, 6> LAYOUT = {{
+        {0x10, 1},
+        {0x11, 1},
+        {0x12, 2},
+        {0x14, 1},
+        {0x15, 1},
+        {0x20, 2},
+    }};
+
+    const auto PLANNER = ReadPlanner(LAYOUT.data(), LAYOUT.size());
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void testIsReadable()
+{
+    TEST_ASSERT_TRUE(PLANNER.isReadable(0x10, 0x16));
+    // Inside a 32 bit value.
+    TEST_ASSERT_TRUE(PLANNER.isReadable(0x13, 0x14));
+    TEST_ASSERT_FALSE(PLANNER.isReadable(0x15, 0x17));
+    TEST_ASSERT_FALSE(PLANNER.isReadable(0x0F, 0x10));
+    // Nothing to read is always readable.
+    TEST_ASSERT_TRUE(PLANNER.isReadable(0x18, 0x18));
+}
+
+void testMergesCheapGaps()
+{
+    const std::array<RegisterSpan, 2> wanted = {{{0x10, 1}, {0x14, 1}}};
+    std::array<RegisterSpan, 2> reads = {};
+    // Three registers across costs 6 bytes.
+    TEST_ASSERT_EQUAL(1, PLANNER.plan(wanted.data(), wanted.size(), reads.data(), 6));
+    TEST_ASSERT_EQUAL_HEX16(0x10, reads[0].address);
+    TEST_ASSERT_EQUAL(5, reads[0].length);
+}
+
+void testSplitsExpensiveGaps()
+{
+    const std::array<RegisterSpan, 2> wanted = {{{0x10, 1}, {0x14, 1}}};
+    std::array<RegisterSpan, 2> reads = {};
+    TEST_ASSERT_EQUAL(2, PLANNER.plan(wanted.data(), wanted.size(), reads.data(), 5));
+    TEST_ASSERT_EQUAL_HEX16(0x10, reads[0].address);
+    TEST_ASSERT_EQUAL(1, reads[0].length);
+    TEST_ASSERT_EQUAL_HEX16(0x14, reads[1].address);
+    TEST_ASSERT_EQUAL(1, reads[1].length);
+}
+
+void testSplitsUndefinedGaps()
+{
+    const std::array<RegisterSpan, 2> wanted = {{{0x15, 1}, {0x20, 2}}};
+    std::array<RegisterSpan, 2> reads = {};
+    TEST_ASSERT_EQUAL(2, PLANNER.plan(wanted.data(), wanted.size(), reads.data(), UINT16_MAX));
+    TEST_ASSERT_EQUAL_HEX16(0x20, reads[1].address);
+    TEST_ASSERT_EQUAL(2, reads[1].length);
+}
+
+void testAdjacentSpansMerge()
+{
+    const std::array<RegisterSpan, 3> wanted = {{{0x10, 1}, {0x11, 1}, {0x12, 2}}};
+    std::array<RegisterSpan, 3> reads = {};
+    TEST_ASSERT_EQUAL(1, PLANNER.plan(wanted.data(), wanted.size(), reads.data(), 0));
+    TEST_ASSERT_EQUAL(4, reads[0].length);
+}
+
+void testRequestLengthLimit()
+{
+    std::array<RegisterSpan, 200> layout = {};
+    for (uint16_t i = 0; i < layout.size(); i++)
+    {
+        layout[i] = {i, 1};
+    }
+    const auto planner = ReadPlanner(layout.data(), layout.size());
+    const std::array<RegisterSpan, 3> wanted = {{{0, 1}, {124, 1}, {125, 1}}};
+    std::array<RegisterSpan, 3> reads = {};
+    TEST_ASSERT_EQUAL(2, planner.plan(wanted.data(), wanted.size(), reads.data(), UINT16_MAX));
+    TEST_ASSERT_EQUAL(MAX_READ_REGISTERS, reads[0].length);
+    TEST_ASSERT_EQUAL(125, reads[1].address);
+
+    auto read = RegisterSpan();
+    TEST_ASSERT_EQUAL(2, planner.planNext(wanted.data(), wanted.size(), read, UINT16_MAX));
+}
+
+void testEstimateSplitCost()
+{
+    // Framing alone, when the drive answers instantly.
+    TEST_ASSERT_EQUAL(13, ReadPlanner::estimateSplitCost(0, 9600));
+    // 1ms is about 11 bytes at 115200 baud.
+    TEST_ASSERT_EQUAL(24, ReadPlanner::estimateSplitCost(1000, 115200));
+    TEST_ASSERT_EQUAL(UINT16_MAX, ReadPlanner::estimateSplitCost(UINT32_MAX / 10, 921600));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testIsReadable);
+    RUN_TEST(testMergesCheapGaps);
+    RUN_TEST(testSplitsExpensiveGaps);
+    RUN_TEST(testSplitsUndefinedGaps);
+    RUN_TEST(testAdjacentSpansMerge);
+    RUN_TEST(testRequestLengthLimit);
+    RUN_TEST(testEstimateSplitCost);
+    return UNITY_END();
+}
@@ -0,0 +1,145 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include <unity.h>
+
+#include "RttEstimator.hpp"
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void testCeilingUntilFirstSample()
+{
+    const auto rtt = RttEstimator(10, 500);
+    TEST_ASSERT_EQUAL_UINT32(500, rtt.getTimeout());
+}
+
+void testFirstSample()
+{
+    auto rtt = RttEstimator(1, 500);
+    rtt.addSample(2000);
+    TEST_ASSERT_EQUAL_UINT32(2000, rtt.getMean());
+    TEST_ASSERT_EQUAL_UINT32(1000, rtt.getDeviation());
+    // 2ms + 4 * 1ms.
+    TEST_ASSERT_EQUAL_UINT32(6, rtt.getTimeout());
+}
+
+void testSmoothing()
+{
+    auto rtt = RttEstimator(1, 500);
+    rtt.addSample(2000);
+    rtt.addSample(2800);
+    TEST_ASSERT_EQUAL_UINT32(2100, rtt.getMean());
+    TEST_ASSERT_EQUAL_UINT32(950, rtt.getDeviation());
+    TEST_ASSERT_EQUAL_UINT32(6, rtt.getTimeout());
+}
+
+void testFloor()
+{
+    auto rtt = RttEstimator(10, 500);
+    rtt.addSample(100);
+    TEST_ASSERT_EQUAL_UINT32(10, rtt.getTimeout());
+}
+
+void testBackoff()
+{
+    auto rtt = RttEstimator(1, 500);
+    rtt.addSample(2000);
+    rtt.addTimeout();
+    TEST_ASSERT_EQUAL_UINT32(12, rtt.getTimeout());
+    rtt.addTimeout();
+    TEST_ASSERT_EQUAL_UINT32(24, rtt.getTimeout());
+    for (auto i = 0; i < 10; i++)
+    {
+        rtt.addTimeout();
+    }
+    // Backs off at most 32 times.
+    TEST_ASSERT_EQUAL_UINT32(192, rtt.getTimeout());
+    TEST_ASSERT_EQUAL_UINT32(12, rtt.getTimeouts());
+
+    // The next response starts over, with the deviation shrinking.
+    rtt.addSample(2000);
+    TEST_ASSERT_EQUAL_UINT32(5, rtt.getTimeout());
+}
+
+void testBackoffCeiling()
+{
+    auto rtt = RttEstimator(1, 100);
+    rtt.addSample(20000);
+    rtt.addTimeout();
+    rtt.addTimeout();
+    TEST_ASSERT_EQUAL_UINT32(100, rtt.getTimeout());
+}
+
+void testTimeoutBeforeSample()
+{
+    auto rtt = RttEstimator(10, 500);
+    rtt.addTimeout();
+    TEST_ASSERT_EQUAL_UINT32(500, rtt.getTimeout());
+    TEST_ASSERT_EQUAL_UINT32(1, rtt.getTimeouts());
+}
+
+void testBadSampleClamped()
+{
+    auto rtt = RttEstimator(1, 500);
+    // A negative round trip, as an unsigned difference.
+    rtt.addSample(static_cast<uint32_t>(-50));
+    TEST_ASSERT_EQUAL_UINT32(500000, rtt.getMean());
+    TEST_ASSERT_EQUAL_UINT32(500, rtt.getTimeout());
+
+    // Good samples bring it back down.
+    for (auto i = 0; i < 100; i++)
+    {
+        rtt.addSample(2000);
+    }
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(3, rtt.getTimeout());
+}
+
+void testSetLimits()
+{
+    auto rtt = RttEstimator(10, 500);
+    rtt.setLimits(20, 10);
+    // The ceiling never goes below the floor.
+    TEST_ASSERT_EQUAL_UINT32(20, rtt.getCeiling());
+    TEST_ASSERT_EQUAL_UINT32(20, rtt.getTimeout());
+
+    rtt.addSample(2000);
+    rtt.setLimits(1, 500);
+    TEST_ASSERT_EQUAL_UINT32(6, rtt.getTimeout());
+}
+
+void testReset()
+{
+    auto rtt = RttEstimator(1, 500);
+    rtt.addSample(2000);
+    rtt.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, rtt.getMean());
+    TEST_ASSERT_EQUAL_UINT32(500, rtt.getTimeout());
+    rtt.addSample(4000);
+    TEST_ASSERT_EQUAL_UINT32(4000, rtt.getMean());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testCeilingUntilFirstSample);
+    RUN_TEST(testFirstSample);
+    RUN_TEST(testSmoothing);
+    RUN_TEST(testFloor);
+    RUN_TEST(testBackoff);
+    RUN_TEST(testBackoffCeiling);
+    RUN_TEST(testTimeoutBeforeSample);
+    RUN_TEST(testBadSampleClamped);
+    RUN_TEST(testSetLimits);
+    RUN_TEST(testReset);
+    return UNITY_END();
+}
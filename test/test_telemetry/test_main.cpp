@@ -0,0 +1,269 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ */
+
+#include <array>
+#include <unity.h>
+
+#include "TelemetryStream.hpp"
+
+namespace
+{
+    ///@brief Reads a frame back, as `tools/decode_telemetry.py` does.
+    class FrameReader
+    {
+    public:
+        FrameReader(const uint8_t* frame, const size_t length):
+            frame{frame},
+            length{length},
+            position{2}
+        {
+        }
+
+        ///@return true if the sync byte, length, and CRC all check out.
+        [[nodiscard]] bool isIntact() const
+        {
+            if (length < 4 || frame[0] != TelemetryEncoder::SYNC || frame[1] != length - 4)
+            {
+                return false;
+            }
+            uint16_t crc = 0xFFFF;
+            for (size_t i = 1; i < length - 2; i++)
+            {
+                crc ^= frame[i];
+                for (auto bit = 0; bit < 8; bit++)
+                {
+                    crc = crc & 1 ? crc >> 1 ^ 0xA001 : crc >> 1;
+                }
+            }
+            return frame[length - 2] == (crc & 0xFF) && frame[length - 1] == crc >> 8;
+        }
+
+        uint8_t byte()
+        {
+            return frame[position++];
+        }
+
+        uint32_t varint()
+        {
+            uint32_t value = 0;
+            for (auto shift = 0;; shift += 7)
+            {
+                const auto next = byte();
+                value |= static_cast<uint32_t>(next & 0x7F) << shift;
+                if (not (next & 0x80))
+                {
+                    return value;
+                }
+            }
+        }
+
+        int32_t zigzag()
+        {
+            const auto value = varint();
+            return static_cast<int32_t>(value >> 1 ^ -(value & 1));
+        }
+
+        uint32_t time()
+        {
+            uint32_t value = 0;
+            for (auto shift = 0; shift < 32; shift += 8)
+            {
+                value |= static_cast<uint32_t>(byte()) << shift;
+            }
+            return value;
+        }
+
+        ///@return true if every payload byte was read.
+        [[nodiscard]] bool isDone() const
+        {
+            return position == length - 2;
+        }
+
+    private:
+        const uint8_t* frame;
+        size_t length;
+        size_t position;
+    };
+
+    TelemetrySample makeSample(const uint32_t time, const int32_t position)
+    {
+        auto sample = TelemetrySample();
+        sample.time = time;
+        for (auto& axis : sample.axes)
+        {
+            axis.valid = true;
+            axis.offset = 10;
+            axis.position = position;
+            axis.followingError = -3;
+            axis.current = 100;
+        }
+        return sample;
+    }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void testKeyframe()
+{
+    auto encoder = TelemetryEncoder();
+    auto sample = makeSample(0x12345678, -1000);
+    sample.axes[1].errorCode = 0x2310;
+    std::array<uint8_t, TelemetryEncoder::MAX_FRAME_SIZE> frame = {};
+    const auto length = encoder.encode(sample, frame.data());
+
+    auto reader = FrameReader(frame.data(), length);
+    TEST_ASSERT_TRUE(reader.isIntact());
+    TEST_ASSERT_EQUAL(TelemetryEncoder::KEYFRAME, reader.byte());
+    TEST_ASSERT_EQUAL(0, reader.byte());
+    TEST_ASSERT_EQUAL_UINT32(0x12345678, reader.time());
+    for (size_t axis = 0; axis < 2; axis++)
+    {
+        TEST_ASSERT_EQUAL_HEX8(axis == 0 ? 0x01 : 0x03, reader.byte());
+        TEST_ASSERT_EQUAL_UINT32(10, reader.varint());
+        TEST_ASSERT_EQUAL_INT32(-1000, reader.zigzag());
+        TEST_ASSERT_EQUAL_INT32(-3, reader.zigzag());
+        TEST_ASSERT_EQUAL_INT32(100, reader.zigzag());
+    }
+    TEST_ASSERT_EQUAL_HEX16(0x2310, reader.varint());
+    TEST_ASSERT_TRUE(reader.isDone());
+}
+
+void testDelta()
+{
+    auto encoder = TelemetryEncoder();
+    std::array<uint8_t, TelemetryEncoder::MAX_FRAME_SIZE> frame = {};
+    encoder.encode(makeSample(0xFFFFFF00, 500), frame.data());
+    encoder.encode(makeSample(0xFFFFFF80, INT32_MAX), frame.data());
+    // Time and position both wrap.
+    auto sample = makeSample(0x00000100, 400);
+    sample.axes[0].position = INT32_MIN;
+    const auto length = encoder.encode(sample, frame.data());
+
+    auto reader = FrameReader(frame.data(), length);
+    TEST_ASSERT_TRUE(reader.isIntact());
+    TEST_ASSERT_EQUAL(TelemetryEncoder::DELTA, reader.byte());
+    TEST_ASSERT_EQUAL(2, reader.byte());
+    TEST_ASSERT_EQUAL_UINT32(0x180, reader.varint());
+    TEST_ASSERT_EQUAL_HEX8(0x01, reader.byte());
+    TEST_ASSERT_EQUAL_UINT32(10, reader.varint());
+    TEST_ASSERT_EQUAL_INT32(1, reader.zigzag());
+    TEST_ASSERT_EQUAL_INT32(0, reader.zigzag());
+    TEST_ASSERT_EQUAL_INT32(0, reader.zigzag());
+    TEST_ASSERT_EQUAL_HEX8(0x01, reader.byte());
+    TEST_ASSERT_EQUAL_UINT32(10, reader.varint());
+    TEST_ASSERT_EQUAL_INT32(400 - INT32_MAX, reader.zigzag());
+    TEST_ASSERT_EQUAL_INT32(0, reader.zigzag());
+    TEST_ASSERT_EQUAL_INT32(0, reader.zigzag());
+    TEST_ASSERT_TRUE(reader.isDone());
+}
+
+void testInvalidAxis()
+{
+    auto encoder = TelemetryEncoder();
+    std::array<uint8_t, TelemetryEncoder::MAX_FRAME_SIZE> frame = {};
+    encoder.encode(makeSample(0, 500), frame.data());
+    auto sample = makeSample(1000, 600);
+    sample.axes[0].valid = false;
+    sample.axes[0].errorCode = 0x1234;
+    auto length = encoder.encode(sample, frame.data());
+
+    auto reader = FrameReader(frame.data(), length);
+    TEST_ASSERT_EQUAL(TelemetryEncoder::DELTA, reader.byte());
+    reader.byte();
+    reader.varint();
+    // Nothing else for an invalid axis, not even its error code.
+    TEST_ASSERT_EQUAL_HEX8(0x00, reader.byte());
+    TEST_ASSERT_EQUAL_UINT32(10, reader.varint());
+    TEST_ASSERT_EQUAL_HEX8(0x01, reader.byte());
+    reader.varint();
+    TEST_ASSERT_EQUAL_INT32(100, reader.zigzag());
+
+    // Recovering forces a keyframe, so the receiver has absolute values again.
+    length = encoder.encode(makeSample(2000, 700), frame.data());
+    TEST_ASSERT_EQUAL(TelemetryEncoder::KEYFRAME, FrameReader(frame.data(), length).byte());
+}
+
+void testKeyframeInterval()
+{
+    auto encoder = TelemetryEncoder();
+    std::array<uint8_t, TelemetryEncoder::MAX_FRAME_SIZE> frame = {};
+    for (uint32_t i = 0; i <= TelemetryEncoder::KEYFRAME_INTERVAL; i++)
+    {
+        const auto length = encoder.encode(makeSample(i * 1000, i), frame.data());
+        const auto isKeyframe = i % TelemetryEncoder::KEYFRAME_INTERVAL == 0;
+        TEST_ASSERT_EQUAL(isKeyframe ? TelemetryEncoder::KEYFRAME : TelemetryEncoder::DELTA, FrameReader(frame.data(), length).byte());
+    }
+
+    encoder.encode(makeSample(0, 0), frame.data());
+    encoder.reset();
+    const auto length = encoder.encode(makeSample(0, 0), frame.data());
+    TEST_ASSERT_EQUAL(TelemetryEncoder::KEYFRAME, FrameReader(frame.data(), length).byte());
+}
+
+void testWorstCaseFits()
+{
+    auto encoder = TelemetryEncoder();
+    std::array<uint8_t, TelemetryEncoder::MAX_FRAME_SIZE> frame = {};
+    auto sample = TelemetrySample();
+    sample.time = UINT32_MAX;
+    for (auto& axis : sample.axes)
+    {
+        axis.valid = true;
+        axis.offset = UINT32_MAX;
+        axis.errorCode = UINT16_MAX;
+        axis.position = INT32_MIN;
+        axis.followingError = INT32_MIN;
+        axis.current = INT16_MIN;
+    }
+    const auto length = encoder.encode(sample, frame.data());
+    TEST_ASSERT_TRUE(length <= TelemetryEncoder::MAX_FRAME_SIZE);
+    TEST_ASSERT_TRUE(FrameReader(frame.data(), length).isIntact());
+}
+
+void testSetAxis()
+{
+    auto status = LinearMotorStatus();
+    status.fields = TELEMETRY_STATUS_FIELDS;
+    status.timestamp = 1250;
+    status.position = 42;
+    status.errorCode = 0x7500;
+
+    auto sample = TelemetrySample();
+    sample.time = 1000;
+    sample.setAxis(1, status);
+    TEST_ASSERT_TRUE(sample.axes[1].valid);
+    TEST_ASSERT_EQUAL_UINT32(250, sample.axes[1].offset);
+    TEST_ASSERT_EQUAL_INT32(42, sample.axes[1].position);
+    TEST_ASSERT_EQUAL_HEX16(0x7500, sample.axes[1].errorCode);
+
+    // A missing field, or a failed poll, leaves nothing worth sending.
+    status.fields = TELEMETRY_STATUS_FIELDS & ~STATUS_POSITION;
+    sample.setAxis(1, status);
+    TEST_ASSERT_FALSE(sample.axes[1].valid);
+    status.fields = TELEMETRY_STATUS_FIELDS;
+    status.modbusError = MODBUS_RTU_MASTER_RESPONSE_TIMEOUT;
+    sample.setAxis(1, status);
+    TEST_ASSERT_FALSE(sample.axes[1].valid);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(testKeyframe);
+    RUN_TEST(testDelta);
+    RUN_TEST(testInvalidAxis);
+    RUN_TEST(testKeyframeInterval);
+    RUN_TEST(testWorstCaseFits);
+    RUN_TEST(testSetAxis);
+    return UNITY_END();
+}
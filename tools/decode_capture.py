@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+"""
+Download an axis' fault capture (CAPTURE command), and print it as CSV.
+
+Usage: python tools/decode_capture.py /dev/ttyUSB0 axis [capture.bin]
+       python tools/decode_capture.py capture.bin
+
+Serial ports need pyserial.  The raw download, header line included, is saved to capture.bin if given.
+Output columns are the time relative to the trigger (us), then the raw register values.
+Values the poll did not read are left empty.
+"""
+import re
+import struct
+import sys
+
+# CaptureSample in src/FaultCapture.hpp.
+SAMPLE = struct.Struct("<IiiIhHHH")
+# LinearMotorStatusField flags in src/LinearMotor.hpp.
+VELOCITY = 1 << 3
+CURRENT = 1 << 5
+DC_LINK_VOLTAGE = 1 << 6
+FOLLOWING_ERROR = 1 << 7
+
+
+def download(port, axis):
+    """Ask for the capture, and return it, header line included."""
+    import serial
+    stream = serial.Serial(port, 115200, timeout=2)
+    stream.reset_input_buffer()
+    stream.write(f"CAPTURE {axis}\n".encode())
+    # Skip anything printed before the header, like error reports.
+    while True:
+        line = stream.readline()
+        if not line:
+            raise RuntimeError("No reply to CAPTURE")
+        if line.startswith(b"Capture: "):
+            break
+        if b"capture: " in line:
+            raise RuntimeError(line.decode().strip())
+    count, size, _ = parse_header(line)
+    data = stream.read(count * size)
+    if len(data) != count * size:
+        raise RuntimeError(f"Expected {count * size} bytes, got {len(data)}")
+    return line + data
+
+
+def parse_header(line):
+    match = re.match(rb"Capture: (\d+) samples of (\d+) bytes, trigger at (\d+)", line)
+    if match is None:
+        raise RuntimeError(f"Not a capture: {line!r}")
+    count, size, trigger = int(match[1]), int(match[2]), int(match[3])
+    if size != SAMPLE.size:
+        raise RuntimeError(f"Samples are {size} bytes, expected {SAMPLE.size}")
+    return count, size, trigger
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    source = sys.argv[1]
+    if source.startswith("/dev/") or source.upper().startswith("COM"):
+        if len(sys.argv) < 3:
+            print(__doc__)
+            return 1
+        capture = download(source, sys.argv[2])
+        if len(sys.argv) > 3:
+            with open(sys.argv[3], "wb") as output:
+                output.write(capture)
+    else:
+        with open(source, "rb") as stream:
+            capture = stream.read()
+
+    header, _, data = capture.partition(b"\n")
+    count, size, trigger = parse_header(header)
+    samples = [SAMPLE.unpack_from(data, index * size) for index in range(count)]
+    triggered_at = samples[trigger][0] if samples else 0
+
+    print("time,following_error,velocity,current,dc_link_voltage,error_code,modbus_error")
+    for time, following_error, velocity, dc_link_voltage, current, error_code, fields, modbus_error in samples:
+        def read(flag, value):
+            return str(value) if fields & flag else ""
+        offset = (time - triggered_at + 0x80000000) % 0x100000000 - 0x80000000
+        print(",".join([str(offset), read(FOLLOWING_ERROR, following_error), read(VELOCITY, velocity),
+                        read(CURRENT, current), read(DC_LINK_VOLTAGE, dc_link_voltage),
+                        f"0x{error_code:04X}", str(modbus_error)]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
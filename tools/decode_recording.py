@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+"""
+Download the flight recorder (RECORDING command), and print it as CSV.
+
+Usage: python tools/decode_recording.py /dev/ttyUSB0 [capture.bin]
+       python tools/decode_recording.py capture.bin
+
+Serial ports need pyserial.  The raw download, header line included, is saved to capture.bin if given.
+Records come a port at a time, and are sorted back into the order they happened.
+Output columns are the sequence number, time (us), port, direction, frame length,
+routine polls left out on that port just before, then the kept bytes in hex.
+Frames longer than the kept bytes end with "...".
+"""
+import re
+import struct
+import sys
+
+# FlightRecord in src/FlightRecorder.hpp.
+RECORD = struct.Struct("<IIHHBB34s")
+CHANNELS = ("host", "bus0", "bus1")
+DIRECTIONS = ("sent", "received")
+
+
+def download(port):
+    """Ask for the recording, and return it, header line included."""
+    import serial
+    stream = serial.Serial(port, 115200, timeout=2)
+    stream.reset_input_buffer()
+    stream.write(b"RECORDING\n")
+    # Skip anything printed before the header, like error reports.
+    while True:
+        line = stream.readline()
+        if not line:
+            raise RuntimeError("No reply to RECORDING")
+        if line.startswith(b"Recording: "):
+            break
+    count, size = parse_header(line)
+    data = stream.read(count * size)
+    if len(data) != count * size:
+        raise RuntimeError(f"Expected {count * size} bytes, got {len(data)}")
+    return line + data
+
+
+def parse_header(line):
+    match = re.match(rb"Recording: (\d+) records of (\d+) bytes", line)
+    if match is None:
+        raise RuntimeError(f"Not a recording: {line!r}")
+    count, size = int(match[1]), int(match[2])
+    if size != RECORD.size:
+        raise RuntimeError(f"Records are {size} bytes, expected {RECORD.size}")
+    return count, size
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    source = sys.argv[1]
+    if source.startswith("/dev/") or source.upper().startswith("COM"):
+        capture = download(source)
+        if len(sys.argv) > 2:
+            with open(sys.argv[2], "wb") as output:
+                output.write(capture)
+    else:
+        with open(source, "rb") as stream:
+            capture = stream.read()
+
+    header, _, data = capture.partition(b"\n")
+    count, size = parse_header(header)
+    if b"frozen" in header:
+        print("frozen by a fault", file=sys.stderr)
+
+    # Sent a port at a time, so put them back in the order they happened.
+    records = [RECORD.unpack_from(data, index * size) for index in range(count)]
+    lost = sum(1 for record in records if record[2] == 0)
+    records = sorted((record for record in records if record[2] != 0), key=lambda record: record[1])
+
+    print("sequence,time,port,direction,length,skipped,data")
+    for time, sequence, length, skipped, channel, direction, kept in records:
+        port = CHANNELS[channel] if channel < len(CHANNELS) else str(channel)
+        shown = kept[:min(length, len(kept))].hex(" ")
+        if length > len(kept):
+            shown += " ..."
+        print(f"{sequence},{time},{port},{DIRECTIONS[direction & 1]},{length},{skipped},{shown}")
+    if lost:
+        print(f"{lost} records lost", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
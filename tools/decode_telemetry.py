@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+"""
+Decode the binary telemetry stream (STREAMING mode) into CSV.
+
+Usage: python tools/decode_telemetry.py /dev/ttyUSB0 [rate]
+       python tools/decode_telemetry.py capture.bin
+
+Serial ports need pyserial.  Output columns are the sample time, then for each axis:
+offset (us after the sample time), valid, error code, position, following error, current.
+"""
+import struct
+import sys
+
+SYNC = 0xA5
+KEYFRAME = 1
+DELTA = 2
+AXES = ("x", "y")
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0xA001 if crc & 1 else crc >> 1
+    return crc
+
+
+def varint(payload, index):
+    value = 0
+    shift = 0
+    while True:
+        byte = payload[index]
+        index += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, index
+
+
+def signed(payload, index):
+    value, index = varint(payload, index)
+    return (value >> 1) ^ -(value & 1), index
+
+
+def wrap32(value):
+    return (value + 0x80000000) % 0x100000000 - 0x80000000
+
+
+class Decoder:
+    def __init__(self):
+        self.time = None
+        self.axes = [{"position": 0, "following_error": 0, "current": 0} for _ in AXES]
+        self.sequence = None
+        self.lost = 0
+
+    def decode(self, payload):
+        """Decode one payload.  Returns a row, or None if it can not be decoded yet."""
+        kind = payload[0]
+        sequence = payload[1]
+        if self.sequence is not None and sequence != (self.sequence + 1) % 256:
+            self.lost += 1
+            # Deltas are meaningless once a frame is lost.
+            self.time = None
+        self.sequence = sequence
+
+        index = 2
+        if kind == KEYFRAME:
+            self.time = struct.unpack_from("<I", payload, index)[0]
+            index += 4
+        elif kind == DELTA and self.time is not None:
+            delta, index = varint(payload, index)
+            self.time = (self.time + delta) % 0x100000000
+        else:
+            return None
+
+        row = [self.time]
+        for axis in self.axes:
+            flags = payload[index]
+            index += 1
+            offset, index = varint(payload, index)
+            valid = bool(flags & 0x01)
+            error_code = 0
+            if valid:
+                values = []
+                for _ in range(3):
+                    value, index = signed(payload, index)
+                    values.append(value)
+                if kind == KEYFRAME:
+                    axis["position"], axis["following_error"], axis["current"] = values
+                else:
+                    axis["position"] = wrap32(axis["position"] + values[0])
+                    axis["following_error"] = wrap32(axis["following_error"] + values[1])
+                    axis["current"] += values[2]
+                if flags & 0x02:
+                    error_code, index = varint(payload, index)
+            row += [offset, int(valid), error_code, axis["position"], axis["following_error"], axis["current"]]
+        return row
+
+
+def frames(stream):
+    """Yield payloads of valid frames, resynchronising on errors."""
+    buffer = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            return
+        buffer += chunk
+        while True:
+            start = buffer.find(SYNC)
+            if start < 0:
+                buffer.clear()
+                break
+            del buffer[:start]
+            if len(buffer) < 2 or len(buffer) < buffer[1] + 4:
+                break
+            length = buffer[1]
+            frame = bytes(buffer[:length + 4])
+            if crc16(frame[1:length + 2]) == frame[length + 2] | frame[length + 3] << 8:
+                yield frame[2:length + 2]
+                del buffer[:length + 4]
+            else:
+                del buffer[:1]
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    source = sys.argv[1]
+    if source.startswith("/dev/") or source.upper().startswith("COM"):
+        import serial
+        stream = serial.Serial(source, 115200, timeout=1)
+        rate = sys.argv[2] if len(sys.argv) > 2 else ""
+        stream.write(f"STREAM:{rate}\n".encode() if rate else b"STREAM\n")
+    else:
+        stream = open(source, "rb")
+
+    columns = ["time"]
+    for axis in AXES:
+        columns += [f"{axis}_{name}" for name in ("offset", "valid", "error", "position", "following_error", "current")]
+    print(",".join(columns))
+
+    decoder = Decoder()
+    try:
+        for payload in frames(stream):
+            row = decoder.decode(payload)
+            if row is not None:
+                print(",".join(str(value) for value in row))
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if decoder.lost:
+            print(f"{decoder.lost} frames lost", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
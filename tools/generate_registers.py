@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+"""
+Generate src/MotionGRegisters.hpp from docs/MotionG/Modbus Dictionary.csv,
+and src/MotionGParameters.hpp from docs/MotionG/params_info.csv.
+
+Usage: python tools/generate_registers.py
+"""
+import csv
+import math
+import re
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+DICTIONARY = ROOT / "docs" / "MotionG" / "Modbus Dictionary.csv"
+OUTPUT = ROOT / "src" / "MotionGRegisters.hpp"
+PARAMETERS = ROOT / "docs" / "MotionG" / "params_info.csv"
+PARAMETERS_OUTPUT = ROOT / "src" / "MotionGParameters.hpp"
+
+TYPES = {
+    "UNS8": ("uint8_t", 1),
+    "UNS16": ("uint16_t", 1),
+    "UNS32": ("uint32_t", 2),
+    "INTEGER8": ("int8_t", 1),
+    "INTEGER16": ("int16_t", 1),
+    "INTEGER32": ("int32_t", 2),
+}
+
+ACCESS = {
+    "RO": "READ_ONLY",
+    "RW": "READ_WRITE",
+}
+
+# Parameter types, with their range on the wire.
+PARAMETER_TYPES = {
+    "UNS8": ("PARAMETER_UNS8", 0, 0xFF),
+    "UNS16": ("PARAMETER_UNS16", 0, 0xFFFF),
+    "UNS32": ("PARAMETER_UNS32", 0, 0xFFFFFFFF),
+    "INTEGER8": ("PARAMETER_INT8", -0x80, 0x7F),
+    "INTEGER16": ("PARAMETER_INT16", -0x8000, 0x7FFF),
+    "INTEGER32": ("PARAMETER_INT32", -0x80000000, 0x7FFFFFFF),
+}
+
+# Read write registers which are commands, live set points, or the link itself, rather than configuration.
+# Snapshots leave these alone, since restoring them would act on the drive, or cut it off.
+NOT_CONFIGURATION = re.compile(
+    r"\w*Cmd|\w*Command|Controlword|Target_\w+|\w+TargetValue|TargetPressure|Modes_of_operation|ModbusBaudrate|ModbusNodeID"
+    r"|Digital_outputs_Physical_outputs|Touch_probe_function|Interpolation_data_record_\w+|\w+_Buffer_clear"
+    r"|\w+ScanCompletionFlag|MultiSegmentSet\w+|PositionErrorCorrectionSet\w+|\w+MaxRecordValue"
+)
+
+IS_CONFIGURATION = """\
+    ///@brief Check if a register starts an entry in `CONFIGURATION`.
+    constexpr bool isConfiguration(const uint16_t address)
+    {
+        for (const auto& span : CONFIGURATION)
+        {
+            if (span.address == address)
+            {
+                return true;
+            }
+        }
+        return false;
+    }"""
+
+HEADER = """\
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief Every register in the MotionG DN1-G60xxN Modbus dictionary.
+ * @details Generated by tools/generate_registers.py from docs/MotionG/Modbus Dictionary.csv.  Do not edit.
+ */
+
+#pragma once
+#include <array>
+
+#include "ReadPlanner.hpp"
+#include "Register.hpp"
+
+namespace MotionG
+{"""
+
+
+def identifier(row):
+    """Array entries, like "DriveName[20]", become one register per sub-index."""
+    name = row["Od_Name"]
+    array = re.fullmatch(r"(\w+)\[\d+\]", name)
+    if array:
+        return f"{array.group(1)}_{row['Od_Subindex']}"
+    if not re.fullmatch(r"[A-Za-z_]\w*", name):
+        raise ValueError(f"Unusable register name: {name}")
+    return name
+
+
+PARAMETERS_HEADER = """\
+/**
+ * SPDX-License-Identifier: MIT
+ * SPDX-SnippetCopyrightText: 2025 Arthur Moore <Arthur.Moore.git@cd-net.net>
+ * @file
+ * @copyright Arthur Moore <Arthur.Moore.git@cd-net.net> 2025
+ * @brief Every named parameter in the MotionG DN1-G60xxN parameter list, with its limits.
+ * @details Generated by tools/generate_registers.py from docs/MotionG/params_info.csv.  Do not edit.
+ *          Only include from one translation unit.  Look parameters up with `findParameter()`.
+ */
+
+#pragma once
+#include <array>
+
+#include "Parameter.hpp"
+
+namespace MotionG
+{"""
+
+
+def parameter_type(row, dictionary):
+    """The dictionary knows what is actually on the wire.  Otherwise, go by the length, and the sign of the limits."""
+    address = int(row["ModbusStartAddress"]) - 1
+    if address in dictionary:
+        return dictionary[address]
+    data_type = row["DataType"]
+    if data_type in PARAMETER_TYPES and TYPES[data_type][1] == int(row["ModbusLength"]):
+        return data_type
+    signed = data_type.startswith("INTEGER") or limit(row["LowerLimit"], 0) < 0
+    size = "32" if row["ModbusLength"] == "2" else "16"
+    return ("INTEGER" if signed else "UNS") + size
+
+
+def limit(text, default):
+    try:
+        return float(text)
+    except ValueError:
+        return default
+
+
+def parameters(dictionary, configuration):
+    """Parameters are sorted by name, so they can be found with a binary search."""
+    result = []
+    with PARAMETERS.open(encoding="utf-8") as file:
+        for row in csv.DictReader(file):
+            name = row["VariableName"]
+            if not row["ModbusStartAddress"].isdigit() or row["ModbusLength"] not in ("1", "2"):
+                continue
+            if not re.fullmatch(r"[a-z_]\w*", name):
+                print(f"Skipping parameter {name}: arrays are not supported")
+                continue
+            type_name, lowest, highest = PARAMETER_TYPES[parameter_type(row, dictionary)]
+            # Scaled values are sent as integers, in units of 1 / scale.
+            scale = int(row["Transform"] or 1)
+            lower = max(lowest, min(highest, math.ceil(limit(row["LowerLimit"], lowest) * scale)))
+            upper = max(lowest, min(highest, math.floor(limit(row["UpperLimit"], highest) * scale)))
+            if lower > upper:
+                raise ValueError(f"{name}: lower limit is above the upper limit")
+            access = "READ_ONLY" if row["Access"] == "RO" else "READ_WRITE"
+            address = int(row["ModbusStartAddress"]) - 1
+            # Same rule as the CONFIGURATION table, so commands and the link itself can not be set by name.
+            is_configuration = "true" if access == "READ_WRITE" and address in configuration else "false"
+            result.append((name, address, type_name, access, is_configuration, scale, lower, upper))
+    result.sort(key=lambda parameter: parameter[0].encode())
+    names = [parameter[0] for parameter in result]
+    duplicates = {name for name in names if names.count(name) > 1}
+    if duplicates:
+        raise ValueError(f"Duplicate parameter names: {duplicates}")
+    return result
+
+
+def write_parameters(dictionary, configuration):
+    lines = [PARAMETERS_HEADER]
+    entries = parameters(dictionary, configuration)
+    lines.append("    ///@brief Every parameter, sorted by name.  Limits are raw values, in units of 1 / scale.")
+    lines.append(f"    constexpr std::array<ParameterInfo, {len(entries)}> PARAMETERS = {{{{")
+    for name, address, type_name, access, is_configuration, scale, lower, upper in entries:
+        lines.append(f"        {{\"{name}\", 0x{address:04X}, {type_name}, {access}, {is_configuration}, {scale}, {lower}, {upper}}},")
+    lines.append("    }};")
+    lines.append("}")
+    lines.append("")
+
+    PARAMETERS_OUTPUT.write_text("\n".join(lines), encoding="utf-8")
+    print(f"Wrote {len(entries)} parameters to {PARAMETERS_OUTPUT.relative_to(ROOT)}")
+
+
+def main():
+    registers = []
+    dictionary = {}
+    with DICTIONARY.open(encoding="utf-8") as file:
+        for row in csv.DictReader(file):
+            # A few rows were mangled by a spreadsheet.  Only the decimal address is trustworthy.
+            if not row["MCUStartAddress(Dec)"].isdigit():
+                print(f"Skipping {row['Od_Name']} sub-index {row['Od_Subindex']}: no address")
+                continue
+            data_type, length = TYPES[row["Od_DataType"]]
+            if int(row["Length"]) != length:
+                raise ValueError(f"{row['Od_Name']}: length does not match {row['Od_DataType']}")
+            registers.append((int(row["MCUStartAddress(Dec)"]), length, data_type, ACCESS[row["Od_Access"]],
+                              identifier(row), " ".join(row["Od_Description"].split())))
+            dictionary[int(row["MCUStartAddress(Dec)"])] = row["Od_DataType"]
+
+    registers.sort(key=lambda register: register[0])
+    names = [register[4] for register in registers]
+    duplicates = {name for name in names if names.count(name) > 1}
+    if duplicates:
+        raise ValueError(f"Duplicate register names: {duplicates}")
+
+    lines = [HEADER]
+    for address, _, data_type, access, name, description in registers:
+        if description:
+            lines.append(f"    ///@brief {description}")
+        lines.append(f"    using {name} = Register<0x{address:04X}, {data_type}, {access}>;")
+    lines.append("")
+    lines.append("    ///@brief Every register, sorted by address.  Anything missing is not known to exist.")
+    lines.append(f"    constexpr std::array<RegisterSpan, {len(registers)}> LAYOUT = {{{{")
+    for address, length, *_ in registers:
+        lines.append(f"        {{0x{address:04X}, {length}}},")
+    lines.append("    }};")
+    lines.append("")
+    configuration = [register for register in registers
+                     if register[3] == "READ_WRITE" and not NOT_CONFIGURATION.fullmatch(register[4])]
+    lines.append("    ///@brief Every configuration register, sorted by address.  Read write, but not commands or set points.")
+    lines.append(f"    constexpr std::array<RegisterSpan, {len(configuration)}> CONFIGURATION = {{{{")
+    for address, length, *_ in configuration:
+        lines.append(f"        {{0x{address:04X}, {length}}},")
+    lines.append("    }};")
+    lines.append("")
+    lines.append(IS_CONFIGURATION)
+    lines.append("}")
+    lines.append("")
+
+    OUTPUT.write_text("\n".join(lines), encoding="utf-8")
+    print(f"Wrote {len(registers)} registers to {OUTPUT.relative_to(ROOT)}")
+
+    write_parameters(dictionary, {register[0] for register in configuration})
+
+
+if __name__ == "__main__":
+    main()